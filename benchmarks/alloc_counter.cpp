@@ -0,0 +1,57 @@
+#include "alloc_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<size_t> g_allocationCount{0};
+} // namespace
+
+namespace vpd
+{
+namespace bench
+{
+size_t getAllocationCount() noexcept
+{
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+} // namespace bench
+} // namespace vpd
+
+void* operator new(std::size_t i_size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* l_ptr = std::malloc(i_size ? i_size : 1))
+    {
+        return l_ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t i_size)
+{
+    return operator new(i_size);
+}
+
+void operator delete(void* i_ptr) noexcept
+{
+    std::free(i_ptr);
+}
+
+void operator delete[](void* i_ptr) noexcept
+{
+    std::free(i_ptr);
+}
+
+void operator delete(void* i_ptr, std::size_t) noexcept
+{
+    std::free(i_ptr);
+}
+
+void operator delete[](void* i_ptr, std::size_t) noexcept
+{
+    std::free(i_ptr);
+}
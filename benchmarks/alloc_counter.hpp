@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace vpd
+{
+namespace bench
+{
+/**
+ * @brief API to get number of heap allocations made by the process so far.
+ *
+ * Count is maintained by the replacement global operator new, which is part of
+ * every benchmark binary.
+ *
+ * @return Number of allocations.
+ */
+size_t getAllocationCount() noexcept;
+} // namespace bench
+} // namespace vpd
@@ -0,0 +1,442 @@
+#include "config.h"
+
+#include "collection_tracer.hpp"
+#include "config_manager.hpp"
+#include "constants.hpp"
+#include "fake_pim.hpp"
+#include "private_bus.hpp"
+#include "synthetic_vpd.hpp"
+#include "thread_manager.hpp"
+#include "utility/common_utility.hpp"
+#include "utility/dbus_utility.hpp"
+
+#include <sys/resource.h>
+
+#include <nlohmann/json.hpp>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class standing in for Manager, to initialize ConfigManager.
+ */
+class ConfigManagerTestAccess
+{
+  public:
+    static std::shared_ptr<ConfigManager> initialize(
+        const std::string& i_sysConfigJsonPath)
+    {
+        return ConfigManager::initialize(ConfigManager::ManagerPassKey{},
+                                         i_sysConfigJsonPath);
+    }
+};
+
+namespace bench
+{
+/**
+ * @brief Class to run VPD collection of a synthetic system end to end.
+ *
+ * Generates the system, brings up a private bus with a fake PIM on it and runs
+ * ThreadManager::collectAllFruVpd() the way vpd-manager does. Reports total
+ * collection time, per FRU latency percentiles, peak RSS and number of D-Bus
+ * messages.
+ */
+class CollectionLoadTest
+{
+  public:
+    /**
+     * @brief Structure of load test options.
+     */
+    struct Options
+    {
+        // Synthetic system to collect.
+        SyntheticSystemConfig m_system;
+
+        // Path of JSON report, not written if empty.
+        std::string m_reportPath;
+    };
+
+    // Deleted APIs
+    CollectionLoadTest() = delete;
+    CollectionLoadTest(const CollectionLoadTest&) = delete;
+    CollectionLoadTest& operator=(const CollectionLoadTest&) = delete;
+    CollectionLoadTest(CollectionLoadTest&&) = delete;
+    CollectionLoadTest& operator=(CollectionLoadTest&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_options - Load test options.
+     */
+    explicit CollectionLoadTest(const Options& i_options) : m_options(i_options)
+    {}
+
+    /**
+     * @brief API to run the load test and print its report.
+     *
+     * @return true if collection completed, false otherwise.
+     *
+     * @throw std::runtime_error, sdbusplus::exception::SdBusError,
+     * JsonException
+     */
+    bool run();
+
+  private:
+    /**
+     * @brief API to host progress interface of vpd-manager.
+     *
+     * Status setter stops the trace session and wakes up run() once
+     * collection ends.
+     */
+    void createProgressInterface();
+
+    /**
+     * @brief API to print the report and write it as JSON if requested.
+     *
+     * @param[in] i_totalTime - Time taken by collection.
+     * @param[in] i_status - Final collection status.
+     */
+    void report(const std::chrono::nanoseconds i_totalTime,
+                const std::string& i_status) const;
+
+    // Load test options.
+    Options m_options;
+
+    // Private bus, everything below talks over it.
+    std::unique_ptr<PrivateBus> m_privateBus;
+
+    // Stand-in for PIM.
+    std::unique_ptr<FakePim> m_fakePim;
+
+    // Event loop of the vpd-manager connection. Not run, nothing is served.
+    boost::asio::io_context m_ioContext;
+
+    // Connection hosting progress interface.
+    std::shared_ptr<sdbusplus::asio::connection> m_connection;
+
+    // Object server hosting progress interface.
+    std::unique_ptr<sdbusplus::asio::object_server> m_objectServer;
+
+    // Progress interface, as hosted by vpd-manager.
+    std::shared_ptr<sdbusplus::asio::dbus_interface> m_progressInterface;
+
+    // Config of the synthetic system.
+    std::shared_ptr<ConfigManager> m_configManager;
+
+    // Thread manager under test. Its collection thread is detached, hence the
+    // load test is not destroyed once collection starts.
+    std::unique_ptr<ThreadManager> m_threadManager;
+
+    // Guards m_status.
+    mutable std::mutex m_mutex;
+
+    // Notified on change of m_status.
+    std::condition_variable m_statusCv;
+
+    // Collection status.
+    std::string m_status{constants::vpdCollectionNotStarted};
+};
+
+namespace
+{
+/**
+ * @brief API to get a percentile of durations, by nearest rank.
+ *
+ * @param[in] i_sortedDurations - Durations in nanoseconds, sorted.
+ * @param[in] i_percentile - Percentile, in (0, 100].
+ *
+ * @return Percentile in milliseconds, 0 if there are no durations.
+ */
+double getPercentileMs(const std::vector<int64_t>& i_sortedDurations,
+                       const double i_percentile)
+{
+    if (i_sortedDurations.empty())
+    {
+        return 0.0;
+    }
+
+    const auto l_rank = static_cast<size_t>(std::ceil(
+        i_percentile / 100.0 * static_cast<double>(i_sortedDurations.size())));
+    const size_t l_index =
+        std::clamp<size_t>(l_rank, 1, i_sortedDurations.size()) - 1;
+
+    return static_cast<double>(i_sortedDurations[l_index]) / 1e6;
+}
+} // namespace
+
+void CollectionLoadTest::createProgressInterface()
+{
+    m_connection = std::make_shared<sdbusplus::asio::connection>(m_ioContext);
+    m_objectServer =
+        std::make_unique<sdbusplus::asio::object_server>(m_connection);
+
+    m_progressInterface = m_objectServer->add_interface(
+        OBJPATH, constants::vpdCollectionInterface);
+
+    m_progressInterface->register_property_rw<std::string>(
+        "Status", sdbusplus::vtable::property_::emits_change,
+        [this](const std::string& i_status, const auto&) {
+            if (i_status == constants::vpdCollectionCompleted ||
+                i_status == constants::vpdCollectionFailed)
+            {
+                // Before ThreadManager sees the session, so it skips the dump.
+                CollectionTracer::getTracerInstance()->stopSession();
+            }
+
+            {
+                std::lock_guard<std::mutex> l_lock(m_mutex);
+                m_status = i_status;
+            }
+            m_statusCv.notify_all();
+            return true;
+        },
+        [this](const auto&) {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            return m_status;
+        });
+
+    m_progressInterface->initialize();
+}
+
+bool CollectionLoadTest::run()
+{
+    uint16_t l_errCode = 0;
+    const auto l_configJsonPath =
+        generateSyntheticSystem(m_options.m_system, l_errCode);
+    if (l_errCode)
+    {
+        std::cerr << "Failed to generate synthetic system, error: "
+                  << commonUtility::getErrCodeMsg(l_errCode) << std::endl;
+        return false;
+    }
+
+    m_privateBus = std::make_unique<PrivateBus>(
+        m_options.m_system.m_outputDirectory / "bus");
+    m_fakePim = std::make_unique<FakePim>();
+
+    m_configManager = ConfigManagerTestAccess::initialize(l_configJsonPath);
+    createProgressInterface();
+
+    // Session is driven from here, so that ThreadManager neither starts one
+    // nor dumps it once collection ends.
+    const auto& l_tracer = CollectionTracer::getTracerInstance();
+    l_tracer->setRequested(false);
+    l_tracer->startSession();
+
+    m_threadManager =
+        std::make_unique<ThreadManager>(m_configManager, m_progressInterface);
+
+    const auto l_startTime = std::chrono::steady_clock::now();
+    m_threadManager->collectAllFruVpd();
+
+    std::string l_status;
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_statusCv.wait_for(
+            l_lock, std::chrono::seconds(constants::VPD_COLLECTION_TIMEOUT_SEC),
+            [this]() {
+                return m_status == constants::vpdCollectionCompleted ||
+                       m_status == constants::vpdCollectionFailed;
+            });
+        l_status = m_status;
+    }
+    const auto l_totalTime = std::chrono::steady_clock::now() - l_startTime;
+
+    // In case collection timed out.
+    l_tracer->stopSession();
+
+    report(l_totalTime, l_status);
+    return l_status == constants::vpdCollectionCompleted;
+}
+
+void CollectionLoadTest::report(const std::chrono::nanoseconds i_totalTime,
+                                const std::string& i_status) const
+{
+    // Chassis tasks collect motherboards, FRU tasks the rest. Both go
+    // through Worker::collectFruVpd().
+    auto l_durations =
+        CollectionTracer::getTracerInstance()->getSpanDurations(
+            "collectFruVpd");
+    std::sort(l_durations.begin(), l_durations.end());
+
+    rusage l_usage{};
+    getrusage(RUSAGE_SELF, &l_usage);
+
+    const size_t l_fruCount = m_options.m_system.m_chassisCount *
+                              (m_options.m_system.m_frusPerChassis + 1);
+    const double l_totalTimeMs =
+        std::chrono::duration<double, std::milli>(i_totalTime).count();
+
+    const nlohmann::json l_report{
+        {"status", i_status},
+        {"chassis", m_options.m_system.m_chassisCount},
+        {"frus", l_fruCount},
+        {"i2cBuses", m_options.m_system.m_i2cBusCount},
+        {"totalTimeMs", l_totalTimeMs},
+        {"fruSamples", l_durations.size()},
+        {"fruLatencyMs",
+         {{"p50", getPercentileMs(l_durations, 50)},
+          {"p90", getPercentileMs(l_durations, 90)},
+          {"p99", getPercentileMs(l_durations, 99)},
+          {"max", getPercentileMs(l_durations, 100)}}},
+        {"peakRssKiB", l_usage.ru_maxrss},
+        {"dbusMessages", m_privateBus->getMessageCount()},
+        {"pimNotifyCalls", m_fakePim->getNotifyCount()},
+        {"pimObjects", m_fakePim->getObjectCount()}};
+
+    std::cout << std::format(
+        "Collection status: {}\n"
+        "FRUs: {} over {} chassis and {} I2C buses, {} timed\n"
+        "Total time: {:.1f} ms\n"
+        "FRU latency: p50 {:.2f} ms, p90 {:.2f} ms, p99 {:.2f} ms, "
+        "max {:.2f} ms\n"
+        "Peak RSS: {} KiB\n"
+        "D-Bus messages: {}, PIM Notify calls: {}, PIM objects: {}\n",
+        i_status, l_fruCount, m_options.m_system.m_chassisCount,
+        m_options.m_system.m_i2cBusCount, l_durations.size(), l_totalTimeMs,
+        l_report["fruLatencyMs"]["p50"].get<double>(),
+        l_report["fruLatencyMs"]["p90"].get<double>(),
+        l_report["fruLatencyMs"]["p99"].get<double>(),
+        l_report["fruLatencyMs"]["max"].get<double>(), l_usage.ru_maxrss,
+        m_privateBus->getMessageCount(), m_fakePim->getNotifyCount(),
+        m_fakePim->getObjectCount());
+    std::cout << dbusUtility::getPimPublishStatsString() << std::endl;
+
+    if (!m_options.m_reportPath.empty())
+    {
+        std::ofstream l_reportFile(m_options.m_reportPath, std::ios::trunc);
+        l_reportFile << l_report.dump(4) << std::endl;
+        if (!l_reportFile)
+        {
+            std::cerr << "Failed to write report " << m_options.m_reportPath
+                      << std::endl;
+        }
+    }
+}
+} // namespace bench
+} // namespace vpd
+
+namespace
+{
+/**
+ * @brief API to parse a count option of the form --name=value.
+ *
+ * @param[in] i_arg - Argument.
+ * @param[in] i_name - Option name, with leading dashes and trailing '='.
+ * @param[out] o_count - Parsed count, untouched if the option doesn't match.
+ *
+ * @return true if the option matches and its value is a positive count,
+ * false otherwise.
+ */
+bool parseCount(std::string_view i_arg, std::string_view i_name,
+                size_t& o_count)
+{
+    if (!i_arg.starts_with(i_name))
+    {
+        return false;
+    }
+
+    const std::string_view l_value = i_arg.substr(i_name.size());
+    size_t l_count = 0;
+    const auto [l_ptr, l_ec] = std::from_chars(
+        l_value.data(), l_value.data() + l_value.size(), l_count);
+
+    if (l_ec != std::errc() || l_ptr != l_value.data() + l_value.size() ||
+        l_count == 0)
+    {
+        return false;
+    }
+
+    o_count = l_count;
+    return true;
+}
+} // namespace
+
+/**
+ * @brief Main function of VPD collection load test.
+ *
+ * Collection threads and readers per I2C bus are taken from
+ * VPD_COLLECTION_THREADS and VPD_MAX_READERS_PER_I2C_BUS, as in vpd-manager.
+ */
+int main(int argc, char** argv)
+{
+    vpd::bench::CollectionLoadTest::Options l_options;
+    l_options.m_system.m_outputDirectory =
+        std::filesystem::temp_directory_path() / "vpd-collection-load-test";
+    l_options.m_system.m_chassisCount = 4;
+    l_options.m_system.m_frusPerChassis = 500;
+
+    for (int l_index = 1; l_index < argc; ++l_index)
+    {
+        const std::string_view l_arg(argv[l_index]);
+
+        if (parseCount(l_arg, "--chassis=",
+                       l_options.m_system.m_chassisCount) ||
+            parseCount(l_arg, "--frus-per-chassis=",
+                       l_options.m_system.m_frusPerChassis) ||
+            parseCount(l_arg, "--i2c-buses=",
+                       l_options.m_system.m_i2cBusCount))
+        {
+            continue;
+        }
+
+        if (l_arg.starts_with("--dir="))
+        {
+            l_options.m_system.m_outputDirectory = l_arg.substr(6);
+        }
+        else if (l_arg.starts_with("--ddimm-image="))
+        {
+            l_options.m_system.m_ddimmImagePath = l_arg.substr(14);
+        }
+        else if (l_arg.starts_with("--report="))
+        {
+            l_options.m_reportPath = l_arg.substr(9);
+        }
+        else
+        {
+            std::cerr
+                << "Usage: " << argv[0]
+                << " [--chassis=N] [--frus-per-chassis=N] [--i2c-buses=N]"
+                   " [--dir=PATH] [--ddimm-image=PATH] [--report=PATH]"
+                << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::unique_ptr<vpd::bench::CollectionLoadTest> l_loadTest;
+    bool l_isCompleted = false;
+    try
+    {
+        l_loadTest =
+            std::make_unique<vpd::bench::CollectionLoadTest>(l_options);
+        l_isCompleted = l_loadTest->run();
+    }
+    catch (const std::exception& l_ex)
+    {
+        std::cerr << "Collection load test failed, error: " << l_ex.what()
+                  << std::endl;
+    }
+
+    // Collection thread of ThreadManager is detached and may still be logging
+    // statistics, hence the process ends without running destructors.
+    // dbus-daemon goes down with the process.
+    std::cout.flush();
+    std::quick_exit(l_isCompleted ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,190 @@
+#include "alloc_counter.hpp"
+#include "types.hpp"
+
+#include <malloc.h>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr auto configJsonFile = "../configuration/ibm/50001000.json";
+
+/**
+ * @brief API to get heap memory in use by the process.
+ *
+ * Used instead of RSS, as freed heap is kept by the allocator and RSS doesn't
+ * drop between iterations.
+ *
+ * @return Heap in use in KiB.
+ */
+size_t getHeapInUseKib()
+{
+    return mallinfo2().uordblks / 1024;
+}
+
+/**
+ * @brief Fixture to load the system config JSON once for all iterations.
+ *
+ * Config is held the way ConfigManager holds it, i.e. an immutable object
+ * behind a shared pointer.
+ */
+class ConfigSnapshotFixture : public ::benchmark::Fixture
+{
+  public:
+    void SetUp(::benchmark::State& io_state) override
+    {
+        std::ifstream l_jsonFile(configJsonFile);
+        if (!l_jsonFile)
+        {
+            io_state.SkipWithError("Failed to open config JSON");
+            return;
+        }
+
+        m_config = std::make_shared<const nlohmann::json>(
+            nlohmann::json::parse(l_jsonFile, nullptr, false));
+        if (m_config->is_discarded() || !m_config->contains("frus"))
+        {
+            io_state.SkipWithError("Failed to parse config JSON");
+        }
+    }
+
+    void TearDown(::benchmark::State&) override
+    {
+        m_config.reset();
+    }
+
+  protected:
+    /**
+     * @brief API to publish per iteration allocation count and peak heap.
+     *
+     * @param[in,out] io_state - Benchmark state.
+     * @param[in] i_allocationCount - Allocations made across all iterations.
+     * @param[in] i_peakHeapKib - Highest heap growth seen by an iteration.
+     */
+    void setCounters(::benchmark::State& io_state, size_t i_allocationCount,
+                     size_t i_peakHeapKib) const
+    {
+        io_state.counters["allocs_per_op"] = ::benchmark::Counter(
+            static_cast<double>(i_allocationCount),
+            ::benchmark::Counter::kAvgIterations);
+        io_state.counters["peak_heap_growth_kib"] =
+            static_cast<double>(i_peakHeapKib);
+    }
+
+    std::shared_ptr<const nlohmann::json> m_config;
+};
+
+/**
+ * @brief Collection context as held by a FRU task, before snapshots.
+ */
+struct CopiedFruContext
+{
+    std::string m_eepromPath;
+    nlohmann::json m_configJson;
+};
+
+/**
+ * @brief Collection context as held by a FRU task, with snapshots.
+ */
+struct BorrowedFruContext
+{
+    std::string m_eepromPath;
+    vpd::types::JsonSnapshot m_configJson;
+};
+
+BENCHMARK_F(ConfigSnapshotFixture, CollectionCopy)(::benchmark::State& io_state)
+{
+    const size_t l_baseHeapKib = getHeapInUseKib();
+    size_t l_peakHeapKib = 0;
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        // Every in flight FRU task holds its own copy of the config.
+        std::vector<CopiedFruContext> l_contexts;
+        for (const auto& l_fru : m_config->at("frus").items())
+        {
+            l_contexts.emplace_back(
+                CopiedFruContext{l_fru.key(), nlohmann::json(*m_config)});
+        }
+        ::benchmark::DoNotOptimize(l_contexts);
+
+        const size_t l_heapKib = getHeapInUseKib();
+        if (l_heapKib > l_baseHeapKib)
+        {
+            l_peakHeapKib = std::max(l_peakHeapKib, l_heapKib - l_baseHeapKib);
+        }
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount,
+                l_peakHeapKib);
+}
+
+BENCHMARK_F(ConfigSnapshotFixture, CollectionSnapshot)
+(::benchmark::State& io_state)
+{
+    const size_t l_baseHeapKib = getHeapInUseKib();
+    size_t l_peakHeapKib = 0;
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        // Every in flight FRU task borrows the same config.
+        std::vector<BorrowedFruContext> l_contexts;
+        for (const auto& l_fru : m_config->at("frus").items())
+        {
+            l_contexts.emplace_back(BorrowedFruContext{
+                l_fru.key(), vpd::types::JsonSnapshot(m_config, &*m_config)});
+        }
+        ::benchmark::DoNotOptimize(l_contexts);
+
+        const size_t l_heapKib = getHeapInUseKib();
+        if (l_heapKib > l_baseHeapKib)
+        {
+            l_peakHeapKib = std::max(l_peakHeapKib, l_heapKib - l_baseHeapKib);
+        }
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount,
+                l_peakHeapKib);
+}
+
+BENCHMARK_F(ConfigSnapshotFixture, KeywordWriteCopy)
+(::benchmark::State& io_state)
+{
+    const std::string l_eepromPath = m_config->at("frus").begin().key();
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        // Keyword write used to take a copy of the config per call.
+        const nlohmann::json l_configJson = *m_config;
+        const auto& l_fruJson = l_configJson.at("frus").at(l_eepromPath);
+        ::benchmark::DoNotOptimize(l_fruJson);
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount, 0);
+}
+
+BENCHMARK_F(ConfigSnapshotFixture, KeywordWriteSnapshot)
+(::benchmark::State& io_state)
+{
+    const std::string l_eepromPath = m_config->at("frus").begin().key();
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        const vpd::types::JsonSnapshot l_configSnapshot(m_config, &*m_config);
+        const nlohmann::json& l_configJson = *l_configSnapshot;
+        const auto& l_fruJson = l_configJson.at("frus").at(l_eepromPath);
+        ::benchmark::DoNotOptimize(l_fruJson);
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount, 0);
+}
+} // namespace
+
+BENCHMARK_MAIN();
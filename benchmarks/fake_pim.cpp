@@ -0,0 +1,80 @@
+#include "fake_pim.hpp"
+
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+namespace vpd
+{
+namespace bench
+{
+namespace
+{
+/**
+ * @brief API to open a connection of its own to the default bus.
+ *
+ * Connection made on the default bus object of the thread would be shared
+ * with other connections made by the thread.
+ *
+ * @param[in] i_ioContext - Event loop of the connection.
+ *
+ * @return Connection.
+ *
+ * @throw std::runtime_error
+ */
+std::shared_ptr<sdbusplus::asio::connection> openConnection(
+    boost::asio::io_context& i_ioContext)
+{
+    sd_bus* l_bus = nullptr;
+    if (const int l_rc = sd_bus_open(&l_bus); l_rc < 0)
+    {
+        throw std::runtime_error(std::format(
+            "Failed to open bus connection, error: {}", std::strerror(-l_rc)));
+    }
+
+    // Connection takes its own reference.
+    auto l_connection =
+        std::make_shared<sdbusplus::asio::connection>(i_ioContext, l_bus);
+    sd_bus_unref(l_bus);
+    return l_connection;
+}
+} // namespace
+
+FakePim::FakePim() :
+    m_workGuard(boost::asio::make_work_guard(m_ioContext)),
+    m_connection(openConnection(m_ioContext)),
+    m_objectServer(
+        std::make_unique<sdbusplus::asio::object_server>(m_connection))
+{
+    m_pimInterface =
+        m_objectServer->add_interface(constants::pimPath, constants::pimIntf);
+
+    m_pimInterface->register_method(
+        "Notify", [this](const types::ObjectMap& i_objectMap) {
+            m_notifyCount.fetch_add(1, std::memory_order_relaxed);
+            m_objectCount.fetch_add(i_objectMap.size(),
+                                    std::memory_order_relaxed);
+        });
+    m_pimInterface->initialize();
+
+    m_connection->request_name(constants::pimServiceName);
+
+    m_ioThread = std::thread([this]() { m_ioContext.run(); });
+}
+
+FakePim::~FakePim()
+{
+    m_workGuard.reset();
+    m_ioContext.stop();
+    if (m_ioThread.joinable())
+    {
+        m_ioThread.join();
+    }
+}
+} // namespace bench
+} // namespace vpd
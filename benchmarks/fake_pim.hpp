@@ -0,0 +1,92 @@
+#pragma once
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace vpd
+{
+namespace bench
+{
+/**
+ * @brief Class standing in for Phosphor Inventory Manager.
+ *
+ * Owns the PIM service name on the default bus and serves Notify by counting
+ * calls and objects, without keeping the inventory. Requests are served on a
+ * thread of its own, the way a separate service would serve them.
+ */
+class FakePim
+{
+  public:
+    // Deleted APIs
+    FakePim(const FakePim&) = delete;
+    FakePim& operator=(const FakePim&) = delete;
+    FakePim(FakePim&&) = delete;
+    FakePim& operator=(FakePim&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @throw std::runtime_error, sdbusplus::exception::SdBusError
+     */
+    FakePim();
+
+    /**
+     * @brief Destructor.
+     */
+    ~FakePim();
+
+    /**
+     * @brief API to get number of Notify calls served.
+     *
+     * @return Notify call count.
+     */
+    uint64_t getNotifyCount() const noexcept
+    {
+        return m_notifyCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to get number of objects received across Notify calls.
+     *
+     * @return Object count.
+     */
+    uint64_t getObjectCount() const noexcept
+    {
+        return m_objectCount.load(std::memory_order_relaxed);
+    }
+
+  private:
+    // Event loop serving requests.
+    boost::asio::io_context m_ioContext;
+
+    // Keeps the event loop running while idle.
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        m_workGuard;
+
+    // Connection owning the PIM service name.
+    std::shared_ptr<sdbusplus::asio::connection> m_connection;
+
+    // Object server hosting the PIM interface.
+    std::unique_ptr<sdbusplus::asio::object_server> m_objectServer;
+
+    // PIM interface.
+    std::shared_ptr<sdbusplus::asio::dbus_interface> m_pimInterface;
+
+    // Number of Notify calls served.
+    std::atomic<uint64_t> m_notifyCount{0};
+
+    // Number of objects received across Notify calls.
+    std::atomic<uint64_t> m_objectCount{0};
+
+    // Thread running the event loop.
+    std::thread m_ioThread;
+};
+} // namespace bench
+} // namespace vpd
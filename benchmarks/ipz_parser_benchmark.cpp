@@ -0,0 +1,137 @@
+#include "alloc_counter.hpp"
+#include "ipz_parser.hpp"
+#include "ipz_vpd_view.hpp"
+#include "vpd_image.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace
+{
+constexpr auto ipzVpdFile = "vpd_files/ipz_system.dat";
+
+/**
+ * @brief Fixture to load the IPZ VPD image once for all iterations.
+ */
+class IpzParserFixture : public ::benchmark::Fixture
+{
+  public:
+    void SetUp(::benchmark::State& io_state) override
+    {
+        uint16_t l_errCode = 0;
+        m_vpdImage.load(m_vpdFilePath, 0, l_errCode);
+        if (l_errCode || m_vpdImage.getView().empty())
+        {
+            io_state.SkipWithError("Failed to load IPZ VPD image");
+        }
+    }
+
+  protected:
+    /**
+     * @brief API to publish per iteration allocation count and throughput.
+     *
+     * @param[in,out] io_state - Benchmark state.
+     * @param[in] i_allocationCount - Allocations made across all iterations.
+     */
+    void setCounters(::benchmark::State& io_state,
+                     size_t i_allocationCount) const
+    {
+        io_state.SetBytesProcessed(
+            static_cast<int64_t>(io_state.iterations()) *
+            static_cast<int64_t>(m_vpdImage.getView().size()));
+        io_state.counters["allocs_per_op"] = ::benchmark::Counter(
+            static_cast<double>(i_allocationCount),
+            ::benchmark::Counter::kAvgIterations);
+    }
+
+    const std::string m_vpdFilePath{ipzVpdFile};
+    vpd::VpdImage m_vpdImage;
+};
+
+BENCHMARK_F(IpzParserFixture, ParseToMap)(::benchmark::State& io_state)
+{
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::IpzVpdParser l_parser(m_vpdImage.getView(), m_vpdFilePath);
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount);
+}
+
+BENCHMARK_F(IpzParserFixture, ParseToView)(::benchmark::State& io_state)
+{
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::IpzVpdParser l_parser(m_vpdImage.getView(), m_vpdFilePath);
+        auto l_ipzView = l_parser.parseToView();
+        ::benchmark::DoNotOptimize(l_ipzView);
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount);
+}
+
+BENCHMARK_F(IpzParserFixture, ParseToViewAndConvert)
+(::benchmark::State& io_state)
+{
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::IpzVpdParser l_parser(m_vpdImage.getView(), m_vpdFilePath);
+        auto l_ipzVpdMap = l_parser.parseToView().toIpzVpdMap();
+        ::benchmark::DoNotOptimize(l_ipzVpdMap);
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount);
+}
+
+BENCHMARK_F(IpzParserFixture, LazyKeywordRead)(::benchmark::State& io_state)
+{
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::IpzVpdParser l_parser(m_vpdImage.getView(), m_vpdFilePath);
+        auto l_value = l_parser.getKeywordValue("VINI", "SN");
+        ::benchmark::DoNotOptimize(l_value);
+    }
+    setCounters(io_state, vpd::bench::getAllocationCount() - l_startCount);
+}
+
+BENCHMARK_F(IpzParserFixture, MapLookup)(::benchmark::State& io_state)
+{
+    vpd::IpzVpdParser l_parser(m_vpdImage.getView(), m_vpdFilePath);
+    const auto l_parsedVpd = l_parser.parse();
+    const auto& l_ipzVpdMap = std::get<vpd::types::IPZVpdMap>(l_parsedVpd);
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        // Callers typically hold names as string_view or literals.
+        const auto l_recordItr = l_ipzVpdMap.find(std::string("VINI"));
+        const auto l_keywordItr = l_recordItr->second.find(std::string("SN"));
+        ::benchmark::DoNotOptimize(l_keywordItr);
+    }
+    io_state.counters["allocs_per_op"] = ::benchmark::Counter(
+        static_cast<double>(vpd::bench::getAllocationCount() - l_startCount),
+        ::benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_F(IpzParserFixture, ViewLookup)(::benchmark::State& io_state)
+{
+    vpd::IpzVpdParser l_parser(m_vpdImage.getView(), m_vpdFilePath);
+    const auto l_ipzView = l_parser.parseToView();
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        auto l_value = l_ipzView.getKeywordValue("VINI", "SN");
+        ::benchmark::DoNotOptimize(l_value);
+    }
+    io_state.counters["allocs_per_op"] = ::benchmark::Counter(
+        static_cast<double>(vpd::bench::getAllocationCount() - l_startCount),
+        ::benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,228 @@
+#include "log_ring_buffer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <iomanip>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Messages logged by every producer thread per iteration.
+constexpr size_t messagesPerProducer = 10000;
+
+// A typical collection log message.
+constexpr auto logMessage =
+    "FileName: /usr/src/vpd-manager/src/worker.cpp, Line: 1234 VPD collection "
+    "started for FRU /sys/bus/i2c/drivers/at24/8-0050/eeprom";
+
+/**
+ * @brief API to format a timestamp the way AsyncFileLogger does.
+ *
+ * @param[in] i_time - Time point.
+ *
+ * @return Timestamp string.
+ */
+std::string getTimestamp(const std::chrono::system_clock::time_point& i_time)
+{
+    const auto l_timeT = std::chrono::system_clock::to_time_t(i_time);
+    const auto l_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          i_time.time_since_epoch()) %
+                      1000;
+
+    std::tm l_localTime{};
+    localtime_r(&l_timeT, &l_localTime);
+
+    std::stringstream l_ss;
+    l_ss << std::put_time(&l_localTime, "%Y-%m-%d %H:%M:%S") << "."
+         << std::setfill('0') << std::setw(3) << l_ms.count();
+    return l_ss.str();
+}
+
+/**
+ * @brief Message queue as used by AsyncFileLogger before the ring buffer.
+ *
+ * Producers format the entry and push it under a mutex, worker pops one
+ * entry at a time.
+ */
+class MutexQueue
+{
+  public:
+    void push(std::string_view i_message)
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_messageQueue.emplace(getTimestamp(std::chrono::system_clock::now()) +
+                               " : " + std::string(i_message));
+        m_cv.notify_one();
+    }
+
+    void consume(const size_t i_messageCount)
+    {
+        size_t l_consumedCount = 0;
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        while (l_consumedCount < i_messageCount)
+        {
+            m_cv.wait(l_lock, [this] { return !m_messageQueue.empty(); });
+            while (!m_messageQueue.empty())
+            {
+                const auto l_logMessage = m_messageQueue.front();
+                m_messageQueue.pop();
+
+                l_lock.unlock();
+                ::benchmark::DoNotOptimize(l_logMessage.data());
+                ++l_consumedCount;
+                l_lock.lock();
+            }
+        }
+    }
+
+  private:
+    std::queue<std::string> m_messageQueue;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+/**
+ * @brief API to run producers and a consumer for an iteration.
+ *
+ * @param[in] i_producerCount - Number of producer threads.
+ * @param[in] i_produce - Producer body, called once per message.
+ * @param[in] i_consume - Consumer body, returns when all messages are read.
+ */
+template <typename Produce, typename Consume>
+void runIteration(const size_t i_producerCount, Produce&& i_produce,
+                  Consume&& i_consume)
+{
+    std::thread l_consumer(i_consume);
+
+    std::vector<std::thread> l_producers;
+    for (size_t l_producer = 0; l_producer < i_producerCount; ++l_producer)
+    {
+        l_producers.emplace_back([&i_produce]() {
+            for (size_t l_index = 0; l_index < messagesPerProducer; ++l_index)
+            {
+                i_produce();
+            }
+        });
+    }
+
+    for (auto& l_producer : l_producers)
+    {
+        l_producer.join();
+    }
+    l_consumer.join();
+}
+
+void BM_MutexQueue(::benchmark::State& io_state)
+{
+    const auto l_producerCount = static_cast<size_t>(io_state.range(0));
+
+    for (auto _ : io_state)
+    {
+        MutexQueue l_queue;
+        runIteration(
+            l_producerCount, [&l_queue]() { l_queue.push(logMessage); },
+            [&l_queue, l_producerCount]() {
+                l_queue.consume(l_producerCount * messagesPerProducer);
+            });
+    }
+
+    io_state.SetItemsProcessed(static_cast<int64_t>(
+        io_state.iterations() * l_producerCount * messagesPerProducer));
+}
+
+void runRingBuffer(::benchmark::State& io_state,
+                   const vpd::LogOverflowPolicy i_overflowPolicy)
+{
+    const auto l_producerCount = static_cast<size_t>(io_state.range(0));
+    uint64_t l_droppedCount = 0;
+
+    for (auto _ : io_state)
+    {
+        vpd::LogRingBuffer l_ringBuffer(512, i_overflowPolicy);
+        std::atomic_bool l_isProducing{true};
+
+        std::thread l_consumer([&l_ringBuffer, &l_isProducing]() {
+            std::string l_message;
+            std::string l_batch;
+            std::chrono::system_clock::time_point l_time;
+            std::string l_timestamp;
+            std::chrono::milliseconds l_timestampMs{-1};
+
+            while (l_isProducing || !l_ringBuffer.isEmpty())
+            {
+                // Format the batch the way AsyncFileLogger worker does.
+                while (l_ringBuffer.pop(l_message, l_time))
+                {
+                    const auto l_ms =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            l_time.time_since_epoch());
+                    if (l_ms != l_timestampMs)
+                    {
+                        l_timestamp = getTimestamp(l_time);
+                        l_timestampMs = l_ms;
+                    }
+
+                    l_batch.append(l_timestamp)
+                        .append(" : ")
+                        .append(l_message)
+                        .push_back('\n');
+                }
+                if (l_batch.empty())
+                {
+                    // Let producers run, like the idle worker does.
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                ::benchmark::DoNotOptimize(l_batch.data());
+                l_batch.clear();
+            }
+        });
+
+        runIteration(
+            l_producerCount,
+            [&l_ringBuffer]() {
+                l_ringBuffer.push(logMessage, std::chrono::system_clock::now());
+            },
+            []() {});
+
+        l_isProducing = false;
+        l_consumer.join();
+        l_droppedCount += l_ringBuffer.getDroppedCount();
+    }
+
+    io_state.SetItemsProcessed(static_cast<int64_t>(
+        io_state.iterations() * l_producerCount * messagesPerProducer));
+    io_state.counters["dropped_per_op"] =
+        ::benchmark::Counter(static_cast<double>(l_droppedCount),
+                             ::benchmark::Counter::kAvgIterations);
+}
+
+void BM_RingBufferBlock(::benchmark::State& io_state)
+{
+    runRingBuffer(io_state, vpd::LogOverflowPolicy::BLOCK);
+}
+
+void BM_RingBufferDropOldest(::benchmark::State& io_state)
+{
+    runRingBuffer(io_state, vpd::LogOverflowPolicy::DROP_OLDEST);
+}
+
+BENCHMARK(BM_MutexQueue)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_RingBufferBlock)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_RingBufferDropOldest)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,427 @@
+#include "alloc_counter.hpp"
+#include "ddimm_parser.hpp"
+#include "ipz_parser.hpp"
+#include "isdimm_parser.hpp"
+#include "keyword_vpd_parser.hpp"
+#include "parser_factory.hpp"
+#include "synthetic_vpd.hpp"
+#include "vpd_image.hpp"
+
+#include "vpdecc/vpdecc.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Images of test/vpd_files, benchmarks run with test/ as working directory.
+constexpr std::array vpdFiles{
+    "vpd_files/ipz_system.dat", "vpd_files/keyword.dat",
+    "vpd_files/ddr4_ddimm.dat", "vpd_files/ddr5_ddimm.dat"};
+
+// Index of images in vpdFiles.
+constexpr size_t ipzFileIndex = 0;
+constexpr size_t keywordFileIndex = 1;
+constexpr size_t ddr4DdimmFileIndex = 2;
+constexpr size_t ddr5DdimmFileIndex = 3;
+
+/**
+ * @brief API to publish per iteration allocation count and throughput.
+ *
+ * @param[in,out] io_state - Benchmark state.
+ * @param[in] i_bytesPerOp - Bytes of VPD processed per iteration.
+ * @param[in] i_allocationCount - Allocations made across all iterations.
+ */
+void setCounters(::benchmark::State& io_state, const size_t i_bytesPerOp,
+                 const size_t i_allocationCount)
+{
+    io_state.SetBytesProcessed(static_cast<int64_t>(io_state.iterations()) *
+                               static_cast<int64_t>(i_bytesPerOp));
+    io_state.counters["allocs_per_op"] =
+        ::benchmark::Counter(static_cast<double>(i_allocationCount),
+                             ::benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * @brief API to load an image, marking the benchmark failed on error.
+ *
+ * @param[in,out] io_state - Benchmark state.
+ * @param[in] i_vpdFilePath - Path to the image.
+ * @param[out] o_vpdImage - Loaded image.
+ *
+ * @return true if loaded, false otherwise.
+ */
+bool loadImage(::benchmark::State& io_state, const std::string& i_vpdFilePath,
+               vpd::VpdImage& o_vpdImage)
+{
+    uint16_t l_errCode = 0;
+    o_vpdImage.load(i_vpdFilePath, 0, l_errCode);
+    if (l_errCode || o_vpdImage.getView().empty())
+    {
+        io_state.SkipWithError(("Failed to load " + i_vpdFilePath).c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief API to write an image to a temporary file.
+ *
+ * @param[in] i_vpdVector - Image.
+ * @param[in] i_fileName - File name in the temporary directory.
+ *
+ * @return Path to the file.
+ */
+std::string writeTempImage(const vpd::types::BinaryVector& i_vpdVector,
+                           const std::string& i_fileName)
+{
+    const auto l_filePath = std::filesystem::temp_directory_path() / i_fileName;
+    std::ofstream l_file(l_filePath, std::ios::binary | std::ios::trunc);
+    l_file.write(reinterpret_cast<const char*>(i_vpdVector.data()),
+                 static_cast<std::streamsize>(i_vpdVector.size()));
+    return l_filePath;
+}
+
+/**
+ * @brief API to copy a test image to a temporary file, for write benchmarks.
+ *
+ * @param[in] i_vpdFilePath - Path to the test image.
+ *
+ * @return Path to the copy.
+ */
+std::string copyToTempImage(const std::string& i_vpdFilePath)
+{
+    const auto l_filePath =
+        std::filesystem::temp_directory_path() /
+        ("parser_benchmark_" +
+         std::filesystem::path(i_vpdFilePath).filename().string());
+    std::filesystem::copy_file(
+        i_vpdFilePath, l_filePath,
+        std::filesystem::copy_options::overwrite_existing);
+    return l_filePath;
+}
+
+void BM_ParserFactory(::benchmark::State& io_state)
+{
+    const std::string l_vpdFilePath{
+        vpdFiles[static_cast<size_t>(io_state.range(0))]};
+    io_state.SetLabel(l_vpdFilePath);
+
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        auto l_parser = vpd::ParserFactory::getParser(l_vpdImage.getView(),
+                                                      l_vpdFilePath, 0);
+        ::benchmark::DoNotOptimize(l_parser);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_IpzParse(::benchmark::State& io_state)
+{
+    const std::string l_vpdFilePath{vpdFiles[ipzFileIndex]};
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::IpzVpdParser l_parser(l_vpdImage.getView(), l_vpdFilePath);
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_IpzParseScaled(::benchmark::State& io_state)
+{
+    const auto l_recordCount = static_cast<size_t>(io_state.range(0));
+    const auto l_vpdFilePath = writeTempImage(
+        vpd::bench::createIpzVpd(l_recordCount),
+        std::format("parser_benchmark_ipz_{}.dat", l_recordCount));
+
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::IpzVpdParser l_parser(l_vpdImage.getView(), l_vpdFilePath);
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+
+    std::error_code l_ec;
+    std::filesystem::remove(l_vpdFilePath, l_ec);
+}
+
+void BM_KeywordParse(::benchmark::State& io_state)
+{
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, vpdFiles[keywordFileIndex], l_vpdImage))
+    {
+        return;
+    }
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::KeywordVpdParser l_parser(l_vpdImage.getView());
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_KeywordParseScaled(::benchmark::State& io_state)
+{
+    const auto l_vpdVector =
+        vpd::bench::createKeywordVpd(static_cast<size_t>(io_state.range(0)));
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::KeywordVpdParser l_parser(l_vpdVector);
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, l_vpdVector.size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_DdimmParse(::benchmark::State& io_state)
+{
+    const std::string l_vpdFilePath{
+        vpdFiles[static_cast<size_t>(io_state.range(0))]};
+    io_state.SetLabel(l_vpdFilePath);
+
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::DdimmVpdParser l_parser(l_vpdImage.getView());
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_JedecSpdParse(::benchmark::State& io_state)
+{
+    const auto l_spdVector = vpd::bench::createJedecSpd();
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        vpd::JedecSpdParser l_parser(l_spdVector);
+        auto l_parsedVpd = l_parser.parse();
+        ::benchmark::DoNotOptimize(l_parsedVpd);
+    }
+    setCounters(io_state, l_spdVector.size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_EccCreate(::benchmark::State& io_state)
+{
+    const auto l_dataLength = static_cast<size_t>(io_state.range(0));
+    const vpd::types::BinaryVector l_data(l_dataLength, 0x5A);
+    vpd::types::BinaryVector l_ecc((l_dataLength + 3) / 4);
+
+    for (auto _ : io_state)
+    {
+        size_t l_eccLength = l_ecc.size();
+        auto l_status = vpdecc_create_ecc(l_data.data(), l_data.size(),
+                                          l_ecc.data(), &l_eccLength);
+        ::benchmark::DoNotOptimize(l_status);
+        ::benchmark::DoNotOptimize(l_ecc.data());
+    }
+    setCounters(io_state, l_dataLength, 0);
+}
+
+void BM_EccCheck(::benchmark::State& io_state)
+{
+    const auto l_dataLength = static_cast<size_t>(io_state.range(0));
+    vpd::types::BinaryVector l_data(l_dataLength, 0x5A);
+    vpd::types::BinaryVector l_ecc((l_dataLength + 3) / 4);
+
+    size_t l_eccLength = l_ecc.size();
+    vpdecc_create_ecc(l_data.data(), l_data.size(), l_ecc.data(),
+                      &l_eccLength);
+
+    for (auto _ : io_state)
+    {
+        auto l_status = vpdecc_check_data(l_data.data(), l_data.size(),
+                                          l_ecc.data(), l_ecc.size());
+        ::benchmark::DoNotOptimize(l_status);
+    }
+    setCounters(io_state, l_dataLength, 0);
+}
+
+void BM_IpzReadKeyword(::benchmark::State& io_state)
+{
+    const std::string l_vpdFilePath{vpdFiles[ipzFileIndex]};
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    vpd::IpzVpdParser l_parser(l_vpdImage.getView(), l_vpdFilePath);
+    const vpd::types::ReadVpdParams l_params{
+        vpd::types::IpzType{"VINI", "SN"}};
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        auto l_value = l_parser.readKeywordFromHardware(l_params);
+        ::benchmark::DoNotOptimize(l_value);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_KeywordReadKeyword(::benchmark::State& io_state)
+{
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, vpdFiles[keywordFileIndex], l_vpdImage))
+    {
+        return;
+    }
+
+    vpd::KeywordVpdParser l_parser(l_vpdImage.getView());
+    const vpd::types::ReadVpdParams l_params{vpd::types::Keyword{"SN"}};
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        auto l_value = l_parser.readKeywordFromHardware(l_params);
+        ::benchmark::DoNotOptimize(l_value);
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+}
+
+void BM_IpzWriteKeyword(::benchmark::State& io_state)
+{
+    const auto l_vpdFilePath = copyToTempImage(vpdFiles[ipzFileIndex]);
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    vpd::IpzVpdParser l_parser(l_vpdImage.getView(), l_vpdFilePath);
+
+    // Alternate the value, so that every write changes the keyword.
+    const std::array<vpd::types::BinaryVector, 2> l_values{
+        vpd::types::BinaryVector{'A', 'B', 'C'},
+        vpd::types::BinaryVector{'X', 'Y', 'Z'}};
+    size_t l_iteration = 0;
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        try
+        {
+            auto l_bytesWritten =
+                l_parser.writeKeywordOnHardware(vpd::types::IpzData{
+                    "VINI", "SN", l_values[l_iteration++ % 2]});
+            ::benchmark::DoNotOptimize(l_bytesWritten);
+        }
+        catch (const std::exception& l_ex)
+        {
+            io_state.SkipWithError(l_ex.what());
+            break;
+        }
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+
+    std::error_code l_ec;
+    std::filesystem::remove(l_vpdFilePath, l_ec);
+}
+
+void BM_KeywordWriteKeyword(::benchmark::State& io_state)
+{
+    const auto l_vpdFilePath = copyToTempImage(vpdFiles[keywordFileIndex]);
+    vpd::VpdImage l_vpdImage;
+    if (!loadImage(io_state, l_vpdFilePath, l_vpdImage))
+    {
+        return;
+    }
+
+    vpd::KeywordVpdParser l_parser(l_vpdImage.getView(), l_vpdFilePath);
+
+    // Alternate the value, so that every write changes the keyword.
+    const std::array<vpd::types::BinaryVector, 2> l_values{
+        vpd::types::BinaryVector{'A', 'B', 'C'},
+        vpd::types::BinaryVector{'X', 'Y', 'Z'}};
+    size_t l_iteration = 0;
+
+    const size_t l_startCount = vpd::bench::getAllocationCount();
+    for (auto _ : io_state)
+    {
+        try
+        {
+            auto l_bytesWritten = l_parser.writeKeywordOnHardware(
+                vpd::types::KwData{"SN", l_values[l_iteration++ % 2]});
+            ::benchmark::DoNotOptimize(l_bytesWritten);
+        }
+        catch (const std::exception& l_ex)
+        {
+            io_state.SkipWithError(l_ex.what());
+            break;
+        }
+    }
+    setCounters(io_state, l_vpdImage.getView().size(),
+                vpd::bench::getAllocationCount() - l_startCount);
+
+    std::error_code l_ec;
+    std::filesystem::remove(l_vpdFilePath, l_ec);
+}
+
+BENCHMARK(BM_ParserFactory)->DenseRange(0, vpdFiles.size() - 1);
+BENCHMARK(BM_IpzParse);
+BENCHMARK(BM_IpzParseScaled)->RangeMultiplier(2)->Range(1, 16);
+BENCHMARK(BM_KeywordParse);
+BENCHMARK(BM_KeywordParseScaled)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(BM_DdimmParse)->Arg(ddr4DdimmFileIndex)->Arg(ddr5DdimmFileIndex);
+BENCHMARK(BM_JedecSpdParse);
+BENCHMARK(BM_EccCreate)->RangeMultiplier(4)->Range(64, 16 << 10);
+BENCHMARK(BM_EccCheck)->RangeMultiplier(4)->Range(64, 16 << 10);
+BENCHMARK(BM_IpzReadKeyword);
+BENCHMARK(BM_KeywordReadKeyword);
+BENCHMARK(BM_IpzWriteKeyword)->UseRealTime();
+BENCHMARK(BM_KeywordWriteKeyword)->UseRealTime();
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,214 @@
+#include "private_bus.hpp"
+
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <systemd/sd-bus.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+namespace vpd
+{
+namespace bench
+{
+namespace
+{
+// Config of the private daemon, takes listen address.
+constexpr auto busConfigFormat =
+    R"(<!DOCTYPE busconfig PUBLIC "-//freedesktop//DTD D-Bus Bus Configuration 1.0//EN"
+ "http://www.freedesktop.org/standards/dbus/1.0/busconfig.dtd">
+<busconfig>
+  <type>session</type>
+  <listen>{}</listen>
+  <auth>EXTERNAL</auth>
+  <policy context="default">
+    <allow send_destination="*" eavesdrop="true"/>
+    <allow eavesdrop="true"/>
+    <allow own="*"/>
+  </policy>
+</busconfig>
+)";
+
+// Time given to the daemon to start listening.
+constexpr auto daemonStartTimeout = std::chrono::seconds(5);
+
+// Interval at which the monitor checks if it is stopped, in microseconds.
+constexpr uint64_t monitorPollIntervalUs = 100000;
+} // namespace
+
+PrivateBus::PrivateBus(const std::filesystem::path& i_directory)
+{
+    std::filesystem::create_directories(i_directory);
+
+    const auto l_socketPath = i_directory / "bus.sock";
+    std::filesystem::remove(l_socketPath);
+    m_address = "unix:path=" + l_socketPath.string();
+
+    const auto l_configFilePath = i_directory / "bus.conf";
+    {
+        std::ofstream l_configFile(l_configFilePath, std::ios::trunc);
+        l_configFile << std::format(busConfigFormat, m_address);
+        if (!l_configFile)
+        {
+            throw std::runtime_error("Failed to write bus config " +
+                                     l_configFilePath.string());
+        }
+    }
+
+    startDaemon(l_configFilePath);
+
+    const auto l_deadline =
+        std::chrono::steady_clock::now() + daemonStartTimeout;
+    while (!std::filesystem::exists(l_socketPath))
+    {
+        if (waitpid(m_daemonPid, nullptr, WNOHANG) == m_daemonPid)
+        {
+            m_daemonPid = -1;
+            throw std::runtime_error("dbus-daemon exited on start");
+        }
+
+        if (std::chrono::steady_clock::now() > l_deadline)
+        {
+            stopDaemon();
+            throw std::runtime_error("Timed out waiting for dbus-daemon");
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Monitor connection is set up the way busctl monitor does it.
+    sd_bus* l_bus = nullptr;
+    sd_bus_error l_error = SD_BUS_ERROR_NULL;
+
+    int l_rc = sd_bus_new(&l_bus);
+    if (l_rc >= 0)
+    {
+        l_rc = sd_bus_set_address(l_bus, m_address.c_str());
+    }
+    if (l_rc >= 0)
+    {
+        l_rc = sd_bus_set_monitor(l_bus, 1);
+    }
+    if (l_rc >= 0)
+    {
+        l_rc = sd_bus_set_bus_client(l_bus, 1);
+    }
+    if (l_rc >= 0)
+    {
+        l_rc = sd_bus_start(l_bus);
+    }
+    if (l_rc >= 0)
+    {
+        // No match rules, monitor gets every message.
+        l_rc = sd_bus_call_method(l_bus, "org.freedesktop.DBus",
+                                  "/org/freedesktop/DBus",
+                                  "org.freedesktop.DBus.Monitoring",
+                                  "BecomeMonitor", &l_error, nullptr, "asu",
+                                  0U, 0U);
+    }
+
+    if (l_rc < 0)
+    {
+        const std::string l_errMsg = std::format(
+            "Failed to monitor private bus, error: {}",
+            l_error.message ? l_error.message : std::strerror(-l_rc));
+        sd_bus_error_free(&l_error);
+        sd_bus_flush_close_unref(l_bus);
+        stopDaemon();
+        throw std::runtime_error(l_errMsg);
+    }
+    sd_bus_error_free(&l_error);
+
+    // Connections opened from here on, on any thread, go to the private bus.
+    setenv("DBUS_SYSTEM_BUS_ADDRESS", m_address.c_str(), 1);
+    setenv("DBUS_SESSION_BUS_ADDRESS", m_address.c_str(), 1);
+
+    m_monitorThread = std::thread([this, l_bus]() { monitor(l_bus); });
+}
+
+PrivateBus::~PrivateBus()
+{
+    m_isMonitoring.store(false, std::memory_order_relaxed);
+    if (m_monitorThread.joinable())
+    {
+        m_monitorThread.join();
+    }
+
+    stopDaemon();
+}
+
+void PrivateBus::startDaemon(const std::filesystem::path& i_configFilePath)
+{
+    std::string l_configArg = "--config-file=" + i_configFilePath.string();
+    std::string l_daemonName = "dbus-daemon";
+    std::string l_noForkArg = "--nofork";
+    std::string l_noPidFileArg = "--nopidfile";
+
+    std::array<char*, 5> l_argv{l_daemonName.data(), l_configArg.data(),
+                                l_noForkArg.data(), l_noPidFileArg.data(),
+                                nullptr};
+
+    m_daemonPid = fork();
+    if (m_daemonPid < 0)
+    {
+        throw std::runtime_error(std::format(
+            "Failed to fork dbus-daemon, error: {}", std::strerror(errno)));
+    }
+
+    if (m_daemonPid == 0)
+    {
+        // Daemon goes down with the process, however the process ends.
+        prctl(PR_SET_PDEATHSIG, SIGTERM);
+        execvp(l_argv[0], l_argv.data());
+        _exit(EXIT_FAILURE);
+    }
+}
+
+void PrivateBus::stopDaemon() noexcept
+{
+    if (m_daemonPid <= 0)
+    {
+        return;
+    }
+
+    kill(m_daemonPid, SIGTERM);
+    waitpid(m_daemonPid, nullptr, 0);
+    m_daemonPid = -1;
+}
+
+void PrivateBus::monitor(sd_bus* i_bus) noexcept
+{
+    while (m_isMonitoring.load(std::memory_order_relaxed))
+    {
+        sd_bus_message* l_message = nullptr;
+        const int l_rc = sd_bus_process(i_bus, &l_message);
+        if (l_rc < 0)
+        {
+            break;
+        }
+
+        if (l_message != nullptr)
+        {
+            m_messageCount.fetch_add(1, std::memory_order_relaxed);
+            sd_bus_message_unref(l_message);
+            continue;
+        }
+
+        if (l_rc == 0)
+        {
+            sd_bus_wait(i_bus, monitorPollIntervalUs);
+        }
+    }
+
+    sd_bus_flush_close_unref(i_bus);
+}
+} // namespace bench
+} // namespace vpd
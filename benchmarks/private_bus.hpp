@@ -0,0 +1,114 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+struct sd_bus;
+
+namespace vpd
+{
+namespace bench
+{
+/**
+ * @brief Class to run a private D-Bus daemon.
+ *
+ * Daemon listens on a socket in the given directory and allows everything, so
+ * that code under test can own names and reach stand-ins of other services
+ * without a system bus. Its address is exported as both system and session bus
+ * address, hence connections opened afterwards by the process land on it.
+ *
+ * A monitor connection counts messages routed by the daemon.
+ */
+class PrivateBus
+{
+  public:
+    // Deleted APIs
+    PrivateBus() = delete;
+    PrivateBus(const PrivateBus&) = delete;
+    PrivateBus& operator=(const PrivateBus&) = delete;
+    PrivateBus(PrivateBus&&) = delete;
+    PrivateBus& operator=(PrivateBus&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * Starts dbus-daemon and waits till it accepts connections.
+     *
+     * @param[in] i_directory - Directory for socket and daemon config.
+     *
+     * @throw std::runtime_error
+     */
+    explicit PrivateBus(const std::filesystem::path& i_directory);
+
+    /**
+     * @brief Destructor.
+     *
+     * Stops the monitor and the daemon.
+     */
+    ~PrivateBus();
+
+    /**
+     * @brief API to get address of the bus.
+     *
+     * @return Bus address.
+     */
+    const std::string& getAddress() const noexcept
+    {
+        return m_address;
+    }
+
+    /**
+     * @brief API to get number of messages routed by the daemon so far.
+     *
+     * @return Message count.
+     */
+    uint64_t getMessageCount() const noexcept
+    {
+        return m_messageCount.load(std::memory_order_relaxed);
+    }
+
+  private:
+    /**
+     * @brief API to start dbus-daemon.
+     *
+     * @param[in] i_configFilePath - Path of daemon config.
+     *
+     * @throw std::runtime_error
+     */
+    void startDaemon(const std::filesystem::path& i_configFilePath);
+
+    /**
+     * @brief API to stop dbus-daemon.
+     */
+    void stopDaemon() noexcept;
+
+    /**
+     * @brief API to count messages seen by the monitor till stopped.
+     *
+     * @param[in] i_bus - Connection made monitor by the constructor, owned
+     * and released by this API.
+     */
+    void monitor(sd_bus* i_bus) noexcept;
+
+    // Address of the bus.
+    std::string m_address;
+
+    // Process id of dbus-daemon.
+    pid_t m_daemonPid{-1};
+
+    // Number of messages seen by the monitor.
+    std::atomic<uint64_t> m_messageCount{0};
+
+    // Cleared to stop the monitor.
+    std::atomic_bool m_isMonitoring{true};
+
+    // Thread running the monitor.
+    std::thread m_monitorThread;
+};
+} // namespace bench
+} // namespace vpd
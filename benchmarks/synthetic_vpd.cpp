@@ -0,0 +1,387 @@
+#include "synthetic_vpd.hpp"
+
+#include "constants.hpp"
+#include "error_codes.hpp"
+
+#include "vpdecc/vpdecc.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace vpd
+{
+namespace bench
+{
+namespace
+{
+// IPZ layout, as walked by IpzVpdParser.
+constexpr size_t ipzVhdrOffset = 11;
+constexpr size_t ipzVhdrTocEntryOffset = 29;
+constexpr size_t ipzVtocPtDataOffset = 13;
+constexpr size_t ipzPtEntrySize = 14;
+constexpr size_t ipzKeywordNameSize = 2;
+constexpr size_t ipzRecordNameSize = 4;
+
+/**
+ * @brief API to get a keyword name unique for an index.
+ *
+ * Names never start with '#' or 'P', so that they parse as regular keywords
+ * and never end an IPZ record the way "PF" does.
+ *
+ * @param[in] i_index - Index, less than 35 * 36.
+ *
+ * @return Keyword name.
+ */
+std::string getKeywordName(const size_t i_index)
+{
+    constexpr std::string_view l_firstCharacters =
+        "ABCDEFGHIJKLMNOQRSTUVWXYZ0123456789";
+    constexpr std::string_view l_characters =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    return {l_firstCharacters[(i_index / l_characters.size()) %
+                              l_firstCharacters.size()],
+            l_characters[i_index % l_characters.size()]};
+}
+
+/**
+ * @brief API to append a 2 byte LE value.
+ *
+ * @param[in,out] io_vpdVector - VPD.
+ * @param[in] i_value - Value.
+ */
+void appendUInt16LE(types::BinaryVector& io_vpdVector, const size_t i_value)
+{
+    io_vpdVector.push_back(static_cast<uint8_t>(i_value & 0xFF));
+    io_vpdVector.push_back(static_cast<uint8_t>((i_value >> 8) & 0xFF));
+}
+
+/**
+ * @brief API to append an IPZ record.
+ *
+ * Record carries the RT keyword, the given keywords and a PF keyword.
+ *
+ * @param[in,out] io_vpdVector - VPD.
+ * @param[in] i_recordName - Record name.
+ * @param[in] i_keywords - Encoded keywords, without RT and PF.
+ * @param[in] i_padSize - Size of PF keyword's value.
+ *
+ * @return Offset and length of the record.
+ */
+std::pair<size_t, size_t> appendIpzRecord(
+    types::BinaryVector& io_vpdVector, std::string_view i_recordName,
+    const types::BinaryVector& i_keywords, const uint8_t i_padSize = 1)
+{
+    const size_t l_recordOffset = io_vpdVector.size();
+
+    // Length excludes start tag, length itself and end tag.
+    const size_t l_recordLength =
+        ipzKeywordNameSize + sizeof(types::KwSize) + ipzRecordNameSize +
+        i_keywords.size() + ipzKeywordNameSize + sizeof(types::KwSize) +
+        i_padSize;
+
+    io_vpdVector.push_back(constants::IPZ_DATA_START_TAG);
+    appendUInt16LE(io_vpdVector, l_recordLength);
+    io_vpdVector.insert(io_vpdVector.end(), {'R', 'T', ipzRecordNameSize});
+    io_vpdVector.insert(io_vpdVector.end(), i_recordName.begin(),
+                        i_recordName.end());
+    io_vpdVector.insert(io_vpdVector.end(), i_keywords.begin(),
+                        i_keywords.end());
+    io_vpdVector.insert(io_vpdVector.end(), {'P', 'F', i_padSize});
+    io_vpdVector.insert(io_vpdVector.end(), i_padSize, 0);
+    io_vpdVector.push_back(constants::IPZ_RECORD_END_TAG);
+
+    return {l_recordOffset, io_vpdVector.size() - l_recordOffset};
+}
+
+/**
+ * @brief API to write a PT entry of a record.
+ *
+ * @param[in,out] io_entry - Iterator to the entry, advanced past it.
+ * @param[in] i_recordName - Record name.
+ * @param[in] i_record - Offset and length of the record.
+ * @param[in] i_eccOffset - Offset of record's ECC.
+ */
+void writePtEntry(types::BinaryVector::iterator& io_entry,
+                  std::string_view i_recordName,
+                  const std::pair<size_t, size_t>& i_record,
+                  const size_t i_eccOffset)
+{
+    const auto l_write = [&io_entry](const size_t i_value) {
+        *io_entry++ = static_cast<uint8_t>(i_value & 0xFF);
+        *io_entry++ = static_cast<uint8_t>((i_value >> 8) & 0xFF);
+    };
+
+    io_entry = std::copy(i_recordName.begin(), i_recordName.end(), io_entry);
+    l_write(0);
+    l_write(i_record.first);
+    l_write(i_record.second);
+    l_write(i_eccOffset);
+    l_write((i_record.second + 3) / 4);
+}
+
+/**
+ * @brief API to write an image to a file, creating its directory.
+ *
+ * @param[in] i_vpdVector - Image.
+ * @param[in] i_filePath - Path of the file.
+ *
+ * @return true if written, false otherwise.
+ */
+bool writeImage(const types::BinaryVector& i_vpdVector,
+                const std::filesystem::path& i_filePath)
+{
+    std::error_code l_ec;
+    std::filesystem::create_directories(i_filePath.parent_path(), l_ec);
+    if (l_ec)
+    {
+        return false;
+    }
+
+    std::ofstream l_file(i_filePath, std::ios::binary | std::ios::trunc);
+    l_file.write(reinterpret_cast<const char*>(i_vpdVector.data()),
+                 static_cast<std::streamsize>(i_vpdVector.size()));
+    return static_cast<bool>(l_file);
+}
+
+/**
+ * @brief API to get EEPROM path of a FRU.
+ *
+ * Consecutive FRUs sit on consecutive buses, address moves to the next one
+ * once every bus has a device.
+ *
+ * @param[in] i_outputDirectory - Directory of the synthetic system.
+ * @param[in] i_fruIndex - Index of the FRU across all chassis.
+ * @param[in] i_busCount - Number of I2C buses.
+ *
+ * @return EEPROM path.
+ */
+std::string getEepromPath(const std::filesystem::path& i_outputDirectory,
+                          const size_t i_fruIndex, const size_t i_busCount)
+{
+    constexpr size_t l_firstAddress = 0x50;
+    return (i_outputDirectory / "i2c" /
+            std::format("{}-{:04x}", i_fruIndex % i_busCount,
+                        l_firstAddress + i_fruIndex / i_busCount) /
+            "eeprom")
+        .string();
+}
+} // namespace
+
+types::BinaryVector createKeywordVpd(const size_t i_keywordCount)
+{
+    constexpr std::string_view l_identifier = "SYNTHETIC KW VPD";
+    constexpr size_t l_keywordNameSize = 2;
+
+    types::BinaryVector l_vpdVector{constants::KW_VPD_START_TAG};
+    appendUInt16LE(l_vpdVector, l_identifier.size());
+    l_vpdVector.insert(l_vpdVector.end(), l_identifier.begin(),
+                       l_identifier.end());
+
+    const size_t l_checkSumStart = l_vpdVector.size();
+    l_vpdVector.push_back(constants::KW_VPD_PAIR_START_TAG);
+    appendUInt16LE(l_vpdVector,
+                   i_keywordCount * (l_keywordNameSize + sizeof(types::KwSize) +
+                                     keywordValueSize));
+
+    for (size_t l_index = 0; l_index < i_keywordCount; ++l_index)
+    {
+        const auto l_keywordName = getKeywordName(l_index);
+        l_vpdVector.insert(l_vpdVector.end(), l_keywordName.begin(),
+                           l_keywordName.end());
+        l_vpdVector.push_back(keywordValueSize);
+        l_vpdVector.insert(l_vpdVector.end(), keywordValueSize,
+                           static_cast<uint8_t>('0' + l_index % 10));
+    }
+
+    uint8_t l_checkSum = 0;
+    for (size_t l_index = l_checkSumStart; l_index < l_vpdVector.size();
+         ++l_index)
+    {
+        l_checkSum += l_vpdVector[l_index];
+    }
+
+    l_vpdVector.push_back(constants::KW_VAL_PAIR_END_TAG);
+    l_vpdVector.push_back(static_cast<uint8_t>(~l_checkSum + 1));
+    l_vpdVector.push_back(constants::KW_VPD_END_TAG);
+    return l_vpdVector;
+}
+
+types::BinaryVector createIpzVpd(const size_t i_recordCount)
+{
+    // VHDR ECC precedes VHDR record, which is padded to 44 bytes.
+    types::BinaryVector l_vpdVector(ipzVhdrOffset, 0);
+
+    types::BinaryVector l_keywords{'V', 'D', 2,   '0',
+                                   '1', 'P', 'T', ipzPtEntrySize};
+    l_keywords.resize(l_keywords.size() + ipzPtEntrySize);
+    const auto l_vhdr = appendIpzRecord(l_vpdVector, "VHDR", l_keywords, 8);
+
+    l_keywords = {'P', 'T',
+                  static_cast<uint8_t>(i_recordCount * ipzPtEntrySize)};
+    l_keywords.resize(l_keywords.size() + i_recordCount * ipzPtEntrySize);
+    const auto l_vtoc = appendIpzRecord(l_vpdVector, "VTOC", l_keywords);
+
+    std::vector<std::pair<size_t, size_t>> l_records;
+    l_keywords.clear();
+    for (size_t l_index = 0; l_index < ipzKeywordsPerRecord; ++l_index)
+    {
+        const auto l_keywordName = getKeywordName(l_index);
+        l_keywords.insert(l_keywords.end(), l_keywordName.begin(),
+                          l_keywordName.end());
+        l_keywords.push_back(keywordValueSize);
+        l_keywords.insert(l_keywords.end(), keywordValueSize,
+                          static_cast<uint8_t>('0' + l_index % 10));
+    }
+    for (size_t l_index = 0; l_index < i_recordCount; ++l_index)
+    {
+        l_records.emplace_back(appendIpzRecord(
+            l_vpdVector, "R" + std::format("{:03}", l_index), l_keywords));
+    }
+
+    // ECC of VTOC and records, VHDR ECC lives at offset 0.
+    std::vector<size_t> l_eccOffsets;
+    for (const auto& l_record : l_records)
+    {
+        l_eccOffsets.push_back(l_vpdVector.size());
+        l_vpdVector.resize(l_vpdVector.size() + (l_record.second + 3) / 4);
+    }
+    const size_t l_vtocEccOffset = l_vpdVector.size();
+    l_vpdVector.resize(l_vpdVector.size() + (l_vtoc.second + 3) / 4);
+
+    auto l_entry = std::next(l_vpdVector.begin(), ipzVhdrTocEntryOffset);
+    writePtEntry(l_entry, "VTOC", l_vtoc, l_vtocEccOffset);
+
+    l_entry = std::next(l_vpdVector.begin(),
+                        l_vtoc.first + ipzVtocPtDataOffset);
+    for (size_t l_index = 0; l_index < i_recordCount; ++l_index)
+    {
+        writePtEntry(l_entry, "R" + std::format("{:03}", l_index),
+                     l_records[l_index], l_eccOffsets[l_index]);
+    }
+
+    // Best effort, parser checks ECC only when the library verifies it.
+    const auto l_createEcc = [&l_vpdVector](
+                                 const std::pair<size_t, size_t>& i_record,
+                                 const size_t i_eccOffset) {
+        size_t l_eccLength = (i_record.second + 3) / 4;
+        vpdecc_create_ecc(&l_vpdVector[i_record.first], i_record.second,
+                          &l_vpdVector[i_eccOffset], &l_eccLength);
+    };
+    l_createEcc(l_vhdr, 0);
+    l_createEcc(l_vtoc, l_vtocEccOffset);
+    for (size_t l_index = 0; l_index < i_recordCount; ++l_index)
+    {
+        l_createEcc(l_records[l_index], l_eccOffsets[l_index]);
+    }
+
+    return l_vpdVector;
+}
+
+types::BinaryVector createJedecSpd()
+{
+    types::BinaryVector l_spdVector(512, 0);
+    l_spdVector[constants::SPD_BYTE_2] = constants::SPD_DRAM_TYPE_DDR4;
+    l_spdVector[constants::SPD_BYTE_3] = 0x01;
+    l_spdVector[constants::SPD_BYTE_4] = 0x85;
+    l_spdVector[5] = 0x29;
+    l_spdVector[constants::SPD_BYTE_12] = 0x08;
+    l_spdVector[constants::SPD_BYTE_13] = 0x03;
+    l_spdVector[constants::SPD_BYTE_18] = 0x06;
+    return l_spdVector;
+}
+std::string generateSyntheticSystem(const SyntheticSystemConfig& i_config,
+                                    uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+
+    if (i_config.m_outputDirectory.empty() || i_config.m_chassisCount == 0 ||
+        i_config.m_i2cBusCount == 0)
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return std::string{};
+    }
+
+    try
+    {
+        std::ifstream l_ddimmFile(i_config.m_ddimmImagePath, std::ios::binary);
+        const types::BinaryVector l_ddimmVpd(
+            (std::istreambuf_iterator<char>(l_ddimmFile)),
+            std::istreambuf_iterator<char>());
+        if (l_ddimmVpd.empty())
+        {
+            o_errCode = error_code::FILE_ACCESS_ERROR;
+            return std::string{};
+        }
+
+        // FRUs of a kind share the image, each gets its own file.
+        const auto l_motherboardVpd = createIpzVpd(16);
+        const std::array<types::BinaryVector, 3> l_fruVpds{
+            createIpzVpd(4), createKeywordVpd(64), l_ddimmVpd};
+
+        nlohmann::json l_frus = nlohmann::json::object();
+        size_t l_fruIndex = 0;
+
+        for (size_t l_chassis = 0; l_chassis < i_config.m_chassisCount;
+             ++l_chassis)
+        {
+            const std::string l_motherboardPath = std::format(
+                "/xyz/openbmc_project/inventory/system/chassis{}/motherboard",
+                l_chassis);
+
+            for (size_t l_fru = 0; l_fru <= i_config.m_frusPerChassis;
+                 ++l_fru, ++l_fruIndex)
+            {
+                const auto l_eepromPath =
+                    getEepromPath(i_config.m_outputDirectory, l_fruIndex,
+                                  i_config.m_i2cBusCount);
+
+                const auto& l_vpdVector =
+                    (l_fru == 0 ? l_motherboardVpd
+                                : l_fruVpds[(l_fru - 1) % l_fruVpds.size()]);
+                if (!writeImage(l_vpdVector, l_eepromPath))
+                {
+                    o_errCode = error_code::FILE_SYSTEM_ERROR;
+                    return std::string{};
+                }
+
+                nlohmann::json l_subFruJson{
+                    {"inventoryPath",
+                     (l_fru == 0 ? l_motherboardPath
+                                 : std::format("{}/fru{}", l_motherboardPath,
+                                               l_fru))},
+                    {"serviceName", constants::pimServiceName}};
+
+                l_frus[l_eepromPath] =
+                    nlohmann::json::array({std::move(l_subFruJson)});
+            }
+        }
+
+        const auto l_configJsonPath =
+            i_config.m_outputDirectory / "system_config.json";
+        std::ofstream l_configJsonFile(l_configJsonPath, std::ios::trunc);
+        l_configJsonFile << nlohmann::json{{"frus", std::move(l_frus)}};
+        if (!l_configJsonFile)
+        {
+            o_errCode = error_code::FILE_SYSTEM_ERROR;
+            return std::string{};
+        }
+
+        return l_configJsonPath.string();
+    }
+    catch (const std::exception&)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+
+    return std::string{};
+}
+} // namespace bench
+} // namespace vpd
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace vpd
+{
+namespace bench
+{
+// Keywords per record of synthetic IPZ image, keeps 16 records and their ECC
+// within reach of 2 byte offsets.
+constexpr size_t ipzKeywordsPerRecord = 64;
+
+// Value size of keywords of synthetic images.
+constexpr size_t keywordValueSize = 24;
+
+/**
+ * @brief API to create a keyword format VPD image.
+ *
+ * @param[in] i_keywordCount - Number of keywords, less than 35 * 36.
+ *
+ * @return VPD image.
+ */
+types::BinaryVector createKeywordVpd(const size_t i_keywordCount);
+
+/**
+ * @brief API to create an IPZ format VPD image.
+ *
+ * Image has VHDR, VTOC and the given number of records, each with
+ * ipzKeywordsPerRecord keywords. ECC of records follows the records.
+ *
+ * @param[in] i_recordCount - Number of records, at most 18 fit in VTOC.
+ *
+ * @return VPD image.
+ */
+types::BinaryVector createIpzVpd(const size_t i_recordCount);
+
+/**
+ * @brief API to create a DDR4 ISDIMM SPD image.
+ *
+ * Describes a 2 rank RDIMM of known part number, so that every field is
+ * decoded.
+ *
+ * @return SPD image.
+ */
+types::BinaryVector createJedecSpd();
+
+/**
+ * @brief Structure describing a synthetic system.
+ */
+struct SyntheticSystemConfig
+{
+    // Directory to generate the system in, created if missing.
+    std::filesystem::path m_outputDirectory;
+
+    // Number of chassis, each with a motherboard.
+    size_t m_chassisCount{1};
+
+    // Number of FRUs per chassis, besides the motherboard.
+    size_t m_frusPerChassis{0};
+
+    // Number of I2C buses the EEPROMs are spread over.
+    size_t m_i2cBusCount{16};
+
+    // DDIMM image copied for DDIMM FRUs.
+    std::filesystem::path m_ddimmImagePath{"vpd_files/ddr5_ddimm.dat"};
+};
+
+/**
+ * @brief API to generate a synthetic system.
+ *
+ * Writes an EEPROM image per FRU and a system config JSON referring to them.
+ * EEPROM of a FRU is <output directory>/i2c/<bus>-<address>/eeprom, so that
+ * FRUs spread across I2C buses the way they do on hardware. Motherboards carry
+ * IPZ VPD, other FRUs cycle through IPZ, keyword and DDIMM VPD.
+ *
+ * @param[in] i_config - Synthetic system description.
+ * @param[out] o_errCode - To set error code in case of error.
+ *
+ * @return Path of the system config JSON, empty on error.
+ */
+std::string generateSyntheticSystem(const SyntheticSystemConfig& i_config,
+                                    uint16_t& o_errCode) noexcept;
+} // namespace bench
+} // namespace vpd
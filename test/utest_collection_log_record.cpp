@@ -0,0 +1,48 @@
+#include "collection_log_record.hpp"
+
+#include <cstdint>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(CollectionLogRecordTest, EventsDecodeToTextLogMessages)
+{
+    using namespace collectionLog;
+
+    // Every event has a descriptor, so that any log can be decoded.
+    for (uint16_t l_event = std::to_underlying(Event::STRING_DEFINITION);
+         l_event <= std::to_underlying(Event::REDUNDANT_COLLECTION_FAILED);
+         ++l_event)
+    {
+        const auto l_descriptor = getEventDescriptor(l_event);
+        ASSERT_NE(l_descriptor, nullptr);
+        EXPECT_EQ(std::to_underlying(l_descriptor->m_event), l_event);
+    }
+    EXPECT_EQ(getEventDescriptor(0), nullptr);
+    EXPECT_EQ(getEventDescriptor(0xFFFF), nullptr);
+
+    EXPECT_EQ(formatEventMessage(
+                  *getEventDescriptor(
+                      std::to_underlying(Event::CHASSIS_COLLECTION_COMPLETED)),
+                  "/sys/bus/i2c/drivers/at24/8-0050/eeprom", 5, 1, "Failed"),
+              "Completed VPD collection for EEPROM "
+              "[/sys/bus/i2c/drivers/at24/8-0050/eeprom]. Present: 1, Status: "
+              "Failed, ErrorCode: 5");
+
+    EXPECT_EQ(
+        formatEventMessage(*getEventDescriptor(std::to_underlying(Event::TEXT)),
+                           "worker.cpp", 0, 42, "Collection started"),
+        "FileName: worker.cpp, Line: 42 Collection started");
+
+    // Message of the error code is looked up only when formatting.
+    EXPECT_EQ(formatEventMessage(
+                  *getEventDescriptor(
+                      std::to_underlying(Event::FRU_CHECK_FAILED)),
+                  "/sys/bus/i2c/drivers/at24/0-0050/eeprom",
+                  error_code::FRU_PATH_NOT_FOUND, 0, "power off only status"),
+              "Failed to get power off only status for FRU "
+              "[/sys/bus/i2c/drivers/at24/0-0050/eeprom], error: The FRU "
+              "path is not found in the JSON.");
+}
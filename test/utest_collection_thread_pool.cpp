@@ -0,0 +1,31 @@
+#include "collection_thread_pool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(CollectionThreadPoolTest, RunsAllTasks)
+{
+    std::atomic<size_t> l_runCount{0};
+    {
+        CollectionThreadPool l_threadPool(4);
+        EXPECT_EQ(l_threadPool.getThreadCount(), 4U);
+        EXPECT_THROW(l_threadPool.submit(nullptr), std::runtime_error);
+
+        for (size_t l_index = 0; l_index < 100; ++l_index)
+        {
+            l_threadPool.submit([&l_runCount, l_index]() {
+                if (l_index % 10 == 0)
+                {
+                    throw std::runtime_error("Task failure");
+                }
+                ++l_runCount;
+            });
+        }
+        // Destructor runs the pending tasks.
+    }
+    EXPECT_EQ(l_runCount, 90U);
+}
@@ -0,0 +1,98 @@
+#include "collection_tracer.hpp"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace vpd;
+
+TEST(CollectionTracerTest, DumpsSpansOfSession)
+{
+    std::string l_traceFile(
+        (std::filesystem::temp_directory_path() / "utest_trace_XXXXXX")
+            .string());
+    const int l_traceFd = mkstemp(l_traceFile.data());
+    ASSERT_NE(l_traceFd, -1);
+    close(l_traceFd);
+
+    const auto& l_tracer = CollectionTracer::getTracerInstance();
+
+    {
+        // Not recorded, no session is active.
+        TraceSpan l_span("outside", "/fru/0");
+    }
+
+    l_tracer->startSession();
+    {
+        std::thread l_thread([]() { TraceSpan l_span("parse", "/fru/1"); });
+        l_thread.join();
+
+        TraceSpan l_span("collectFruVpd", "/fru/2");
+    }
+    l_tracer->stopSession();
+
+    uint16_t l_errCode = 0;
+    EXPECT_EQ(l_tracer->dumpChromeTrace(l_traceFile, l_errCode), 2U);
+    EXPECT_EQ(l_errCode, 0);
+
+    std::ifstream l_traceStream(l_traceFile);
+    const auto l_trace = nlohmann::json::parse(l_traceStream);
+    ASSERT_EQ(l_trace["traceEvents"].size(), 2U);
+    for (const auto& l_event : l_trace["traceEvents"])
+    {
+        EXPECT_EQ(l_event["ph"], "X");
+        EXPECT_GE(l_event["dur"].get<double>(), 0.0);
+        EXPECT_NE(l_event["name"], "outside");
+    }
+
+    EXPECT_EQ(l_tracer->getSpanDurations("collectFruVpd").size(), 1U);
+    EXPECT_TRUE(l_tracer->getSpanDurations("outside").empty());
+
+    std::filesystem::remove(l_traceFile);
+}
+
+TEST(CollectionTracerTest, DumpWithNewSessionStarting)
+{
+    std::string l_traceFile(
+        (std::filesystem::temp_directory_path() / "utest_trace_XXXXXX")
+            .string());
+    const int l_traceFd = mkstemp(l_traceFile.data());
+    ASSERT_NE(l_traceFd, -1);
+    close(l_traceFd);
+
+    const auto& l_tracer = CollectionTracer::getTracerInstance();
+
+    // Sessions keep starting and rewriting spans while the last one is dumped.
+    std::atomic<bool> l_isDone{false};
+    std::thread l_sessionThread([&l_tracer, &l_isDone]() {
+        while (!l_isDone.load())
+        {
+            l_tracer->startSession();
+            for (int l_index = 0; l_index < 10; ++l_index)
+            {
+                TraceSpan l_span("parse", "/fru/3");
+            }
+            l_tracer->stopSession();
+        }
+    });
+
+    for (int l_index = 0; l_index < 50; ++l_index)
+    {
+        uint16_t l_errCode = 0;
+        EXPECT_LE(l_tracer->dumpChromeTrace(l_traceFile, l_errCode), 10U);
+        EXPECT_EQ(l_errCode, 0);
+    }
+
+    l_isDone = true;
+    l_sessionThread.join();
+
+    std::filesystem::remove(l_traceFile);
+}
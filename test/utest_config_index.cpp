@@ -0,0 +1,109 @@
+#include "config_index.hpp"
+#include "error_codes.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace vpd;
+
+TEST(ConfigIndexTest, LookupsMatchJson)
+{
+    const nlohmann::json l_sysCfgJson = {
+        {"frus",
+         {{"/sys/bus/i2c/drivers/at24/8-0050/eeprom",
+           {{{"inventoryPath",
+              "/xyz/openbmc_project/inventory/system/motherboard"},
+             {"serviceName", "xyz.openbmc_project.Inventory.Manager"},
+             {"redundantEeprom", "/sys/bus/i2c/drivers/at24/8-0051/eeprom"},
+             {"isSystemVpd", true},
+             {"offset", 128}}}},
+          {"/sys/bus/i2c/drivers/at24/0-0050/eeprom",
+           {{{"inventoryPath", "/xyz/openbmc_project/inventory/system/fan0"},
+             {"serviceName", "xyz.openbmc_project.Inventory.Manager"},
+             {"preAction", nlohmann::json::object()}}}}}}};
+
+    uint16_t l_errCode = 0;
+    std::vector<std::string> l_skippedEepromPaths;
+    auto l_image =
+        ConfigIndex::compile(l_sysCfgJson, 1, l_skippedEepromPaths, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+    EXPECT_TRUE(l_skippedEepromPaths.empty());
+
+    ConfigIndex l_configIndex;
+    EXPECT_FALSE(l_configIndex.assign(std::vector<std::byte>(l_image), 2,
+                                      l_errCode));
+    EXPECT_EQ(l_errCode, error_code::INVALID_CONFIG_INDEX);
+    ASSERT_TRUE(l_configIndex.assign(std::move(l_image), 1, l_errCode));
+    EXPECT_EQ(l_configIndex.getFruCount(), 2U);
+
+    const auto l_motherboard = l_configIndex.findFru(
+        "/xyz/openbmc_project/inventory/system/motherboard");
+    ASSERT_TRUE(l_motherboard.has_value());
+    EXPECT_EQ(l_motherboard->m_eepromPath,
+              "/sys/bus/i2c/drivers/at24/8-0050/eeprom");
+    EXPECT_EQ(l_motherboard->m_vpdOffset, 128U);
+    EXPECT_TRUE(l_motherboard->hasFlag(IS_SYSTEM_VPD));
+
+    const auto l_redundant = l_configIndex.findFru(
+        "/sys/bus/i2c/drivers/at24/8-0051/eeprom");
+    ASSERT_TRUE(l_redundant.has_value());
+    EXPECT_EQ(l_redundant->m_inventoryPath, l_motherboard->m_inventoryPath);
+
+    const auto l_fan = l_configIndex.findByEepromPath(
+        "/sys/bus/i2c/drivers/at24/0-0050/eeprom");
+    ASSERT_TRUE(l_fan.has_value());
+    EXPECT_TRUE(l_fan->m_redundantEeprom.empty());
+    EXPECT_TRUE(l_fan->hasFlag(HAS_PRE_ACTION));
+    EXPECT_FALSE(l_fan->hasFlag(IS_SYSTEM_VPD));
+
+    EXPECT_FALSE(l_configIndex.findFru("/sys/bus/i2c/drivers/at24/1-0050/eeprom")
+                     .has_value());
+}
+
+TEST(ConfigIndexTest, SkipsInvalidFrusAndResolvesSharedPaths)
+{
+    constexpr auto l_sharedInventoryPath =
+        "/xyz/openbmc_project/inventory/system/chassis/motherboard";
+
+    const nlohmann::json l_sysCfgJson = {
+        {"frus",
+         {{"/sys/bus/i2c/drivers/at24/8-0050/eeprom",
+           {{{"inventoryPath", l_sharedInventoryPath}}}},
+          {"/sys/bus/i2c/drivers/at24/3-0050/eeprom",
+           {{{"inventoryPath", l_sharedInventoryPath}}}},
+          {"/sys/bus/i2c/drivers/at24/4-0050/eeprom", "notAnArray"},
+          {"/sys/bus/i2c/drivers/at24/5-0050/eeprom",
+           {{{"inventoryPath", "/xyz/openbmc_project/inventory/system/fan0"},
+             {"offset", "128"}}}}}}};
+
+    uint16_t l_errCode = 0;
+    std::vector<std::string> l_skippedEepromPaths;
+    auto l_image =
+        ConfigIndex::compile(l_sysCfgJson, 1, l_skippedEepromPaths, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+    EXPECT_EQ(l_skippedEepromPaths,
+              (std::vector<std::string>{
+                  "/sys/bus/i2c/drivers/at24/4-0050/eeprom",
+                  "/sys/bus/i2c/drivers/at24/5-0050/eeprom"}));
+
+    ConfigIndex l_configIndex;
+    ASSERT_TRUE(l_configIndex.assign(std::move(l_image), 1, l_errCode));
+    EXPECT_EQ(l_configIndex.getFruCount(), 2U);
+
+    // Lowest EEPROM path wins, whatever the order of the JSON.
+    const auto l_motherboard =
+        l_configIndex.findByInventoryPath(l_sharedInventoryPath);
+    ASSERT_TRUE(l_motherboard.has_value());
+    EXPECT_EQ(l_motherboard->m_eepromPath,
+              "/sys/bus/i2c/drivers/at24/3-0050/eeprom");
+
+    EXPECT_FALSE(
+        l_configIndex
+            .findByInventoryPath("/xyz/openbmc_project/inventory/system/fan0")
+            .has_value());
+}
@@ -0,0 +1,119 @@
+#include "config_manager.hpp"
+#include "error_codes.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace vpd;
+
+namespace vpd
+{
+/**
+ * @brief Class standing in for Manager, to initialize ConfigManager.
+ */
+class ConfigManagerTestAccess
+{
+  public:
+    static std::shared_ptr<ConfigManager> initialize(
+        const std::string& i_sysConfigJsonPath)
+    {
+        return ConfigManager::initialize(ConfigManager::ManagerPassKey{},
+                                         i_sysConfigJsonPath);
+    }
+};
+} // namespace vpd
+
+namespace
+{
+constexpr auto primaryEeprom = "/sys/bus/i2c/drivers/at24/8-0050/eeprom";
+constexpr auto redundantEeprom = "/sys/bus/i2c/drivers/at24/8-0051/eeprom";
+constexpr auto otherChassisEeprom = "/sys/bus/i2c/drivers/at24/9-0050/eeprom";
+constexpr auto unknownEeprom = "/sys/bus/i2c/drivers/at24/1-0050/eeprom";
+constexpr auto motherboardPath =
+    "/xyz/openbmc_project/inventory/system/chassis/motherboard";
+} // namespace
+
+class ConfigManagerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char l_dirTemplate[] = "/tmp/configManagerTestXXXXXX";
+        ASSERT_NE(mkdtemp(l_dirTemplate), nullptr);
+        m_directory = l_dirTemplate;
+
+        const nlohmann::json l_sysCfgJson = {
+            {"frus",
+             {{primaryEeprom,
+               {{{"inventoryPath", motherboardPath},
+                 {"serviceName", "xyz.openbmc_project.Inventory.Manager"},
+                 {"redundantEeprom", redundantEeprom}}}},
+              {otherChassisEeprom,
+               {{{"inventoryPath",
+                  "/xyz/openbmc_project/inventory/system/chassis1/motherboard"},
+                 {"serviceName",
+                  "xyz.openbmc_project.Inventory.Manager"}}}}}}};
+
+        const auto l_jsonPath = m_directory / "system_config.json";
+        std::ofstream(l_jsonPath) << l_sysCfgJson.dump();
+
+        m_configManager =
+            ConfigManagerTestAccess::initialize(l_jsonPath.string());
+        ASSERT_NE(m_configManager, nullptr);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    std::filesystem::path m_directory;
+    std::shared_ptr<ConfigManager> m_configManager;
+};
+
+TEST_F(ConfigManagerTest, GetJsonObjResolvesToChassisJson)
+{
+    const auto l_primaryJson = m_configManager->getJsonObj(primaryEeprom);
+    ASSERT_TRUE(l_primaryJson.has_value());
+
+    const auto& l_frus = l_primaryJson->get().at("frus");
+    EXPECT_TRUE(l_frus.contains(primaryEeprom));
+    EXPECT_FALSE(l_frus.contains(otherChassisEeprom));
+
+    // Redundant EEPROM has no entry under "frus", its primary's chassis JSON
+    // is returned.
+    const auto l_redundantJson = m_configManager->getJsonObj(redundantEeprom);
+    ASSERT_TRUE(l_redundantJson.has_value());
+    EXPECT_EQ(&l_redundantJson->get(), &l_primaryJson->get());
+
+    const auto l_inventoryJson = m_configManager->getJsonObj(motherboardPath);
+    ASSERT_TRUE(l_inventoryJson.has_value());
+    EXPECT_EQ(&l_inventoryJson->get(), &l_primaryJson->get());
+
+    const auto l_unknownJson = m_configManager->getJsonObj(unknownEeprom);
+    ASSERT_FALSE(l_unknownJson.has_value());
+    EXPECT_EQ(l_unknownJson.error(), error_code::PATH_NOT_FOUND_IN_JSON);
+}
+
+TEST_F(ConfigManagerTest, FindFruResolvesToPrimaryEeprom)
+{
+    for (const auto& l_vpdPath :
+         {primaryEeprom, redundantEeprom, motherboardPath})
+    {
+        const auto l_fruRecord = m_configManager->findFru(l_vpdPath);
+        ASSERT_TRUE(l_fruRecord.has_value()) << l_vpdPath;
+        EXPECT_EQ(l_fruRecord->m_eepromPath, primaryEeprom) << l_vpdPath;
+        EXPECT_EQ(l_fruRecord->m_redundantEeprom, redundantEeprom)
+            << l_vpdPath;
+    }
+
+    const auto l_unknownFru = m_configManager->findFru(unknownEeprom);
+    ASSERT_FALSE(l_unknownFru.has_value());
+    EXPECT_EQ(l_unknownFru.error(), error_code::FRU_PATH_NOT_FOUND);
+}
@@ -0,0 +1,146 @@
+#include "constants.hpp"
+#include "types.hpp"
+#include "utility/dbus_utility.hpp"
+
+#include <sdbusplus/exception.hpp>
+
+#include <cerrno>
+#include <format>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+namespace
+{
+types::ObjectMap getFruObjectMap(const std::string& i_fruName)
+{
+    return types::ObjectMap{
+        {std::string(constants::pimPath) + "/system/" + i_fruName,
+         types::InterfaceMap{
+             {constants::locationCodeInf,
+              {{"LocationCode", "U78DA.ND0." + i_fruName}}}}}};
+}
+} // namespace
+
+TEST(DbusUtilityTest, PublishBatchSendsFrusInOneNotify)
+{
+    std::vector<types::ObjectMap> l_notifiedBatches;
+    dbusUtility::getPimNotifyOverride() =
+        [&l_notifiedBatches](const types::ObjectMap& i_batch) {
+            l_notifiedBatches.push_back(i_batch);
+        };
+
+    auto& l_stats = dbusUtility::getPimPublishStats();
+    const uint64_t l_notifyCount = l_stats.m_notifyCount;
+    const uint64_t l_objectCount = l_stats.m_objectCount;
+
+    {
+        dbusUtility::PublishBatch l_publishBatch;
+        for (const auto& l_fruName : {"fru0", "fru1", "fru2"})
+        {
+            EXPECT_TRUE(
+                dbusUtility::publishVpdOnDBus(getFruObjectMap(l_fruName)));
+        }
+        EXPECT_TRUE(l_notifiedBatches.empty());
+        EXPECT_TRUE(l_publishBatch.commit());
+    }
+
+    dbusUtility::getPimNotifyOverride() = nullptr;
+
+    ASSERT_EQ(l_notifiedBatches.size(), 1U);
+    EXPECT_EQ(l_notifiedBatches.front().size(), 3U);
+
+    // PIM takes paths relative to its own path.
+    EXPECT_TRUE(l_notifiedBatches.front().contains(
+        sdbusplus::message::object_path("/system/fru1")));
+
+    EXPECT_EQ(l_stats.m_notifyCount - l_notifyCount, 1U);
+    EXPECT_EQ(l_stats.m_objectCount - l_objectCount, 3U);
+}
+
+TEST(DbusUtilityTest, CallPimSplitsIntoBoundedBatches)
+{
+    std::vector<size_t> l_batchSizes;
+    dbusUtility::getPimNotifyOverride() =
+        [&l_batchSizes](const types::ObjectMap& i_batch) {
+            l_batchSizes.push_back(i_batch.size());
+        };
+
+    types::ObjectMap l_objectMap;
+    for (size_t l_index = 0; l_index <= constants::MAX_OBJECTS_PER_NOTIFY;
+         ++l_index)
+    {
+        l_objectMap.merge(getFruObjectMap(std::format("fru{}", l_index)));
+    }
+
+    EXPECT_TRUE(dbusUtility::callPIM(std::move(l_objectMap)));
+
+    dbusUtility::getPimNotifyOverride() = nullptr;
+
+    EXPECT_EQ(l_batchSizes,
+              (std::vector<size_t>{constants::MAX_OBJECTS_PER_NOTIFY, 1}));
+}
+
+TEST(DbusUtilityTest, FailedNotifyReachesCaller)
+{
+    dbusUtility::getPimNotifyOverride() = [](const types::ObjectMap&) {
+        throw sdbusplus::exception::SdBusError(-EIO, "Notify");
+    };
+
+    auto& l_stats = dbusUtility::getPimPublishStats();
+    const uint64_t l_failedNotifyCount = l_stats.m_failedNotifyCount;
+
+    EXPECT_THROW(dbusUtility::publishVpdOnDBus(getFruObjectMap("fru0")),
+                 sdbusplus::exception::SdBusError);
+
+    dbusUtility::getPimNotifyOverride() = nullptr;
+
+    EXPECT_EQ(l_stats.m_failedNotifyCount - l_failedNotifyCount, 1U);
+}
+
+TEST(DbusUtilityTest, NestedPublishBatchJoinsOuter)
+{
+    std::vector<types::ObjectMap> l_notifiedBatches;
+    dbusUtility::getPimNotifyOverride() =
+        [&l_notifiedBatches](const types::ObjectMap& i_batch) {
+            l_notifiedBatches.push_back(i_batch);
+        };
+
+    {
+        dbusUtility::PublishBatch l_outerBatch;
+        EXPECT_TRUE(dbusUtility::publishVpdOnDBus(getFruObjectMap("fru0")));
+        {
+            dbusUtility::PublishBatch l_innerBatch;
+            EXPECT_TRUE(
+                dbusUtility::publishVpdOnDBus(getFruObjectMap("fru1")));
+            EXPECT_TRUE(l_innerBatch.commit());
+        }
+        EXPECT_TRUE(l_notifiedBatches.empty());
+    }
+
+    dbusUtility::getPimNotifyOverride() = nullptr;
+
+    // Uncommitted batch publishes as it goes out of scope.
+    ASSERT_EQ(l_notifiedBatches.size(), 1U);
+    EXPECT_EQ(l_notifiedBatches.front().size(), 2U);
+}
+
+TEST(DbusUtilityTest, PublishBatchCommitReportsFailure)
+{
+    dbusUtility::getPimNotifyOverride() = [](const types::ObjectMap&) {
+        throw sdbusplus::exception::SdBusError(-EIO, "Notify");
+    };
+
+    dbusUtility::PublishBatch l_publishBatch;
+    EXPECT_TRUE(dbusUtility::publishVpdOnDBus(getFruObjectMap("fru0")));
+    EXPECT_THROW(l_publishBatch.commit(), sdbusplus::exception::SdBusError);
+
+    dbusUtility::getPimNotifyOverride() = nullptr;
+
+    // Batching has ended on the thread.
+    EXPECT_FALSE(dbusUtility::getThreadPublishBatch().has_value());
+}
@@ -0,0 +1,124 @@
+#include "eeprom_fingerprint_store.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace vpd;
+
+class EepromFingerprintStoreTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char l_dirTemplate[] = "/tmp/fingerprintStoreTestXXXXXX";
+        ASSERT_NE(mkdtemp(l_dirTemplate), nullptr);
+        m_directory = l_dirTemplate;
+
+        m_vpdFile = (m_directory / "vpd.dat").string();
+        m_storeFile = (m_directory / "store.json").string();
+        std::filesystem::copy_file("vpd_files/ipz_system.dat", m_vpdFile);
+
+        m_sysCfgJson = {
+            {"frus",
+             {{m_vpdFile,
+               nlohmann::json::array({{{"inventoryPath", "/system/fru"}}})}}}};
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    std::filesystem::path m_directory;
+    std::string m_vpdFile;
+    std::string m_storeFile;
+    nlohmann::json m_sysCfgJson;
+};
+
+TEST_F(EepromFingerprintStoreTest, DetectsChangedEeprom)
+{
+    const std::string& l_vpdFile = m_vpdFile;
+    const std::string& l_storeFile = m_storeFile;
+    nlohmann::json& l_sysCfgJson = m_sysCfgJson;
+
+    uint16_t l_errCode = 0;
+    const auto l_fingerprint = EepromFingerprintStore::computeFingerprint(
+        l_vpdFile, l_sysCfgJson, l_errCode);
+    ASSERT_TRUE(l_fingerprint.has_value());
+    EXPECT_EQ(l_errCode, 0);
+
+    {
+        EepromFingerprintStore l_store(l_storeFile);
+        EXPECT_FALSE(l_store.isUnchanged(l_vpdFile, *l_fingerprint));
+
+        l_store.update(l_vpdFile, *l_fingerprint);
+        EXPECT_TRUE(l_store.isUnchanged(l_vpdFile, *l_fingerprint));
+        EXPECT_TRUE(l_store.save(l_errCode));
+    }
+
+    // Fingerprints outlive the store instance.
+    EepromFingerprintStore l_store(l_storeFile);
+    EXPECT_TRUE(l_store.isUnchanged(l_vpdFile, *l_fingerprint));
+
+    // Change in config of the FRU changes its fingerprint.
+    l_sysCfgJson["frus"][l_vpdFile][0]["inventoryPath"] = "/system/fru1";
+    const auto l_configChanged = EepromFingerprintStore::computeFingerprint(
+        l_vpdFile, l_sysCfgJson, l_errCode);
+    ASSERT_TRUE(l_configChanged.has_value());
+    EXPECT_FALSE(l_store.isUnchanged(l_vpdFile, *l_configChanged));
+
+    // So does a single byte of VPD.
+    {
+        std::fstream l_vpdStream(l_vpdFile, std::ios::in | std::ios::out |
+                                                std::ios::binary);
+        l_vpdStream.seekp(200);
+        l_vpdStream.put('#');
+    }
+    const auto l_contentChanged = EepromFingerprintStore::computeFingerprint(
+        l_vpdFile, l_sysCfgJson, l_errCode);
+    ASSERT_TRUE(l_contentChanged.has_value());
+    EXPECT_NE(l_contentChanged->m_contentHash, l_configChanged->m_contentHash);
+
+    EXPECT_FALSE(EepromFingerprintStore::computeFingerprint(
+                     (m_directory / "xyz.dat").string(), l_sysCfgJson,
+                     l_errCode)
+                     .has_value());
+    EXPECT_NE(l_errCode, 0);
+
+    l_store.invalidate(l_vpdFile);
+    EXPECT_FALSE(l_store.isUnchanged(l_vpdFile, *l_fingerprint));
+    EXPECT_FALSE(EepromFingerprintStore(l_storeFile).isUnchanged(
+        l_vpdFile, *l_fingerprint));
+}
+
+TEST_F(EepromFingerprintStoreTest, PendingFingerprintNeedsConfirmation)
+{
+    uint16_t l_errCode = 0;
+    const auto l_fingerprint = EepromFingerprintStore::computeFingerprint(
+        m_vpdFile, m_sysCfgJson, l_errCode);
+    ASSERT_TRUE(l_fingerprint.has_value());
+
+    EepromFingerprintStore l_store(m_storeFile);
+    l_store.update(m_vpdFile, *l_fingerprint);
+
+    // Queued VPD replaces what is published.
+    l_store.setPending(m_vpdFile, *l_fingerprint);
+    EXPECT_FALSE(l_store.isUnchanged(m_vpdFile, *l_fingerprint));
+
+    l_store.confirmPending({m_vpdFile});
+    EXPECT_FALSE(l_store.isUnchanged(m_vpdFile, *l_fingerprint));
+
+    l_store.setPending(m_vpdFile, *l_fingerprint);
+    l_store.confirmPending({});
+    EXPECT_TRUE(l_store.isUnchanged(m_vpdFile, *l_fingerprint));
+
+    // Confirmed fingerprint is persisted right away.
+    EXPECT_TRUE(EepromFingerprintStore(m_storeFile)
+                    .isUnchanged(m_vpdFile, *l_fingerprint));
+}
@@ -0,0 +1,106 @@
+#include "gpio_edge_monitor.hpp"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+namespace
+{
+// Debounce time used by the tests.
+constexpr std::chrono::milliseconds debounceTime(50);
+
+/**
+ * @brief Run the io context till a condition holds, or a bounded time passes.
+ *
+ * @param[in] io_ioContext - IO context to run.
+ * @param[in] i_condition - Condition to wait for.
+ * @param[in] i_timeout - Maximum time to run.
+ *
+ * @return true if condition holds, false on timeout.
+ */
+bool runUntil(boost::asio::io_context& io_ioContext,
+              const std::function<bool()>& i_condition,
+              const std::chrono::steady_clock::duration i_timeout =
+                  std::chrono::seconds(5))
+{
+    const auto l_deadline = std::chrono::steady_clock::now() + i_timeout;
+
+    while (!i_condition() && std::chrono::steady_clock::now() < l_deadline)
+    {
+        if (io_ioContext.stopped())
+        {
+            io_ioContext.restart();
+        }
+        io_ioContext.run_one_until(l_deadline);
+    }
+    return i_condition();
+}
+} // namespace
+
+TEST(GpioEdgeMonitorTest, DebouncesEdges)
+{
+    // Pipe stands in for event descriptor of a GPIO line.
+    int l_pipeFds[2];
+    ASSERT_EQ(pipe(l_pipeFds), 0);
+
+    auto l_ioContext = std::make_shared<boost::asio::io_context>();
+    GpioEdgeMonitor l_edgeMonitor(l_ioContext, debounceTime);
+
+    size_t l_edgeCount = 0;
+    size_t l_settleCount = 0;
+    std::chrono::steady_clock::time_point l_lastEdgeTime;
+    std::chrono::steady_clock::time_point l_settleTime;
+    l_edgeMonitor.addWatch(
+        l_pipeFds[0],
+        [&]() {
+            char l_edge;
+            while (read(l_pipeFds[0], &l_edge, 1) == 1 && l_edge != 'e')
+            {
+                ++l_edgeCount;
+                l_lastEdgeTime = std::chrono::steady_clock::now();
+            }
+        },
+        [&]() {
+            ++l_settleCount;
+            l_settleTime = std::chrono::steady_clock::now();
+        });
+    EXPECT_EQ(l_edgeMonitor.getWatchCount(), 1U);
+    EXPECT_THROW(
+        l_edgeMonitor.addWatch(l_pipeFds[0], []() {}, []() {}),
+        std::invalid_argument);
+
+    // Burst of edges, each followed by end marker, settles once. Next edge is
+    // sent as soon as the previous one is read.
+    for (size_t l_index = 0; l_index < 3; ++l_index)
+    {
+        ASSERT_EQ(write(l_pipeFds[1], "xe", 2), 2);
+        ASSERT_TRUE(runUntil(*l_ioContext, [&]() {
+            return l_edgeCount == l_index + 1;
+        }));
+    }
+    ASSERT_TRUE(runUntil(*l_ioContext, [&]() { return l_settleCount > 0; }));
+
+    EXPECT_EQ(l_edgeCount, 3U);
+    EXPECT_EQ(l_settleCount, 1U);
+    EXPECT_GE(l_settleTime - l_lastEdgeTime, debounceTime);
+
+    l_edgeMonitor.removeWatch(l_pipeFds[0]);
+    EXPECT_EQ(l_edgeMonitor.getWatchCount(), 0U);
+
+    // Descriptor is not drained, nor settled, once removed.
+    ASSERT_EQ(write(l_pipeFds[1], "xe", 2), 2);
+    EXPECT_FALSE(runUntil(
+        *l_ioContext,
+        [&]() { return l_edgeCount > 3 || l_settleCount > 1; },
+        debounceTime * 4));
+
+    close(l_pipeFds[0]);
+    close(l_pipeFds[1]);
+}
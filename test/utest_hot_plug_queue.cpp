@@ -0,0 +1,48 @@
+#include "hot_plug_queue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(HotPlugQueueTest, HandlesFinalStateOfFlappingFru)
+{
+    std::mutex l_mutex;
+    std::condition_variable l_cv;
+    std::vector<std::pair<std::string, bool>> l_handledChanges;
+
+    HotPlugQueue l_queue(
+        [&](const std::string& i_inventoryPath, const bool i_isPresent) {
+            std::lock_guard<std::mutex> l_lock(l_mutex);
+            l_handledChanges.emplace_back(i_inventoryPath, i_isPresent);
+            l_cv.notify_one();
+        },
+        2, std::chrono::milliseconds(200), 2);
+
+    EXPECT_TRUE(l_queue.post("/system/fru0", true));
+    EXPECT_TRUE(l_queue.post("/system/fru0", false));
+    EXPECT_TRUE(l_queue.post("/system/fru0", true));
+    EXPECT_TRUE(l_queue.post("/system/fru1", false));
+    EXPECT_EQ(l_queue.getCoalescedCount(), 2U);
+
+    // Bounded by number of FRUs with a pending change.
+    EXPECT_FALSE(l_queue.post("/system/fru2", true));
+
+    std::unique_lock<std::mutex> l_lock(l_mutex);
+    ASSERT_TRUE(l_cv.wait_for(l_lock, std::chrono::seconds(5), [&]() {
+        return l_handledChanges.size() == 2;
+    }));
+
+    std::sort(l_handledChanges.begin(), l_handledChanges.end());
+    EXPECT_EQ(l_handledChanges,
+              (std::vector<std::pair<std::string, bool>>{
+                  {"/system/fru0", true}, {"/system/fru1", false}}));
+    EXPECT_EQ(l_queue.getPendingCount(), 0U);
+}
@@ -0,0 +1,61 @@
+#include "collection_thread_pool.hpp"
+#include "i2c_bus_scheduler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(I2cBusSchedulerTest, BusFromEepromPath)
+{
+    EXPECT_EQ(I2cBusScheduler::getI2cBusFromPath(
+                  "/sys/bus/i2c/drivers/at24/8-0050/eeprom"),
+              8);
+    EXPECT_EQ(I2cBusScheduler::getI2cBusFromPath(
+                  "/sys/bus/i2c/drivers/at24/115-0050/eeprom"),
+              115);
+    EXPECT_EQ(I2cBusScheduler::getI2cBusFromPath(
+                  "/sys/bus/spi/drivers/at25/spi12.0/eeprom"),
+              -1);
+}
+
+TEST(I2cBusSchedulerTest, CapsReadersPerBus)
+{
+    const std::string l_busPath("/sys/bus/i2c/drivers/at24/7-0050/eeprom");
+    std::atomic<size_t> l_activeReaders{0};
+    std::atomic<size_t> l_peakReaders{0};
+    std::atomic<size_t> l_runCount{0};
+
+    // Pool tasks refer to the scheduler, pool is joined before the scheduler
+    // is destroyed.
+    auto l_threadPool = std::make_unique<CollectionThreadPool>(8);
+    I2cBusScheduler l_busScheduler(*l_threadPool, 2);
+
+    for (size_t l_index = 0; l_index < 20; ++l_index)
+    {
+        l_busScheduler.submit(l_busPath, [&]() {
+            const size_t l_active = ++l_activeReaders;
+            size_t l_peak = l_peakReaders;
+            while (l_active > l_peak &&
+                   !l_peakReaders.compare_exchange_weak(l_peak, l_active))
+            {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            --l_activeReaders;
+            ++l_runCount;
+        });
+    }
+
+    while (l_runCount < 20)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    l_threadPool.reset();
+
+    EXPECT_LE(l_peakReaders, 2U);
+    EXPECT_LE(l_busScheduler.getPeakReaderCount(l_busPath), 2U);
+}
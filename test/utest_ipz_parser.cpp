@@ -1,10 +1,64 @@
+#include "exceptions.hpp"
 #include "ipz_parser.hpp"
 #include "parser.hpp"
+#include "vpd_image.hpp"
 
+#include <unistd.h>
+
+#include <cstdlib>
 #include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 
 #include <gtest/gtest.h>
 
+namespace
+{
+/**
+ * @brief Copy of a VPD file under a unique temporary path.
+ *
+ * The copy is removed when the object goes out of scope, also when a test
+ * assertion fails.
+ */
+class TempVpdFile
+{
+  public:
+    explicit TempVpdFile(const std::string& i_vpdFile) :
+        m_path((std::filesystem::temp_directory_path() / "utest_ipz_XXXXXX")
+                   .string())
+    {
+        const int l_fd = mkstemp(m_path.data());
+        if (l_fd == -1)
+        {
+            throw std::runtime_error("Failed to create temporary VPD file");
+        }
+        close(l_fd);
+
+        std::filesystem::copy_file(
+            i_vpdFile, m_path,
+            std::filesystem::copy_options::overwrite_existing);
+    }
+
+    TempVpdFile(const TempVpdFile&) = delete;
+    TempVpdFile& operator=(const TempVpdFile&) = delete;
+
+    ~TempVpdFile()
+    {
+        std::error_code l_ec;
+        std::filesystem::remove(m_path, l_ec);
+    }
+
+    const std::string& getPath() const noexcept
+    {
+        return m_path;
+    }
+
+  private:
+    std::string m_path;
+};
+} // namespace
+
 TEST(IpzVpdParserTest, GoodTestCase)
 {
     nlohmann::json l_json;
@@ -100,6 +154,269 @@ TEST(IpzVpdParserTest, MalformedVpdFile)
     EXPECT_THROW(l_vpdParser.parse(), std::exception);
 }
 
+TEST(IpzVpdParserTest, ParseToViewMatchesParse)
+{
+    nlohmann::json l_json;
+    std::string l_vpdFile("vpd_files/ipz_system.dat");
+    vpd::Parser l_vpdParser(l_vpdFile, l_json);
+
+    auto l_parsedMap = l_vpdParser.parse();
+    auto l_ipzVpdMapPtr = std::get_if<vpd::types::IPZVpdMap>(&l_parsedMap);
+    ASSERT_NE(l_ipzVpdMapPtr, nullptr);
+
+    auto l_ipzParser = std::dynamic_pointer_cast<vpd::IpzVpdParser>(
+        l_vpdParser.getVpdParserInstance());
+    ASSERT_NE(l_ipzParser, nullptr);
+
+    const auto l_ipzView = l_ipzParser->parseToView();
+    EXPECT_EQ(l_ipzView.toIpzVpdMap(), *l_ipzVpdMapPtr);
+
+    EXPECT_EQ(l_ipzView.getKeywordValue("VINI", "SN"), "Y131UF07300L");
+    EXPECT_EQ(l_ipzView.getKeywordValue("VSYS", "DR"), "SYSTEM");
+    EXPECT_TRUE(l_ipzView.hasRecord("VINI"));
+    EXPECT_FALSE(l_ipzView.hasRecord("ABCD"));
+    EXPECT_FALSE(l_ipzView.getKeywordValue("VINI", "ZZ").has_value());
+}
+
+TEST(IpzVpdParserTest, ParseCanBeCalledOnce)
+{
+    uint16_t l_errCode = 0;
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+    vpd::VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 0, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+    const auto l_parsedMap = l_ipzParser.parse();
+    ASSERT_NE(std::get_if<vpd::types::IPZVpdMap>(&l_parsedMap), nullptr);
+
+    EXPECT_THROW(l_ipzParser.parse(), vpd::DataException);
+
+    // Keywords can still be read after the map is handed over.
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "SN"), "Y131UF07300L");
+}
+
+TEST(IpzVpdParserTest, LazyKeywordReadMatchesParse)
+{
+    nlohmann::json l_json;
+    std::string l_vpdFile("vpd_files/ipz_system.dat");
+    vpd::Parser l_vpdParser(l_vpdFile, l_json);
+
+    auto l_parsedMap = l_vpdParser.parse();
+    auto l_ipzVpdMapPtr = std::get_if<vpd::types::IPZVpdMap>(&l_parsedMap);
+    ASSERT_NE(l_ipzVpdMapPtr, nullptr);
+
+    auto l_ipzParser = std::dynamic_pointer_cast<vpd::IpzVpdParser>(
+        l_vpdParser.getVpdParserInstance());
+    ASSERT_NE(l_ipzParser, nullptr);
+
+    for (const auto& [l_record, l_keywordValueMap] : *l_ipzVpdMapPtr)
+    {
+        for (const auto& [l_keyword, l_value] : l_keywordValueMap)
+        {
+            EXPECT_EQ(l_ipzParser->getKeywordValue(l_record, l_keyword),
+                      l_value);
+        }
+    }
+
+    auto l_readValue = l_ipzParser->readKeywordFromHardware(
+        vpd::types::IpzType{"VINI", "SN"});
+    auto l_readVector = std::get_if<vpd::types::BinaryVector>(&l_readValue);
+    ASSERT_NE(l_readVector, nullptr);
+    EXPECT_EQ(std::string(l_readVector->begin(), l_readVector->end()),
+              "Y131UF07300L");
+
+    EXPECT_THROW(l_ipzParser->getKeywordValue("ABCD", "SN"), std::exception);
+    EXPECT_THROW(l_ipzParser->getKeywordValue("VINI", "ZZ"), std::exception);
+}
+
+TEST(IpzVpdParserTest, KeywordUpdateCoversOnlyChangedBytes)
+{
+    uint16_t l_errCode = 0;
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+    vpd::VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 0, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+    const auto l_recordUpdates = l_ipzParser.getRecordUpdates(
+        {vpd::types::IpzData{"VINI", "SN",
+                             vpd::types::BinaryVector{'A', 'B', 'C'}}});
+
+    ASSERT_EQ(l_recordUpdates.size(), 1U);
+    const auto& l_recordUpdate = l_recordUpdates.at("VINI");
+    EXPECT_EQ(l_recordUpdate.m_sizeSet, 3);
+
+    // Only the bytes of the value given are part of the range.
+    ASSERT_EQ(l_recordUpdate.m_keywordRanges.size(), 1U);
+    const auto& [l_offset, l_data] = l_recordUpdate.m_keywordRanges.front();
+    EXPECT_EQ(l_data, (vpd::types::BinaryVector{'A', 'B', 'C'}));
+    EXPECT_EQ(std::string(l_vpdImage.getView().begin() + l_offset,
+                          l_vpdImage.getView().begin() + l_offset + 12),
+              "Y131UF07300L");
+
+    const size_t l_recordOffset = std::get<0>(l_recordUpdate.m_recordDetails);
+    EXPECT_EQ(std::string(l_recordUpdate.m_recordData.begin() +
+                              (l_offset - l_recordOffset),
+                          l_recordUpdate.m_recordData.begin() +
+                              (l_offset - l_recordOffset) + 12),
+              "ABC1UF07300L");
+
+    // Nothing is written on hardware.
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "SN"), "Y131UF07300L");
+
+    EXPECT_THROW(l_ipzParser.getRecordUpdates({vpd::types::IpzData{
+                     "VHDR", "RT", vpd::types::BinaryVector{'A'}}}),
+                 vpd::types::DbusNotAllowed);
+}
+
+TEST(IpzVpdParserTest, MultipleKeywordUpdatesGroupedOnRecord)
+{
+    uint16_t l_errCode = 0;
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+    vpd::VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 0, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+    const auto l_recordUpdates = l_ipzParser.getRecordUpdates(
+        {{"VINI", "SN", vpd::types::BinaryVector{'A', 'B', 'C'}},
+         {"VSYS", "DR", vpd::types::BinaryVector{'X'}},
+         {"VINI", "DR", vpd::types::BinaryVector{'D', 'E', 'F'}},
+         {"VINI", "SN", vpd::types::BinaryVector{'A', 'B'}}});
+
+    ASSERT_EQ(l_recordUpdates.size(), 2U);
+
+    // Both VINI keywords are set on one copy of the record. Value written
+    // twice to SN shares a range.
+    const auto& l_viniUpdate = l_recordUpdates.at("VINI");
+    EXPECT_EQ(l_viniUpdate.m_sizeSet, 8);
+    ASSERT_EQ(l_viniUpdate.m_keywordRanges.size(), 2U);
+    EXPECT_EQ(l_viniUpdate.m_keywordRanges.front().second,
+              (vpd::types::BinaryVector{'D', 'E', 'F'}));
+    EXPECT_EQ(l_viniUpdate.m_keywordRanges.back().second,
+              (vpd::types::BinaryVector{'A', 'B', 'C'}));
+
+    const auto& l_vsysUpdate = l_recordUpdates.at("VSYS");
+    EXPECT_EQ(l_vsysUpdate.m_sizeSet, 1);
+    ASSERT_EQ(l_vsysUpdate.m_keywordRanges.size(), 1U);
+    EXPECT_EQ(l_vsysUpdate.m_keywordRanges.front().second,
+              (vpd::types::BinaryVector{'X'}));
+
+    // Nothing is written on hardware.
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "SN"), "Y131UF07300L");
+}
+
+#ifdef IPZ_ECC_CHECK
+// Keyword writes regenerate record ECC, hence need the real ECC library.
+TEST(IpzVpdParserTest, WriteKeywordUpdatesOnlyChangedRanges)
+{
+    const TempVpdFile l_tempVpdFile("vpd_files/ipz_system.dat");
+    const std::string& l_vpdFile = l_tempVpdFile.getPath();
+
+    vpd::types::BinaryVector l_originalVpd;
+    {
+        uint16_t l_errCode = 0;
+        vpd::VpdImage l_vpdImage;
+        l_vpdImage.load(l_vpdFile, 0, l_errCode);
+        ASSERT_EQ(l_errCode, 0);
+        l_originalVpd.assign(l_vpdImage.getView().begin(),
+                             l_vpdImage.getView().end());
+
+        vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+        EXPECT_EQ(l_ipzParser.writeKeywordOnHardware(vpd::types::IpzData{
+                      "VINI", "SN", vpd::types::BinaryVector{'A', 'B', 'C'}}),
+                  3);
+    }
+
+    uint16_t l_errCode = 0;
+    vpd::VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 0, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+    ASSERT_EQ(l_vpdImage.getView().size(), l_originalVpd.size());
+
+    vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "SN"), "ABC1UF07300L");
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "DR"), "SYSTEM BACKPLANE");
+
+    // Only keyword's value and record's ECC may differ.
+    size_t l_changedBytes = 0;
+    for (size_t l_index = 0; l_index < l_originalVpd.size(); ++l_index)
+    {
+        l_changedBytes +=
+            (l_originalVpd[l_index] != l_vpdImage.getView()[l_index]);
+    }
+    EXPECT_GT(l_changedBytes, 0U);
+    EXPECT_LT(l_changedBytes, 64U);
+}
+
+TEST(IpzVpdParserTest, WriteMultipleKeywords)
+{
+    const TempVpdFile l_tempVpdFile("vpd_files/ipz_system.dat");
+    const std::string& l_vpdFile = l_tempVpdFile.getPath();
+
+    {
+        uint16_t l_errCode = 0;
+        vpd::VpdImage l_vpdImage;
+        l_vpdImage.load(l_vpdFile, 0, l_errCode);
+        ASSERT_EQ(l_errCode, 0);
+
+        vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+
+        // Restricted records are rejected before anything is written.
+        EXPECT_THROW(l_ipzParser.writeKeywordsOnHardware(
+                         {{"VINI", "SN", vpd::types::BinaryVector{'X'}},
+                          {"VTOC", "PT", vpd::types::BinaryVector{'X'}}}),
+                     std::exception);
+
+        EXPECT_EQ(l_ipzParser.writeKeywordsOnHardware(
+                      {{"VINI", "SN", vpd::types::BinaryVector{'A', 'B', 'C'}},
+                       {"VINI", "DR", vpd::types::BinaryVector{'D', 'E', 'F'}}}),
+                  6);
+    }
+
+    uint16_t l_errCode = 0;
+    vpd::VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 0, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    vpd::IpzVpdParser l_ipzParser(l_vpdImage.getView(), l_vpdFile);
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "SN"), "ABC1UF07300L");
+    EXPECT_EQ(l_ipzParser.getKeywordValue("VINI", "DR"), "DEFTEM BACKPLANE");
+}
+#endif
+
+TEST(IpzVpdParserTest, CompareWithRedundantVpd)
+{
+    const std::string l_primaryFile("vpd_files/ipz_system.dat");
+    const TempVpdFile l_redundantFile(l_primaryFile);
+
+    nlohmann::json l_json;
+    {
+        vpd::Parser l_vpdParser(l_primaryFile, l_json);
+        EXPECT_TRUE(l_vpdParser.compareData(l_redundantFile.getPath()));
+    }
+
+    // Change VINI SN of the redundant copy in place, ECC is not involved.
+    {
+        std::fstream l_vpdStream(l_redundantFile.getPath(),
+                                 std::ios::in | std::ios::out |
+                                     std::ios::binary);
+        std::string l_vpd((std::istreambuf_iterator<char>(l_vpdStream)),
+                          std::istreambuf_iterator<char>());
+        const auto l_snOffset = l_vpd.find("Y131UF07300L");
+        ASSERT_NE(l_snOffset, std::string::npos);
+
+        l_vpdStream.seekp(l_snOffset);
+        l_vpdStream.put('A');
+        ASSERT_TRUE(l_vpdStream.good());
+    }
+
+    vpd::Parser l_vpdParser(l_primaryFile, l_json);
+    EXPECT_FALSE(l_vpdParser.compareData(l_redundantFile.getPath()));
+    EXPECT_THROW(l_vpdParser.compareData(""), std::exception);
+}
+
 #ifdef IPZ_ECC_CHECK
 TEST(IpzVpdParserTest, InvalidRecordOffset)
 {
@@ -0,0 +1,50 @@
+#include "constants.hpp"
+#include "location_code_index.hpp"
+#include "types.hpp"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(LocationCodeIndexTest, TracksLocationCodeChanges)
+{
+    LocationCodeIndex l_index;
+    const std::string l_cpuPath("/xyz/openbmc_project/inventory/system/cpu0");
+    const std::string l_corePath(
+        "/xyz/openbmc_project/inventory/system/cpu0/core0");
+
+    // Object map paths are relative to inventory root, as published on PIM.
+    types::ObjectMap l_objectMap;
+    l_objectMap.emplace(
+        "/system/cpu0",
+        types::InterfaceMap{
+            {constants::locationCodeInf,
+             {{"LocationCode", std::string("U78DA.ND0.1234567-P0-C15")}}}});
+    l_objectMap.emplace(
+        "/system/cpu0/core0",
+        types::InterfaceMap{
+            {constants::locationCodeInf,
+             {{"LocationCode", std::string("U78DA.ND0.1234567-P0-C15")}}}});
+    l_objectMap.emplace("/system/cpu1",
+                        types::InterfaceMap{{"com.ibm.ipzvpd.VINI", {}}});
+    l_index.update(l_objectMap);
+
+    EXPECT_EQ(l_index.size(), 2U);
+    EXPECT_EQ(l_index.getInventoryPaths("U78DA.ND0.1234567-P0-C15"),
+              (types::ListOfPaths{l_cpuPath, l_corePath}));
+    EXPECT_EQ(l_index.getLocationCode(l_cpuPath), "U78DA.ND0.1234567-P0-C15");
+
+    // Location code moves when the object is republished.
+    l_index.update(l_corePath, "U78DA.ND0.1234567-P0-C16");
+    EXPECT_EQ(l_index.getInventoryPaths("U78DA.ND0.1234567-P0-C15"),
+              (types::ListOfPaths{l_cpuPath}));
+    EXPECT_EQ(l_index.getInventoryPaths("U78DA.ND0.1234567-P0-C16"),
+              (types::ListOfPaths{l_corePath}));
+
+    l_index.remove(l_cpuPath);
+    EXPECT_TRUE(l_index.getInventoryPaths("U78DA.ND0.1234567-P0-C15").empty());
+    EXPECT_FALSE(l_index.getLocationCode(l_cpuPath).has_value());
+    EXPECT_EQ(l_index.size(), 1U);
+}
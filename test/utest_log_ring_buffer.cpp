@@ -0,0 +1,167 @@
+#include "log_ring_buffer.hpp"
+#include "logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+namespace vpd
+{
+class AsyncFileLoggerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char l_dirTemplate[] = "/tmp/asyncFileLoggerTestXXXXXX";
+        ASSERT_NE(mkdtemp(l_dirTemplate), nullptr);
+        m_directory = l_dirTemplate;
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    // Ring is kept small, so that it overflows.
+    static std::unique_ptr<AsyncFileLogger> createLogger(
+        const std::filesystem::path& i_filePath,
+        const LogOverflowPolicy i_overflowPolicy)
+    {
+        return std::unique_ptr<AsyncFileLogger>(
+            new AsyncFileLogger(i_filePath, 1000000, LogFileFormat::TEXT,
+                                i_overflowPolicy, 16));
+    }
+
+    std::filesystem::path m_directory;
+};
+} // namespace vpd
+
+TEST(LogRingBufferTest, KeepsOrderAndDropsOldest)
+{
+    LogRingBuffer l_ringBuffer(16, LogOverflowPolicy::DROP_OLDEST);
+    ASSERT_EQ(l_ringBuffer.getSlotCount(), 16U);
+
+    // A long message spans multiple slots.
+    const std::string l_longMessage(3 * LogRingBuffer::SLOT_PAYLOAD_SIZE + 1,
+                                    'x');
+    const auto l_time = std::chrono::system_clock::now();
+    l_ringBuffer.push(l_longMessage, l_time);
+
+    std::string l_message;
+    std::chrono::system_clock::time_point l_poppedTime;
+    ASSERT_TRUE(l_ringBuffer.pop(l_message, l_poppedTime));
+    EXPECT_EQ(l_message, l_longMessage);
+    EXPECT_EQ(l_poppedTime, l_time);
+    EXPECT_FALSE(l_ringBuffer.pop(l_message, l_poppedTime));
+
+    // Overflow the ring by 4 messages, the oldest ones are dropped.
+    for (size_t l_index = 0; l_index < 20; ++l_index)
+    {
+        l_ringBuffer.push(std::to_string(l_index), l_time);
+    }
+    EXPECT_EQ(l_ringBuffer.getDroppedCount(), 4U);
+
+    for (size_t l_index = 4; l_index < 20; ++l_index)
+    {
+        ASSERT_TRUE(l_ringBuffer.pop(l_message, l_poppedTime));
+        EXPECT_EQ(l_message, std::to_string(l_index));
+    }
+    EXPECT_TRUE(l_ringBuffer.isEmpty());
+}
+
+TEST(LogRingBufferTest, BlockedProducersLoseNothing)
+{
+    LogRingBuffer l_ringBuffer(16, LogOverflowPolicy::BLOCK);
+    constexpr size_t l_producerCount = 4;
+    constexpr size_t l_messagesPerProducer = 1000;
+
+    std::vector<std::thread> l_producers;
+    for (size_t l_producer = 0; l_producer < l_producerCount; ++l_producer)
+    {
+        l_producers.emplace_back([&l_ringBuffer, l_producer]() {
+            for (size_t l_index = 0; l_index < l_messagesPerProducer;
+                 ++l_index)
+            {
+                l_ringBuffer.push(std::to_string(l_producer) + ":" +
+                                      std::to_string(l_index),
+                                  std::chrono::system_clock::now());
+            }
+        });
+    }
+
+    // Messages of a producer are popped in the order it pushed them.
+    std::vector<size_t> l_nextIndex(l_producerCount, 0);
+    size_t l_poppedCount = 0;
+    std::string l_message;
+    std::chrono::system_clock::time_point l_time;
+    while (l_poppedCount < l_producerCount * l_messagesPerProducer)
+    {
+        if (!l_ringBuffer.pop(l_message, l_time))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto l_separator = l_message.find(':');
+        const size_t l_producer = std::stoul(l_message.substr(0, l_separator));
+        ASSERT_LT(l_producer, l_producerCount);
+        EXPECT_EQ(std::stoul(l_message.substr(l_separator + 1)),
+                  l_nextIndex[l_producer]++);
+        ++l_poppedCount;
+    }
+
+    for (auto& l_thread : l_producers)
+    {
+        l_thread.join();
+    }
+    EXPECT_EQ(l_ringBuffer.getDroppedCount(), 0U);
+    EXPECT_TRUE(l_ringBuffer.isEmpty());
+}
+
+TEST_F(AsyncFileLoggerTest, DropOldestKeepsNewestMessages)
+{
+    constexpr size_t l_messageCount = 20000;
+    const auto l_filePath = m_directory / "collection.log";
+
+    uint64_t l_droppedCount = 0;
+    {
+        auto l_logger =
+            createLogger(l_filePath, LogOverflowPolicy::DROP_OLDEST);
+        for (size_t l_index = 0; l_index < l_messageCount; ++l_index)
+        {
+            l_logger->logMessage(std::to_string(l_index));
+        }
+        l_droppedCount = l_logger->getDroppedCount();
+
+        // Buffered messages are written on destruction.
+    }
+
+    std::vector<size_t> l_writtenIndexes;
+    std::ifstream l_logFile(l_filePath);
+    for (std::string l_line; std::getline(l_logFile, l_line);)
+    {
+        const auto l_separator = l_line.find(" : ");
+        ASSERT_NE(l_separator, std::string::npos) << l_line;
+        l_writtenIndexes.push_back(std::stoul(l_line.substr(l_separator + 3)));
+    }
+
+    // Every message is either written, in order, or counted as dropped.
+    EXPECT_EQ(l_writtenIndexes.size() + l_droppedCount, l_messageCount);
+    EXPECT_TRUE(std::ranges::is_sorted(l_writtenIndexes));
+    EXPECT_EQ(std::ranges::adjacent_find(l_writtenIndexes),
+              l_writtenIndexes.end());
+
+    // Only older messages make way, the newest one always reaches the file.
+    ASSERT_FALSE(l_writtenIndexes.empty());
+    EXPECT_EQ(l_writtenIndexes.back(), l_messageCount - 1);
+}
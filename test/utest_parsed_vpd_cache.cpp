@@ -0,0 +1,59 @@
+#include "parsed_vpd_cache.hpp"
+
+#include <string>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(ParsedVpdCacheTest, HitMissAndInvalidate)
+{
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+    auto l_cache = ParsedVpdCache::getCacheInstance();
+    l_cache->invalidateAll();
+
+    size_t l_parseCount = 0;
+    auto l_parseFunction = [&l_parseCount]() -> types::ParsedVpdMap {
+        ++l_parseCount;
+        return types::DbusIPZVpdMap{
+            {"VINI", {{"SN", types::BinaryVector{0x31, 0x32}}}}};
+    };
+
+    const auto l_hitCount = l_cache->getHitCount();
+    const auto l_missCount = l_cache->getMissCount();
+
+    const auto l_firstRead = l_cache->getParsedVpd(l_vpdFile, l_parseFunction);
+    const auto l_secondRead =
+        l_cache->getParsedVpd(l_vpdFile, l_parseFunction);
+
+    EXPECT_EQ(l_parseCount, 1U);
+    EXPECT_EQ(l_firstRead, l_secondRead);
+    EXPECT_EQ(l_cache->getHitCount(), l_hitCount + 1);
+    EXPECT_EQ(l_cache->getMissCount(), l_missCount + 1);
+
+    l_cache->invalidate(l_vpdFile);
+    l_cache->getParsedVpd(l_vpdFile, l_parseFunction);
+
+    EXPECT_EQ(l_parseCount, 2U);
+    EXPECT_EQ(l_cache->getMissCount(), l_missCount + 2);
+
+    // Entry from before invalidation is still usable by its holder.
+    EXPECT_TRUE(std::holds_alternative<types::DbusIPZVpdMap>(*l_firstRead));
+}
+
+TEST(ParsedVpdCacheTest, MissingFileIsNotCached)
+{
+    auto l_cache = ParsedVpdCache::getCacheInstance();
+
+    size_t l_parseCount = 0;
+    auto l_parseFunction = [&l_parseCount]() -> types::ParsedVpdMap {
+        ++l_parseCount;
+        return types::DbusKeywordVpdMap{};
+    };
+
+    l_cache->getParsedVpd("vpd_files/xyz.dat", l_parseFunction);
+    l_cache->getParsedVpd("vpd_files/xyz.dat", l_parseFunction);
+
+    EXPECT_EQ(l_parseCount, 2U);
+}
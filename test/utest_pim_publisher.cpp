@@ -0,0 +1,225 @@
+#include "constants.hpp"
+#include "pim_publisher.hpp"
+#include "types.hpp"
+#include "utility/dbus_utility.hpp"
+
+#include <sdbusplus/exception.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <format>
+#include <future>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+namespace
+{
+// Interface the fake PIM rejects objects with.
+constexpr auto failingInf = "xyz.openbmc_project.Test.Failing";
+
+/**
+ * @brief Fake of PIM, installed as Notify override.
+ *
+ * First Notify call is held till release() so that objects published
+ * meanwhile are queued for the next batch. Calls with an object implementing
+ * failingInf are rejected. Members are read only after PimPublisher::stop(),
+ * which joins the flusher thread.
+ */
+class FakePim
+{
+  public:
+    FakePim()
+    {
+        dbusUtility::getPimNotifyOverride() =
+            [this](const types::ObjectMap& i_batch) { notify(i_batch); };
+        dbusUtility::getPublishObserver() =
+            [this](const types::ObjectMap& i_objectMap) {
+                m_observedMaps.push_back(i_objectMap);
+            };
+    }
+
+    ~FakePim()
+    {
+        dbusUtility::getPimNotifyOverride() = nullptr;
+        dbusUtility::getPublishObserver() = nullptr;
+    }
+
+    FakePim(const FakePim&) = delete;
+    FakePim& operator=(const FakePim&) = delete;
+    FakePim(FakePim&&) = delete;
+    FakePim& operator=(FakePim&&) = delete;
+
+    bool waitForFirstCall()
+    {
+        return m_firstCallFuture.wait_for(std::chrono::seconds(5)) ==
+               std::future_status::ready;
+    }
+
+    void release()
+    {
+        m_releasePromise.set_value();
+    }
+
+    // Sizes of every Notify call, failed ones included.
+    std::vector<size_t> m_batchSizes;
+
+    // Batches PIM took.
+    std::vector<types::ObjectMap> m_takenBatches;
+
+    // Maps the publish observer was called with.
+    std::vector<types::ObjectMap> m_observedMaps;
+
+  private:
+    void notify(const types::ObjectMap& i_batch)
+    {
+        m_batchSizes.push_back(i_batch.size());
+
+        if (m_batchSizes.size() == 1)
+        {
+            m_firstCallPromise.set_value();
+            m_releaseFuture.wait();
+        }
+
+        for (const auto& l_object : i_batch)
+        {
+            if (l_object.second.contains(failingInf))
+            {
+                throw sdbusplus::exception::SdBusError(-EIO, "Notify");
+            }
+        }
+
+        m_takenBatches.push_back(i_batch);
+    }
+
+    std::promise<void> m_firstCallPromise;
+    std::future<void> m_firstCallFuture{m_firstCallPromise.get_future()};
+    std::promise<void> m_releasePromise;
+    std::future<void> m_releaseFuture{m_releasePromise.get_future()};
+};
+
+std::string getFruPath(const size_t i_index)
+{
+    return std::format("{}/system/fru{}", constants::pimPath, i_index);
+}
+
+std::string getStatus(const types::VpdCollectionStatus i_status)
+{
+    return types::CommonProgress::convertOperationStatusToString(i_status);
+}
+
+types::ObjectMap getStatusObjectMap(const std::string& i_fruPath,
+                                    const types::VpdCollectionStatus i_status)
+{
+    return types::ObjectMap{
+        {i_fruPath,
+         types::InterfaceMap{{types::CommonProgress::interface,
+                              {{"Status", getStatus(i_status)}}}}}};
+}
+} // namespace
+
+TEST(PimPublisherTest, BatchesObjectsQueuedDuringNotify)
+{
+    FakePim l_fakePim;
+    const auto& l_publisher = PimPublisher::getPublisherInstance();
+    l_publisher->start();
+    EXPECT_TRUE(l_publisher->isRunning());
+
+    EXPECT_TRUE(dbusUtility::publishVpdOnDBus(getStatusObjectMap(
+        getFruPath(0), types::VpdCollectionStatus::Completed)));
+    ASSERT_TRUE(l_fakePim.waitForFirstCall());
+
+    // Queued, hence reported as published.
+    for (size_t l_index = 1; l_index <= 3; ++l_index)
+    {
+        EXPECT_TRUE(dbusUtility::publishVpdOnDBus(getStatusObjectMap(
+            getFruPath(l_index), types::VpdCollectionStatus::Completed)));
+    }
+    l_fakePim.release();
+
+    EXPECT_TRUE(l_publisher->stop().empty());
+    EXPECT_FALSE(l_publisher->isRunning());
+
+    EXPECT_EQ(l_fakePim.m_batchSizes, (std::vector<size_t>{1, 3}));
+
+    // PIM takes paths relative to its own path.
+    ASSERT_EQ(l_fakePim.m_takenBatches.size(), 2U);
+    EXPECT_TRUE(l_fakePim.m_takenBatches.back().contains(
+        sdbusplus::message::object_path("/system/fru2")));
+}
+
+TEST(PimPublisherTest, SplitsFlushAtBatchLimit)
+{
+    FakePim l_fakePim;
+    l_fakePim.release();
+
+    const auto& l_publisher = PimPublisher::getPublisherInstance();
+    l_publisher->start();
+
+    types::ObjectMap l_objectMap;
+    for (size_t l_index = 0; l_index <= constants::MAX_OBJECTS_PER_NOTIFY;
+         ++l_index)
+    {
+        l_objectMap.merge(getStatusObjectMap(
+            getFruPath(l_index), types::VpdCollectionStatus::Completed));
+    }
+    EXPECT_TRUE(dbusUtility::publishVpdOnDBus(std::move(l_objectMap)));
+
+    EXPECT_TRUE(l_publisher->stop().empty());
+
+    EXPECT_EQ(l_fakePim.m_batchSizes,
+              (std::vector<size_t>{constants::MAX_OBJECTS_PER_NOTIFY, 1}));
+}
+
+TEST(PimPublisherTest, MarksFailedObjects)
+{
+    FakePim l_fakePim;
+    const auto& l_publisher = PimPublisher::getPublisherInstance();
+    l_publisher->start();
+
+    auto l_objectMap = getStatusObjectMap(
+        getFruPath(0), types::VpdCollectionStatus::InProgress);
+    l_objectMap.merge(getStatusObjectMap(
+        getFruPath(1), types::VpdCollectionStatus::InProgress));
+    l_objectMap.at(sdbusplus::message::object_path(getFruPath(1)))
+        .emplace(failingInf, types::PropertyMap{});
+    EXPECT_TRUE(dbusUtility::publishVpdOnDBus(std::move(l_objectMap)));
+    ASSERT_TRUE(l_fakePim.waitForFirstCall());
+
+    // Goes in a later batch than the failed VPD of the FRU.
+    EXPECT_TRUE(dbusUtility::publishVpdOnDBus(getStatusObjectMap(
+        getFruPath(1), types::VpdCollectionStatus::Completed)));
+    l_fakePim.release();
+
+    EXPECT_EQ(l_publisher->stop(), std::vector<std::string>{getFruPath(1)});
+
+    // Batch, then each of its objects, then Failed status of failed object,
+    // then the later batch.
+    EXPECT_EQ(l_fakePim.m_batchSizes, (std::vector<size_t>{2, 1, 1, 1, 1}));
+
+    // Completed status of the failed FRU is sent as Failed.
+    ASSERT_FALSE(l_fakePim.m_takenBatches.empty());
+    const auto& l_lastBatch = l_fakePim.m_takenBatches.back();
+    const sdbusplus::message::object_path l_failedFruPath("/system/fru1");
+    ASSERT_TRUE(l_lastBatch.contains(l_failedFruPath));
+    EXPECT_EQ(std::get<std::string>(l_lastBatch.at(l_failedFruPath)
+                                        .at(types::CommonProgress::interface)
+                                        .at("Status")),
+              getStatus(types::VpdCollectionStatus::Failed));
+
+    // Observer sees only what PIM took.
+    EXPECT_EQ(l_fakePim.m_observedMaps.size(),
+              l_fakePim.m_takenBatches.size());
+    for (const auto& l_observedMap : l_fakePim.m_observedMaps)
+    {
+        for (const auto& l_object : l_observedMap)
+        {
+            EXPECT_FALSE(l_object.second.contains(failingInf));
+        }
+    }
+}
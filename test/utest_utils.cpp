@@ -1,9 +1,20 @@
+#include "error_codes.hpp"
 #include "utility/common_utility.hpp"
 
 #include <utility/vpd_specific_utility.hpp>
 
+#include <unistd.h>
+
+#include <boost/asio/io_context.hpp>
+
 #include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -25,6 +36,138 @@ TEST(UtilsTest, TestValidValue)
     }
 }
 
+TEST(UtilsTest, ExecuteCommand)
+{
+    uint16_t l_errCode = 0;
+    auto l_result =
+        commonUtility::executeCommand({"echo", "a b", "c"}, l_errCode);
+    EXPECT_EQ(l_errCode, 0);
+    EXPECT_EQ(l_result.m_exitStatus, 0);
+    EXPECT_EQ(l_result.m_output, std::vector<std::string>{"a b c\n"});
+
+    l_result = commonUtility::executeCommand(
+        {"sh", "-c", "printf 'x\\ny'; exit 3"}, l_errCode);
+    EXPECT_EQ(l_errCode, 0);
+    EXPECT_EQ(l_result.m_exitStatus, 3);
+    EXPECT_EQ(l_result.m_output, (std::vector<std::string>{"x\n", "y"}));
+
+    // Whole process group is killed, even if a child holds stdout open.
+    l_result = commonUtility::executeCommand(
+        {"sh", "-c", "sleep 10 & sleep 10"}, l_errCode,
+        std::chrono::milliseconds(100));
+    EXPECT_EQ(l_errCode, error_code::COMMAND_TIMED_OUT);
+    EXPECT_LT(l_result.m_latency, std::chrono::seconds(5));
+
+    commonUtility::executeCommand({"/nonexistent/command"}, l_errCode);
+    EXPECT_EQ(l_errCode, error_code::COMMAND_SPAWN_FAILED);
+
+    EXPECT_EQ(commonUtility::executeCmd("echo", l_errCode, std::string("z")),
+              std::vector<std::string>{"z\n"});
+    EXPECT_EQ(l_errCode, 0);
+}
+
+TEST(UtilsTest, AsyncExecuteCommand)
+{
+    boost::asio::io_context l_ioContext;
+    std::vector<std::pair<commonUtility::CommandResult, uint16_t>> l_results(3);
+    size_t l_handlerCount = 0;
+
+    const auto l_getHandler = [&](const size_t i_index) {
+        return [&, i_index](commonUtility::CommandResult&& i_result,
+                            const uint16_t i_errCode) {
+            l_results[i_index] = {std::move(i_result), i_errCode};
+            ++l_handlerCount;
+        };
+    };
+
+    commonUtility::asyncExecuteCommand(
+        l_ioContext, {"sh", "-c", "printf 'x\\ny'; exit 3"},
+        std::chrono::milliseconds(5000), l_getHandler(0));
+
+    // Whole process group is killed, even if a child holds stdout open.
+    commonUtility::asyncExecuteCommand(
+        l_ioContext, {"sh", "-c", "sleep 10 & sleep 10"},
+        std::chrono::milliseconds(100), l_getHandler(1));
+
+    commonUtility::asyncExecuteCommand(l_ioContext, {"/nonexistent/command"},
+                                       std::chrono::milliseconds(5000),
+                                       l_getHandler(2));
+
+    // Handlers are called on the IO context only, even on spawn failure.
+    EXPECT_EQ(l_handlerCount, 0U);
+    l_ioContext.run();
+    EXPECT_EQ(l_handlerCount, 3U);
+
+    EXPECT_EQ(l_results[0].second, 0);
+    EXPECT_EQ(l_results[0].first.m_exitStatus, 3);
+    EXPECT_EQ(l_results[0].first.m_output,
+              (std::vector<std::string>{"x\n", "y"}));
+
+    EXPECT_EQ(l_results[1].second, error_code::COMMAND_TIMED_OUT);
+    EXPECT_LT(l_results[1].first.m_latency, std::chrono::seconds(5));
+
+    EXPECT_EQ(l_results[2].second, error_code::COMMAND_SPAWN_FAILED);
+}
+
+TEST(UtilsTest, GetWritableIpzKeywords)
+{
+    const types::IPZVpdMap l_vpdMap{{"VINI", {{"SN", "1"}, {"PN", "2"}}},
+                                    {"VSYS", {{"TM", "3"}}}};
+
+    // Keyword missing in VPD, in the middle of the batch.
+    const std::vector<types::IpzData> l_keywords{
+        {"VINI", "SN", types::BinaryVector{'A'}},
+        {"VINI", "XX", types::BinaryVector{'B'}},
+        {"VSYS", "TM", types::BinaryVector{'C'}}};
+
+    std::vector<types::IpzType> l_invalidKeywords;
+    EXPECT_EQ(vpdSpecificUtility::getWritableIpzKeywords(l_keywords, l_vpdMap,
+                                                         l_invalidKeywords),
+              (std::vector<types::IpzData>{l_keywords[0], l_keywords[2]}));
+    EXPECT_EQ(l_invalidKeywords,
+              (std::vector<types::IpzType>{{"VINI", "XX"}}));
+
+    // Without VPD map, only empty values and restricted records are invalid.
+    l_invalidKeywords.clear();
+    EXPECT_EQ(vpdSpecificUtility::getWritableIpzKeywords(
+                  {{"VINI", "XX", types::BinaryVector{'B'}},
+                   {"VINI", "SN", types::BinaryVector{}},
+                   {"VTOC", "PT", types::BinaryVector{'D'}}},
+                  types::IPZVpdMap{}, l_invalidKeywords),
+              (std::vector<types::IpzData>{
+                  {"VINI", "XX", types::BinaryVector{'B'}}}));
+    EXPECT_EQ(l_invalidKeywords,
+              (std::vector<types::IpzType>{{"VINI", "SN"}, {"VTOC", "PT"}}));
+}
+
+TEST(UtilsTest, EnableMux)
+{
+    char l_holdIdlePath[] = "/tmp/holdidleXXXXXX";
+    const int l_fd = mkstemp(l_holdIdlePath);
+    ASSERT_NE(l_fd, -1);
+    close(l_fd);
+
+    std::ofstream(l_holdIdlePath) << "-2";
+
+    uint16_t l_errCode = 0;
+    EXPECT_TRUE(vpdSpecificUtility::enableMux(l_holdIdlePath, l_errCode));
+    EXPECT_EQ(l_errCode, 0);
+
+    std::string l_holdIdleValue;
+    std::ifstream(l_holdIdlePath) >> l_holdIdleValue;
+    EXPECT_EQ(l_holdIdleValue, "0");
+
+    // Mux which is enabled already is left as is.
+    EXPECT_FALSE(vpdSpecificUtility::enableMux(l_holdIdlePath, l_errCode));
+    EXPECT_EQ(l_errCode, 0);
+
+    std::remove(l_holdIdlePath);
+
+    EXPECT_FALSE(vpdSpecificUtility::enableMux("/nonexistent/dir/idle_state",
+                                               l_errCode));
+    EXPECT_EQ(l_errCode, error_code::FILE_ACCESS_ERROR);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
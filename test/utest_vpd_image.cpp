@@ -0,0 +1,102 @@
+#include "constants.hpp"
+#include "error_codes.hpp"
+#include "vpd_image.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(VpdImageTest, LoadRegularFile)
+{
+    uint16_t l_errCode = 0;
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+
+    VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 0, l_errCode);
+
+    EXPECT_EQ(l_errCode, 0);
+    EXPECT_TRUE(l_vpdImage.isMapped());
+    EXPECT_EQ(l_vpdImage.getView().size(),
+              std::min<size_t>(std::filesystem::file_size(l_vpdFile),
+                               constants::MAX_VPD_SIZE));
+}
+
+TEST(VpdImageTest, LoadWithOffset)
+{
+    uint16_t l_errCode = 0;
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+
+    VpdImage l_fullImage;
+    l_fullImage.load(l_vpdFile, 0, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    VpdImage l_offsetImage;
+    l_offsetImage.load(l_vpdFile, 16, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    ASSERT_EQ(l_offsetImage.getView().size() + 16,
+              l_fullImage.getView().size());
+    EXPECT_TRUE(std::equal(l_offsetImage.getView().begin(),
+                           l_offsetImage.getView().end(),
+                           l_fullImage.getView().begin() + 16));
+}
+
+TEST(VpdImageTest, LoadMissingFile)
+{
+    uint16_t l_errCode = 0;
+
+    VpdImage l_vpdImage;
+    l_vpdImage.load("vpd_files/xyz.dat", 0, l_errCode);
+
+    EXPECT_EQ(l_errCode, error_code::FILE_NOT_FOUND);
+    EXPECT_TRUE(l_vpdImage.getView().empty());
+}
+
+TEST(VpdImageTest, WriteRangesAcrossPages)
+{
+    uint16_t l_errCode = 0;
+
+    std::string l_vpdFile(
+        (std::filesystem::temp_directory_path() / "utest_vpd_image_XXXXXX")
+            .string());
+    const int l_vpdFd = mkstemp(l_vpdFile.data());
+    ASSERT_NE(l_vpdFd, -1);
+    close(l_vpdFd);
+    std::filesystem::copy_file(
+        "vpd_files/ipz_system.dat", l_vpdFile,
+        std::filesystem::copy_options::overwrite_existing);
+
+    // Second range crosses an EEPROM page boundary.
+    const types::BinaryVector l_firstData{0x01, 0x02, 0x03};
+    const types::BinaryVector l_secondData(constants::EEPROM_PAGE_SIZE, 0xA5);
+    const std::vector<std::pair<size_t, types::BinaryView>> l_ranges{
+        {4, types::BinaryView(l_firstData)},
+        {constants::EEPROM_PAGE_SIZE + 8, types::BinaryView(l_secondData)}};
+
+    VpdImage::writeRanges(l_vpdFile, 16, l_ranges, l_errCode);
+    EXPECT_EQ(l_errCode, 0);
+
+    VpdImage l_vpdImage;
+    l_vpdImage.load(l_vpdFile, 16, l_errCode);
+    ASSERT_EQ(l_errCode, 0);
+
+    for (const auto& [l_offset, l_data] : l_ranges)
+    {
+        EXPECT_TRUE(std::equal(l_data.begin(), l_data.end(),
+                               l_vpdImage.getView().begin() + l_offset));
+    }
+
+    std::filesystem::remove(l_vpdFile);
+
+    VpdImage::writeRanges(l_vpdFile, 0, l_ranges, l_errCode);
+    EXPECT_EQ(l_errCode, error_code::FILE_NOT_FOUND);
+}
@@ -99,7 +99,39 @@ class BackupAndRestore
         const std::string& i_fruPath,
         const types::WriteVpdParams& i_paramsToWriteData) const noexcept;
 
+    /**
+     * @brief An API to update value of multiple keywords on primary or backup
+     * path.
+     *
+     * Batched form of updateKeywordOnPrimaryOrBackupPath for IPZ type VPD.
+     * Keywords found in the backup and restore config JSON are mapped to their
+     * counterpart record and keyword, and written with a single update on the
+     * counterpart path.
+     *
+     * @param[in] i_fruPath - EEPROM path of the FRU.
+     * @param[in] i_keywordsToUpdate - List of (Record, Keyword, Value).
+     *
+     * @return On success returns number of bytes written, -1 on failure.
+     */
+    int updateKeywordsOnPrimaryOrBackupPath(
+        const std::string& i_fruPath,
+        const std::vector<types::IpzData>& i_keywordsToUpdate) const noexcept;
+
   private:
+    /**
+     * @brief An API to get backup counterpart of a hardware path.
+     *
+     * @param[in] i_fruPath - EEPROM path of the FRU.
+     * @param[out] o_inputPathIsSourcePath - true if i_fruPath is the source
+     * path, false otherwise.
+     *
+     * @return Destination hardware path if i_fruPath is source path, source
+     * hardware path if i_fruPath is destination path, empty string otherwise.
+     */
+    std::string getBackupCounterpartPath(
+        const std::string& i_fruPath,
+        bool& o_inputPathIsSourcePath) const noexcept;
+
     /**
      * @brief An API to handle backup and restore of IPZ type VPD.
      *
@@ -187,22 +219,21 @@ class BackupAndRestore
         const std::string& i_serviceName) const noexcept;
 
     /**
-     * @brief Synchronize a keyword value to EEPROM for IPZ type.
+     * @brief Synchronize keywords' value to EEPROM for IPZ type.
      *
-     * This API updates the specified record's keyword value on the given
-     * EEPROM. On success, it updates the corresponding string value in the
-     * provided VPD map if not empty.
+     * This API updates all the given keywords on the given EEPROM in a single
+     * pass, with ECC of every record updated once. Keywords which can't be
+     * written are skipped. If the single pass fails, keywords are updated one
+     * by one. Value of every updated keyword is updated in the provided VPD map
+     * if not empty.
      *
      * @param[in] i_fruPath - EEPROM path.
-     * @param[in] i_recordKwName - Tuple of record and keyword name.
-     * @param[in] i_binaryStrValue -  Tuple of Keyword value in Binary and
-     * string format.
-     * @param[out] o_vpdMap - IPZ VPD map.
+     * @param[in] i_keywordsToSync - List of (Record, Keyword, Value).
+     * @param[in,out] io_vpdMap - IPZ VPD map.
      */
     void syncIpzData(const std::string& i_fruPath,
-                     const types::IpzType& i_recordKwName,
-                     const types::BinaryStringKwValuePair& i_binaryStrValue,
-                     types::IPZVpdMap& o_vpdMap) const noexcept;
+                     const std::vector<types::IpzData>& i_keywordsToSync,
+                     types::IPZVpdMap& io_vpdMap) const noexcept;
 
     /* @brief API to check if the JSON parsed is valid.
      *
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "error_codes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace vpd
+{
+/**
+ * @brief Layout of binary VPD collection log.
+ *
+ * Shared by vpd-manager, which writes the log, and vpd-tool, which decodes it.
+ *
+ * File starts with a FileHeader followed by fixed size Records in native byte
+ * order. FRU paths and source file names are written once per log file, as
+ * STRING_DEFINITION records, and later records refer to them by index. Format
+ * strings of events live only in the decoder side table below, so writing an
+ * event costs a record copy.
+ *
+ * Payload longer than a record is split into consecutive records of the same
+ * thread, all but the last having FLAG_CONTINUED set. Records of different
+ * threads can interleave.
+ */
+namespace collectionLog
+{
+/**
+ * @brief Enum class defining events of binary collection log.
+ *
+ * Values are part of the file format, don't renumber.
+ */
+enum class Event : uint16_t
+{
+    STRING_DEFINITION = 1,               /* String of index m_fruIndex */
+    TEXT = 2,                            /* Free-form message */
+    CHASSIS_COLLECTION_QUEUED = 3,       /* Chassis VPD collection queued */
+    CHASSIS_COLLECTION_COMPLETED = 4,    /* Chassis VPD collection done */
+    CHASSIS_NOT_PRESENT = 5,             /* FRUs of chassis skipped */
+    CHASSIS_FRUS_COLLECTED = 6,          /* All FRUs of chassis collected */
+    EMPTY_PARSED_VPD = 7,                /* Parser returned no VPD */
+    REDUNDANT_COLLECTION_TRIGGERED = 8,  /* Collecting from redundant EEPROM */
+    FRU_NOT_PRESENT = 9,                 /* Pre action found FRU absent */
+    FRU_CHECK_FAILED = 10,               /* FRU detail couldn't be read */
+    FRU_COLLECTION_EXCEPTION = 11,       /* FRU VPD collection failed */
+    PRESENT_PROPERTY_UPDATE_FAILED = 12, /* Present property not updated */
+    REDUNDANT_COLLECTION_FAILED = 13     /* Redundant EEPROM not collected */
+};
+
+// Magic at the start of a binary collection log file.
+static constexpr std::array<char, 8> FILE_MAGIC{'V', 'P', 'D', 'C',
+                                                'L', 'O', 'G', '\0'};
+
+// Version of the file format.
+static constexpr uint16_t FORMAT_VERSION = 1;
+
+// Bytes of payload a record carries.
+static constexpr size_t RECORD_PAYLOAD_SIZE = 36;
+
+// Maximum number of records a payload is split into, longer one is truncated.
+static constexpr size_t MAX_RECORDS_PER_PAYLOAD = 64;
+
+// Set on all but the last record of a split payload.
+static constexpr uint8_t FLAG_CONTINUED = 0x01;
+
+// Index used when a record refers to no string.
+static constexpr uint16_t NO_STRING_INDEX = 0xFFFF;
+
+/**
+ * @brief Structure of binary collection log file header.
+ */
+struct FileHeader
+{
+    // FILE_MAGIC.
+    std::array<char, 8> m_magic{FILE_MAGIC};
+
+    // FORMAT_VERSION.
+    uint16_t m_version{FORMAT_VERSION};
+
+    // sizeof(Record), lets the decoder skip records of a newer format.
+    uint16_t m_recordSize{0};
+
+    // Reserved, 0.
+    uint32_t m_reserved{0};
+};
+
+/**
+ * @brief Structure of a binary collection log record.
+ */
+struct Record
+{
+    // Nanoseconds since epoch on the system clock.
+    uint64_t m_timestamp{0};
+
+    // Id of the logging thread.
+    uint32_t m_threadId{0};
+
+    // Event.
+    uint16_t m_event{0};
+
+    // Index of FRU path in the string table. For STRING_DEFINITION it is the
+    // index being defined, for TEXT the index of source file name.
+    uint16_t m_fruIndex{NO_STRING_INDEX};
+
+    // Error code, event specific.
+    int32_t m_errorCode{0};
+
+    // Value, event specific. Source line for TEXT.
+    uint32_t m_value{0};
+
+    // FLAG_* bits.
+    uint8_t m_flags{0};
+
+    // Valid bytes in m_payload.
+    uint8_t m_payloadLength{0};
+
+    // Reserved, 0.
+    std::array<uint8_t, 2> m_reserved{};
+
+    // Payload, not null terminated.
+    std::array<char, RECORD_PAYLOAD_SIZE> m_payload{};
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(Record) == 64);
+static_assert(std::is_trivially_copyable_v<Record>);
+
+/**
+ * @brief Structure describing how an event is decoded.
+ *
+ * Format takes {0} FRU path, {1} error code, {2} value, {3} payload and {4}
+ * message of the error code.
+ */
+struct EventDescriptor
+{
+    // Event.
+    Event m_event;
+
+    // Event name.
+    std::string_view m_name;
+
+    // Format of the message.
+    std::string_view m_format;
+};
+
+// Descriptors of all events.
+static constexpr std::array<EventDescriptor, 13> eventDescriptors{{
+    {Event::STRING_DEFINITION, "STRING_DEFINITION", "String [{2}] = {3}"},
+    {Event::TEXT, "TEXT", "FileName: {0}, Line: {2} {3}"},
+    {Event::CHASSIS_COLLECTION_QUEUED, "CHASSIS_COLLECTION_QUEUED",
+     "Queuing VPD collection for chassis [{3}] with EEPROM path [{0}]"},
+    {Event::CHASSIS_COLLECTION_COMPLETED, "CHASSIS_COLLECTION_COMPLETED",
+     "Completed VPD collection for EEPROM [{0}]. Present: {2}, Status: {3}, "
+     "ErrorCode: {1}"},
+    {Event::CHASSIS_NOT_PRESENT, "CHASSIS_NOT_PRESENT",
+     "Chassis [{0}] is not present; skipping FRUs collection."},
+    {Event::CHASSIS_FRUS_COLLECTED, "CHASSIS_FRUS_COLLECTED",
+     "Completed FRUs VPD collection for chassis [{0}] in {2} milliseconds"},
+    {Event::EMPTY_PARSED_VPD, "EMPTY_PARSED_VPD",
+     "Empty parsedVpdMap received for path [{0}]. Check PEL for reason."},
+    {Event::REDUNDANT_COLLECTION_TRIGGERED, "REDUNDANT_COLLECTION_TRIGGERED",
+     "Triggering VPD collection from redundant VPD path [{0}]"},
+    {Event::FRU_NOT_PRESENT, "FRU_NOT_PRESENT",
+     "FRU [{0}] is not present. {4}"},
+    {Event::FRU_CHECK_FAILED, "FRU_CHECK_FAILED",
+     "Failed to get {3} for FRU [{0}], error: {4}"},
+    {Event::FRU_COLLECTION_EXCEPTION, "FRU_COLLECTION_EXCEPTION",
+     "VPD collection failed for FRU [{0}], error: {3}"},
+    {Event::PRESENT_PROPERTY_UPDATE_FAILED, "PRESENT_PROPERTY_UPDATE_FAILED",
+     "Exception while setting the present property for path {0}. Error {3}."},
+    {Event::REDUNDANT_COLLECTION_FAILED, "REDUNDANT_COLLECTION_FAILED",
+     "Process redundant path failed for EEPROM [{0}], reason [{3}]"},
+}};
+
+/**
+ * @brief API to get descriptor of an event.
+ *
+ * @param[in] i_event - Event id, as found in a record.
+ *
+ * @return Descriptor, nullptr if the event is unknown.
+ */
+inline const EventDescriptor* getEventDescriptor(
+    const uint16_t i_event) noexcept
+{
+    const auto l_itr = std::ranges::find_if(
+        eventDescriptors, [i_event](const EventDescriptor& i_descriptor) {
+            return static_cast<uint16_t>(i_descriptor.m_event) == i_event;
+        });
+
+    return l_itr != eventDescriptors.end() ? &(*l_itr) : nullptr;
+}
+
+/**
+ * @brief API to format message of an event.
+ *
+ * @param[in] i_descriptor - Descriptor of the event.
+ * @param[in] i_fruPath - FRU path.
+ * @param[in] i_errorCode - Error code.
+ * @param[in] i_value - Value.
+ * @param[in] i_payload - Payload.
+ *
+ * @return Message.
+ *
+ * @throw std::format_error, std::bad_alloc
+ */
+inline std::string formatEventMessage(
+    const EventDescriptor& i_descriptor, std::string_view i_fruPath,
+    const int32_t i_errorCode, const uint32_t i_value,
+    std::string_view i_payload)
+{
+    const auto l_errorMsgItr = errorCodeMap.find(i_errorCode);
+    const std::string_view l_errorMsg =
+        (l_errorMsgItr != errorCodeMap.end()) ? l_errorMsgItr->second
+                                              : std::string_view{};
+
+    return std::vformat(i_descriptor.m_format,
+                        std::make_format_args(i_fruPath, i_errorCode, i_value,
+                                              i_payload, l_errorMsg));
+}
+} // namespace collectionLog
+} // namespace vpd
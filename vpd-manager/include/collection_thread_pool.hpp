@@ -0,0 +1,159 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class implementing a bounded work-stealing thread pool.
+ *
+ * The pool owns a fixed number of worker threads, each with its own task
+ * queue. Submitted tasks are spread across the queues, a worker runs tasks
+ * from its own queue first and steals from the other queues once its own
+ * queue is empty. This keeps all the workers busy as long as any task is
+ * pending, irrespective of which queue it landed on.
+ *
+ * Worker threads are created once and are reused for all submitted tasks, they
+ * are joined when the pool is destroyed after the pending tasks are run.
+ */
+class CollectionThreadPool
+{
+  public:
+    // Deleted APIs
+    CollectionThreadPool() = delete;
+    CollectionThreadPool(const CollectionThreadPool&) = delete;
+    CollectionThreadPool& operator=(const CollectionThreadPool&) = delete;
+    CollectionThreadPool(CollectionThreadPool&&) = delete;
+    CollectionThreadPool& operator=(CollectionThreadPool&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_threadCount - Number of worker threads, minimum of 1 thread
+     * is created.
+     *
+     * @throw std::system_error if a thread can't be created.
+     */
+    explicit CollectionThreadPool(size_t i_threadCount);
+
+    /**
+     * @brief Destructor.
+     *
+     * Runs the pending tasks and joins all the worker threads.
+     */
+    ~CollectionThreadPool();
+
+    /**
+     * @brief API to submit a task to the pool.
+     *
+     * Exception thrown by the task is caught and logged by the pool.
+     *
+     * @param[in] i_task - Task to run.
+     *
+     * @throw std::runtime_error if the pool is stopping or task is empty.
+     */
+    void submit(std::function<void()> i_task);
+
+    /**
+     * @brief API to get number of worker threads.
+     *
+     * @return Number of worker threads.
+     */
+    size_t getThreadCount() const noexcept
+    {
+        return m_workers.size();
+    }
+
+    /**
+     * @brief API to get number of tasks run by the pool so far.
+     *
+     * @return Number of completed tasks.
+     */
+    size_t getCompletedTaskCount() const noexcept
+    {
+        return m_completedTasks.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to get number of tasks which were stolen from another
+     * worker's queue.
+     *
+     * @return Number of stolen tasks.
+     */
+    size_t getStolenTaskCount() const noexcept
+    {
+        return m_stolenTasks.load(std::memory_order_relaxed);
+    }
+
+  private:
+    /**
+     * @brief Structure to hold task queue of a worker.
+     */
+    struct WorkQueue
+    {
+        // Mutex to guard the queue.
+        std::mutex m_mutex;
+
+        // Tasks, owner takes from back and thieves take from front.
+        std::deque<std::function<void()>> m_tasks;
+    };
+
+    /**
+     * @brief API run by each worker thread.
+     *
+     * @param[in] i_workerIndex - Index of the worker.
+     */
+    void workerLoop(const size_t i_workerIndex) noexcept;
+
+    /**
+     * @brief API to get a task for a worker.
+     *
+     * Worker's own queue is looked up first, followed by the other queues.
+     * Other queues are skipped while locked.
+     *
+     * @param[in] i_workerIndex - Index of the worker.
+     * @param[out] o_task - Task to run.
+     * @param[out] o_isQueueSkipped - Set if a locked queue was skipped.
+     *
+     * @return true if a task is found, false otherwise.
+     */
+    bool popTask(const size_t i_workerIndex, std::function<void()>& o_task,
+                 bool& o_isQueueSkipped) noexcept;
+
+    // Task queue per worker.
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+
+    // Worker threads.
+    std::vector<std::thread> m_workers;
+
+    // Mutex to guard stop flag and idle wait.
+    std::mutex m_idleMutex;
+
+    // Condition variable on which idle workers wait for tasks.
+    std::condition_variable m_idleCv;
+
+    // Set when the pool is being destroyed.
+    bool m_stop{false};
+
+    // Number of tasks submitted but not yet taken by any worker. Updated
+    // under lock of the queue holding the task.
+    std::atomic<size_t> m_queuedTasks{0};
+
+    // Queue on which next task is submitted.
+    std::atomic<size_t> m_nextQueue{0};
+
+    // Number of tasks run.
+    std::atomic<size_t> m_completedTasks{0};
+
+    // Number of tasks taken from another worker's queue.
+    std::atomic<size_t> m_stolenTasks{0};
+};
+} // namespace vpd
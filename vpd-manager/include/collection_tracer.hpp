@@ -0,0 +1,267 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to trace phases of VPD collection.
+ *
+ * Each thread records spans (phase, FRU path, start and duration on the
+ * steady clock) into its own fixed size buffer, which is written only by that
+ * thread and published with an atomic count, hence recording needs no lock.
+ * Buffers are dumped as a Chrome trace event JSON file, which can be loaded in
+ * chrome://tracing or Perfetto UI.
+ *
+ * Tracing is off unless requested, either by the collection_trace build
+ * option, by setting VPD_COLLECTION_TRACE=1 in the environment or through the
+ * D-Bus method. When off, a span costs one relaxed atomic load.
+ */
+class CollectionTracer
+{
+  public:
+    // Deleted APIs
+    CollectionTracer(const CollectionTracer&) = delete;
+    CollectionTracer& operator=(const CollectionTracer&) = delete;
+    CollectionTracer(CollectionTracer&&) = delete;
+    CollectionTracer& operator=(CollectionTracer&&) = delete;
+
+    /**
+     * @brief API to get the tracer instance.
+     *
+     * Reference is returned to keep span recording free of ref counting.
+     *
+     * @return Shared pointer to the tracer.
+     */
+    static const std::shared_ptr<CollectionTracer>& getTracerInstance();
+
+    /**
+     * @brief API to request tracing of next collections.
+     *
+     * @param[in] i_isRequested - true to trace, false otherwise.
+     */
+    void setRequested(const bool i_isRequested) noexcept
+    {
+        m_isRequested.store(i_isRequested, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to check if tracing of collection is requested.
+     *
+     * @return true if requested, false otherwise.
+     */
+    bool isRequested() const noexcept
+    {
+        return m_isRequested.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to start a trace session.
+     *
+     * Spans recorded in the previous session are discarded. Waits for an
+     * ongoing dump of the previous session to finish reading its spans.
+     */
+    void startSession() noexcept;
+
+    /**
+     * @brief API to stop the trace session.
+     *
+     * Spans ending after this call are not recorded.
+     */
+    void stopSession() noexcept;
+
+    /**
+     * @brief API to check if a trace session is active.
+     *
+     * @return true if active, false otherwise.
+     */
+    bool isEnabled() const noexcept
+    {
+        return m_isEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to record a span.
+     *
+     * @param[in] i_phase - Phase name, must be a string literal.
+     * @param[in] i_fruPath - FRU path the span is for, can be empty.
+     * @param[in] i_startTime - Start time of the span.
+     * @param[in] i_endTime - End time of the span.
+     */
+    void recordSpan(const char* i_phase, std::string_view i_fruPath,
+                    const std::chrono::steady_clock::time_point i_startTime,
+                    const std::chrono::steady_clock::time_point
+                        i_endTime) noexcept;
+
+    /**
+     * @brief API to dump spans of the last session as Chrome trace JSON.
+     *
+     * Should be called after stopSession().
+     *
+     * @param[in] i_filePath - Path of the trace file.
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return Number of spans written.
+     */
+    size_t dumpChromeTrace(const std::string& i_filePath,
+                           uint16_t& o_errCode) const noexcept;
+
+    /**
+     * @brief API to get durations of spans of a phase in the last session.
+     *
+     * Should be called after stopSession().
+     *
+     * @param[in] i_phase - Phase name.
+     *
+     * @return Durations in nanoseconds, in no particular order.
+     *
+     * @throw std::bad_alloc
+     */
+    std::vector<int64_t> getSpanDurations(std::string_view i_phase) const;
+
+  private:
+    /**
+     * @brief Structure to hold a span.
+     */
+    struct Span
+    {
+        // Phase name.
+        const char* m_phase{nullptr};
+
+        // FRU path.
+        std::string m_fruPath;
+
+        // Start time, in nanoseconds from session start.
+        int64_t m_startNs{0};
+
+        // Duration in nanoseconds.
+        int64_t m_durationNs{0};
+    };
+
+    /**
+     * @brief Structure to hold spans of a thread.
+     *
+     * Written only by the owning thread, m_count is published with release
+     * ordering after a span is written.
+     */
+    struct ThreadBuffer
+    {
+        // Thread id of the owning thread.
+        pid_t m_threadId{0};
+
+        // Session for which the buffer holds spans.
+        std::atomic<uint64_t> m_session{0};
+
+        // Spans.
+        std::vector<Span> m_spans;
+
+        // Number of valid spans.
+        std::atomic<size_t> m_count{0};
+
+        // Number of spans dropped as buffer was full.
+        std::atomic<size_t> m_droppedCount{0};
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    CollectionTracer();
+
+    /**
+     * @brief API to get buffer of the calling thread.
+     *
+     * Buffer is created and registered on first use by a thread.
+     *
+     * @return Buffer of the thread, nullptr on allocation failure.
+     */
+    ThreadBuffer* getThreadBuffer() noexcept;
+
+    // Set if tracing of collection is requested.
+    std::atomic<bool> m_isRequested{false};
+
+    // Set while a session is active.
+    std::atomic<bool> m_isEnabled{false};
+
+    // Current session, bumped on every start.
+    std::atomic<uint64_t> m_session{0};
+
+    // Start time of the current session.
+    std::atomic<std::chrono::steady_clock::rep> m_sessionStartTicks{0};
+
+    // Mutex to guard the buffer list. Also held while spans are read, to
+    // keep a new session from starting.
+    mutable std::mutex m_buffersMutex;
+
+    // Buffers of all threads which recorded a span.
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+};
+
+/**
+ * @brief RAII class to record a span of collection trace.
+ *
+ * Span starts at construction and ends at destruction. Nothing is recorded if
+ * tracing is not enabled at construction.
+ */
+class TraceSpan
+{
+  public:
+    // Deleted APIs
+    TraceSpan() = delete;
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+    TraceSpan(TraceSpan&&) = delete;
+    TraceSpan& operator=(TraceSpan&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_phase - Phase name, must be a string literal.
+     * @param[in] i_fruPath - FRU path, must outlive the span.
+     */
+    TraceSpan(const char* i_phase, std::string_view i_fruPath) noexcept :
+        m_phase(i_phase), m_fruPath(i_fruPath)
+    {
+        if (CollectionTracer::getTracerInstance()->isEnabled())
+        {
+            m_startTime = std::chrono::steady_clock::now();
+            m_isActive = true;
+        }
+    }
+
+    /**
+     * @brief Destructor, records the span.
+     */
+    ~TraceSpan()
+    {
+        if (m_isActive)
+        {
+            CollectionTracer::getTracerInstance()->recordSpan(
+                m_phase, m_fruPath, m_startTime,
+                std::chrono::steady_clock::now());
+        }
+    }
+
+  private:
+    // Phase name.
+    const char* m_phase;
+
+    // FRU path.
+    std::string_view m_fruPath;
+
+    // Start time.
+    std::chrono::steady_clock::time_point m_startTime{};
+
+    // Set if span is being recorded.
+    bool m_isActive{false};
+};
+} // namespace vpd
@@ -0,0 +1,371 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Flags of a FRU held in the config index.
+ */
+enum ConfigIndexFlag : uint32_t
+{
+    IS_SYSTEM_VPD = 1U << 0,
+    REPLACEABLE_AT_STANDBY = 1U << 1,
+    REPLACEABLE_AT_RUNTIME = 1U << 2,
+    POWER_OFF_ONLY = 1U << 3,
+    ESSENTIAL_FRU = 1U << 4,
+    HANDLE_PRESENCE = 1U << 5,
+    MONITOR_PRESENCE = 1U << 6,
+    HAS_PRE_ACTION = 1U << 7,
+    HAS_POST_ACTION = 1U << 8,
+    HAS_POST_FAIL_ACTION = 1U << 9,
+};
+
+/**
+ * @brief Structure to hold base FRU details of an EEPROM from the index.
+ *
+ * Strings refer to the index memory, valid while the index is alive.
+ */
+struct ConfigIndexRecord
+{
+    // EEPROM path, key of the FRU under "frus".
+    std::string_view m_eepromPath;
+
+    // Inventory path of the base FRU.
+    std::string_view m_inventoryPath;
+
+    // Redundant EEPROM path, empty if none.
+    std::string_view m_redundantEeprom;
+
+    // Service name of the base FRU.
+    std::string_view m_serviceName;
+
+    // Unexpanded location code of the base FRU, empty if none.
+    std::string_view m_locationCode;
+
+    // Offset of VPD in the EEPROM.
+    size_t m_vpdOffset{0};
+
+    // ConfigIndexFlag bits.
+    uint32_t m_flags{0};
+
+    /**
+     * @brief API to check if a flag is set.
+     *
+     * @param[in] i_flag - Flag to check.
+     *
+     * @return true if set, false otherwise.
+     */
+    bool hasFlag(const ConfigIndexFlag i_flag) const noexcept
+    {
+        return (m_flags & i_flag) != 0;
+    }
+};
+
+/**
+ * @brief Class to hold a compact binary index of the system config JSON.
+ *
+ * The index holds base FRU details of every EEPROM in "frus", sorted by
+ * EEPROM path, along with tables sorted by inventory path and by redundant
+ * EEPROM path. Lookups are binary searches over the mapped image and don't
+ * allocate.
+ *
+ * Index is generated at build time by vpd-config-index-compiler next to the
+ * JSON it is compiled from. It records a hash of the source JSON, so an index
+ * which doesn't belong to the JSON in use is rejected.
+ *
+ * Details not held in the index, e.g. actions and extra interfaces, have to be
+ * read from the JSON.
+ */
+class ConfigIndex
+{
+  public:
+    // Deleted APIs
+    ConfigIndex(const ConfigIndex&) = delete;
+    ConfigIndex& operator=(const ConfigIndex&) = delete;
+    ConfigIndex(ConfigIndex&&) = delete;
+    ConfigIndex& operator=(ConfigIndex&&) = delete;
+
+    /**
+     * @brief Constructor, creates an empty index.
+     */
+    ConfigIndex() = default;
+
+    /**
+     * @brief Destructor, unmaps the index file if mapped.
+     */
+    ~ConfigIndex();
+
+    /**
+     * @brief API to compile index image from system config JSON.
+     *
+     * An EEPROM with a malformed entry under "frus" is left out of the index,
+     * the rest are compiled. If inventory or redundant EEPROM path is shared
+     * by EEPROMs, lookup by it finds the EEPROM with the lowest path.
+     *
+     * @param[in] i_sysCfgJson - System config JSON.
+     * @param[in] i_sourceHash - Hash of the JSON text, see getSourceHash().
+     * @param[out] o_skippedEepromPaths - EEPROMs left out of the index.
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return Index image on success, empty vector otherwise.
+     */
+    static std::vector<std::byte> compile(
+        const nlohmann::json& i_sysCfgJson, const uint64_t i_sourceHash,
+        std::vector<std::string>& o_skippedEepromPaths,
+        uint16_t& o_errCode) noexcept;
+
+    /**
+     * @brief API to get hash of JSON text an index is compiled from.
+     *
+     * @param[in] i_jsonText - JSON file content.
+     *
+     * @return 64 bit FNV-1a hash of the content.
+     */
+    static uint64_t getSourceHash(std::string_view i_jsonText) noexcept;
+
+    /**
+     * @brief API to get path of index file for a JSON file.
+     *
+     * Symbolic links are resolved, so the index is looked up next to the
+     * actual JSON file.
+     *
+     * @param[in] i_jsonPath - Path of the JSON file.
+     *
+     * @return Index file path, empty string on error.
+     */
+    static std::string getIndexPath(const std::string& i_jsonPath) noexcept;
+
+    /**
+     * @brief API to map an index file.
+     *
+     * @param[in] i_indexPath - Path of the index file.
+     * @param[in] i_sourceHash - Expected hash of the source JSON.
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return true if index is mapped and valid, false otherwise.
+     */
+    bool load(const std::string& i_indexPath, const uint64_t i_sourceHash,
+              uint16_t& o_errCode) noexcept;
+
+    /**
+     * @brief API to use an in memory index image.
+     *
+     * @param[in] i_image - Index image, as returned by compile().
+     * @param[in] i_sourceHash - Expected hash of the source JSON.
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return true if image is valid, false otherwise.
+     */
+    bool assign(std::vector<std::byte>&& i_image, const uint64_t i_sourceHash,
+                uint16_t& o_errCode) noexcept;
+
+    /**
+     * @brief API to check if index holds a valid image.
+     *
+     * @return true if valid, false otherwise.
+     */
+    bool isValid() const noexcept
+    {
+        return !m_image.empty();
+    }
+
+    /**
+     * @brief API to get number of EEPROMs in the index.
+     *
+     * @return Number of EEPROMs.
+     */
+    size_t getFruCount() const noexcept;
+
+    /**
+     * @brief API to find FRU by EEPROM path.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     *
+     * @return FRU record if found, std::nullopt otherwise.
+     */
+    std::optional<ConfigIndexRecord> findByEepromPath(
+        std::string_view i_eepromPath) const noexcept;
+
+    /**
+     * @brief API to find FRU by inventory path of its base FRU.
+     *
+     * @param[in] i_inventoryPath - Inventory path.
+     *
+     * @return FRU record if found, std::nullopt otherwise.
+     */
+    std::optional<ConfigIndexRecord> findByInventoryPath(
+        std::string_view i_inventoryPath) const noexcept;
+
+    /**
+     * @brief API to find FRU by its redundant EEPROM path.
+     *
+     * @param[in] i_redundantEeprom - Redundant EEPROM path.
+     *
+     * @return FRU record if found, std::nullopt otherwise.
+     */
+    std::optional<ConfigIndexRecord> findByRedundantEeprom(
+        std::string_view i_redundantEeprom) const noexcept;
+
+    /**
+     * @brief API to find FRU by any of its paths.
+     *
+     * Given path is looked up as EEPROM path, redundant EEPROM path and
+     * inventory path, in that order.
+     *
+     * @param[in] i_vpdPath - EEPROM, redundant EEPROM or inventory path.
+     *
+     * @return FRU record if found, std::nullopt otherwise.
+     */
+    std::optional<ConfigIndexRecord> findFru(
+        std::string_view i_vpdPath) const noexcept;
+
+    // Index file magic, "VPDX".
+    static constexpr uint32_t MAGIC = 0x58445056;
+
+    // Index format version, bump on any layout change.
+    static constexpr uint16_t VERSION = 1;
+
+    // Extension of index files.
+    static constexpr auto FILE_EXTENSION = ".idx";
+
+  private:
+    /**
+     * @brief Structure to refer a string in the string table.
+     */
+    struct StringRef
+    {
+        uint32_t m_offset;
+        uint32_t m_length;
+    };
+
+    /**
+     * @brief Structure of index header.
+     */
+    struct Header
+    {
+        uint32_t m_magic;
+        uint16_t m_version;
+        uint16_t m_reserved;
+        uint64_t m_sourceHash;
+        uint32_t m_imageSize;
+        uint32_t m_fruCount;
+        uint32_t m_inventoryCount;
+        uint32_t m_redundantCount;
+        uint32_t m_fruTableOffset;
+        uint32_t m_inventoryTableOffset;
+        uint32_t m_redundantTableOffset;
+        uint32_t m_stringTableOffset;
+        uint32_t m_stringTableSize;
+    };
+
+    /**
+     * @brief Structure of a FRU entry, entries are sorted by EEPROM path.
+     */
+    struct FruEntry
+    {
+        StringRef m_eepromPath;
+        StringRef m_inventoryPath;
+        StringRef m_redundantEeprom;
+        StringRef m_serviceName;
+        StringRef m_locationCode;
+        uint32_t m_vpdOffset;
+        uint32_t m_flags;
+    };
+
+    /**
+     * @brief API to validate an image.
+     *
+     * @param[in] i_image - Image to validate.
+     * @param[in] i_sourceHash - Expected hash of the source JSON.
+     *
+     * @return true if valid, false otherwise.
+     */
+    static bool isValidImage(std::span<const std::byte> i_image,
+                             const uint64_t i_sourceHash) noexcept;
+
+    /**
+     * @brief API to unmap and clear the index.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief API to get header of the image.
+     *
+     * @return Header.
+     */
+    const Header& getHeader() const noexcept
+    {
+        return *reinterpret_cast<const Header*>(m_image.data());
+    }
+
+    /**
+     * @brief API to get FRU entries.
+     *
+     * @return FRU entries.
+     */
+    std::span<const FruEntry> getFruTable() const noexcept;
+
+    /**
+     * @brief API to get a table of FRU entry indexes.
+     *
+     * @param[in] i_offset - Offset of table in the image.
+     * @param[in] i_count - Number of indexes in the table.
+     *
+     * @return Table.
+     */
+    std::span<const uint32_t> getIndexTable(
+        const uint32_t i_offset, const uint32_t i_count) const noexcept;
+
+    /**
+     * @brief API to get a string from the string table.
+     *
+     * @param[in] i_stringRef - Reference to the string.
+     *
+     * @return String.
+     */
+    std::string_view getString(const StringRef& i_stringRef) const noexcept;
+
+    /**
+     * @brief API to get record of a FRU entry.
+     *
+     * @param[in] i_fruEntry - FRU entry.
+     *
+     * @return FRU record.
+     */
+    ConfigIndexRecord getRecord(const FruEntry& i_fruEntry) const noexcept;
+
+    /**
+     * @brief API to find FRU through a table sorted by one of its paths.
+     *
+     * @param[in] i_table - Table of FRU entry indexes.
+     * @param[in] i_path - Path to find.
+     * @param[in] i_pathMember - Member of FRU entry the table is sorted by.
+     *
+     * @return FRU record if found, std::nullopt otherwise.
+     */
+    std::optional<ConfigIndexRecord> findInTable(
+        std::span<const uint32_t> i_table, std::string_view i_path,
+        StringRef FruEntry::* i_pathMember) const noexcept;
+
+    // Image in use, refers to either the mapped file or m_ownedImage.
+    std::span<const std::byte> m_image;
+
+    // Image owned by the index, when not mapped from a file.
+    std::vector<std::byte> m_ownedImage;
+
+    // Mapped address of the index file, nullptr if not mapped.
+    void* m_mappedAddress{nullptr};
+
+    // Size of the mapping.
+    size_t m_mappedSize{0};
+};
+} // namespace vpd
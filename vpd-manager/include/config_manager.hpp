@@ -1,4 +1,5 @@
 #pragma once
+#include "config_index.hpp"
 #include "error_codes.hpp"
 #include "exceptions.hpp"
 #include "logger.hpp"
@@ -15,18 +16,22 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 
 namespace vpd
 {
-
 /**
  * @brief Class to manage configuration for all systems
  *
  * This class is meant to provide easy management of static configuration for
  * all systems. It ingests system configuration JSON and implements methods to
  * extract and expose relevant configuration for a given chassis in JSON format.
+ *
+ * An instance is never modified once initialized, a reload installs a new
+ * instance. Hence JSON borrowed through getJsonSnapshot() can be held and
+ * shared across threads without copying it.
  */
-class ConfigManager final
+class ConfigManager final : public std::enable_shared_from_this<ConfigManager>
 {
   public:
     /**
@@ -48,8 +53,11 @@ class ConfigManager final
         ManagerPassKey operator=(const ManagerPassKey&) = delete;
         ManagerPassKey operator=(ManagerPassKey&&) = delete;
 
-        // Only Manager can construct this key
+        // Only Manager can construct this key.
         friend class Manager;
+
+        // Defined by tests and benchmarks, which stand in for Manager.
+        friend class ConfigManagerTestAccess;
     };
 
     // deleted methods
@@ -101,6 +109,9 @@ class ConfigManager final
      * - If `std::nullopt`, the complete system configuration JSON is returned.
      * - If an EEPROM or inventory object path is provided, the corresponding
      *   chassis-specific configuration JSON is returned.
+     * - If a redundant EEPROM path is provided, JSON of the chassis of its
+     *   primary EEPROM is returned, as the redundant EEPROM has no entry of
+     *   its own under "frus".
      *
      * i_vpdPath[in] i_vpdPath - Optional EEPROM or inventory object path.
      *
@@ -112,6 +123,39 @@ class ConfigManager final
         getJsonObj(const std::optional<std::string>& i_vpdPath = std::nullopt)
             const noexcept;
 
+    /**
+     * @brief API to borrow chassis based config JSON.
+     *
+     * Same as getJsonObj(), except the returned pointer shares ownership of
+     * this instance. JSON stays valid even after a reload replaces this
+     * instance, so it can be held beyond the call instead of being copied.
+     *
+     * @param[in] i_vpdPath - Optional EEPROM or inventory object path.
+     *
+     * @return On success, pointer to the chassis-specific JSON object.
+     *         error_code::PATH_NOT_FOUND_IN_JSON if the path does not map to
+     *         any known chassis.
+     */
+    std::expected<types::JsonSnapshot, error_code> getJsonSnapshot(
+        const std::optional<std::string>& i_vpdPath =
+            std::nullopt) const noexcept;
+
+    /**
+     * @brief API to find base FRU details of an EEPROM.
+     *
+     * Given path is looked up in the config index, see ConfigIndex::findFru,
+     * hence lookup doesn't walk the JSON.
+     *
+     * @param[in] i_vpdPath - EEPROM path, redundant EEPROM path or inventory
+     * path of a base FRU.
+     *
+     * @return On success, FRU record from config index.
+     *         error_code::FRU_PATH_NOT_FOUND if the path doesn't map to any
+     *         EEPROM.
+     */
+    std::expected<ConfigIndexRecord, error_code> findFru(
+        const std::string& i_vpdPath) const noexcept;
+
     /**
      * @brief API to get inventory path(s) for given unexpanded location code
      *
@@ -151,6 +195,20 @@ class ConfigManager final
         return m_chassisIdToJsonMap;
     }
 
+    /**
+     * @brief API to get index of the system config JSON.
+     *
+     * Index is mapped from the file generated at build time, or compiled from
+     * the loaded JSON if no matching file is found, so it is always valid once
+     * the instance is initialized.
+     *
+     * @return Config index.
+     */
+    const ConfigIndex& getConfigIndex() const noexcept
+    {
+        return m_configIndex;
+    }
+
   private:
     /**
      * @brief Class to handle validation of configuration JSON
@@ -255,6 +313,7 @@ class ConfigManager final
      * consumers to get list of inventory paths for a given unexpanded location
      * code
      *
+     * Inventory and redundant EEPROM paths are resolved through ConfigIndex.
      *
      * @throw std::runtime_error
      */
@@ -313,13 +372,29 @@ class ConfigManager final
      * object in that case.
      *
      * @param[in] i_jsonPath - Absolute path to the JSON file.
+     * @param[out] o_sourceHash - Hash of the JSON text, to match config index.
      * @param[out] o_errCode - Error code set on failure, 0 on success.
      *
      * @return Parsed JSON object on success, empty JSON on failure.
      */
     static nlohmann::json getParsedJson(const std::string& i_jsonPath,
+                                        uint64_t& o_sourceHash,
                                         uint16_t& o_errCode) noexcept;
 
+    /**
+     * @brief API to load config index of the system config JSON.
+     *
+     * Index file generated at build time is mapped if it matches the JSON,
+     * otherwise index is compiled from the loaded JSON.
+     *
+     * @param[in] i_sysConfigJsonPath - Path to system config JSON.
+     * @param[in] i_sourceHash - Hash of the system config JSON text.
+     *
+     * @throw JsonException if index can't be compiled.
+     */
+    void loadConfigIndex(const std::string& i_sysConfigJsonPath,
+                         const uint64_t i_sourceHash);
+
     /**
      * @brief API to get unexpanded location code for given FRU JSON object
      *
@@ -378,6 +453,9 @@ class ConfigManager final
     // System config JSON
     nlohmann::json m_systemConfigJson;
 
+    // Index of system config JSON, for path lookups.
+    ConfigIndex m_configIndex;
+
     // Chassis ID to chassis specific JSON map - O(logN) lookup, optimized for
     // small N
     std::map<std::string, nlohmann::json> m_chassisIdToJsonMap;
@@ -189,11 +189,46 @@ static constexpr auto INVALID_NODE_NUMBER = -1;
 
 static constexpr auto CMD_BUFFER_LENGTH = 256;
 
+// Time (in milliseconds) a command is given to finish before being killed.
+static constexpr uint32_t CMD_TIMEOUT_MS = 30000;
+
+// Commands taking longer than this (in milliseconds) are logged as slow.
+static constexpr uint32_t SLOW_CMD_THRESHOLD_MS = 1000;
+
+// Maximum number of VPD bytes read from an EEPROM.
+static constexpr size_t MAX_VPD_SIZE = 65504;
+
+// EEPROM page size writes are split on. Smallest page among at24 parts used
+// for IPZ VPD, larger pages are multiples of it.
+static constexpr size_t EEPROM_PAGE_SIZE = 32;
+
 // To be explicitly used for string comparison.
 static constexpr auto STR_CMP_SUCCESS = 0;
 
-// Just a random value. Can be adjusted as required.
-static constexpr uint8_t MAX_THREADS = 10;
+// Upper limit on number of threads in the VPD collection thread pool.
+static constexpr size_t MAX_COLLECTION_THREADS = 64;
+
+// Time (in microseconds) an idle pool worker backs off after finding a queue
+// locked by another worker.
+static constexpr uint32_t STEAL_BACKOFF_TIME_US = 50;
+
+// Upper limit on number of objects sent to PIM in a single Notify call.
+static constexpr size_t MAX_OBJECTS_PER_NOTIFY = 64;
+
+// Time (in milliseconds) VPD queued during collection waits to be batched.
+static constexpr uint32_t PIM_PUBLISH_FLUSH_INTERVAL_MS = 20;
+
+// Number of spans each thread can hold in a collection trace session.
+static constexpr size_t MAX_TRACE_SPANS_PER_THREAD = 4096;
+
+// Time (in milliseconds) a presence line has to stay stable after an edge.
+static constexpr uint32_t GPIO_DEBOUNCE_TIME_MS = 100;
+
+// Number of threads serving FRU presence changes.
+static constexpr size_t HOT_PLUG_THREADS = 2;
+
+// Time (in milliseconds) presence changes of a FRU are coalesced over.
+static constexpr uint32_t HOT_PLUG_COALESCE_TIME_MS = 200;
 
 // Timeout (in seconds) for the VPD collection wait loop.
 static constexpr uint32_t VPD_COLLECTION_TIMEOUT_SEC = 1800; // 30 minutes
@@ -235,6 +270,9 @@ static constexpr auto fcsTypeLc = "fcs";
 static constexpr auto mtsTypeLc = "mts";
 
 static constexpr auto fileModeDirectoryPath = "/var/lib/vpd/file";
+static constexpr auto collectionTraceFile = "/var/lib/vpd/collection-trace.json";
+static constexpr auto eepromFingerprintFile =
+    "/var/lib/vpd/eeprom-fingerprints.json";
 static constexpr auto pimBackupPath =
     "/var/lib/phosphor-data-sync/bmc_data_bkp/var/lib/phosphor-inventory-manager";
 static constexpr auto pimPrimaryPath = "/var/lib/phosphor-inventory-manager";
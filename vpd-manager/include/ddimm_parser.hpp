@@ -34,7 +34,7 @@ class DdimmVpdParser : public ParserInterface
      *
      * @param[in] i_vpdVector - VPD data.
      */
-    DdimmVpdParser(const types::BinaryVector& i_vpdVector) :
+    DdimmVpdParser(types::BinaryView i_vpdVector) :
         m_vpdVector(i_vpdVector)
     {
         if ((constants::DDIMM_11S_BARCODE_START +
@@ -58,7 +58,7 @@ class DdimmVpdParser : public ParserInterface
      * Updates the m_parsedVpdMap with read keyword data.
      * @param[in] i_iterator - iterator to buffer containing VPD
      */
-    void readKeywords(types::BinaryVector::const_iterator i_iterator);
+    void readKeywords(types::BinaryView::iterator i_iterator);
 
     /**
      * @brief API to calculate DDIMM size from DDIMM VPD
@@ -66,7 +66,7 @@ class DdimmVpdParser : public ParserInterface
      * @param[in] i_iterator - iterator to buffer containing VPD
      * @return calculated size or 0 in case of any error.
      */
-    size_t getDdimmSize(types::BinaryVector::const_iterator i_iterator);
+    size_t getDdimmSize(types::BinaryView::iterator i_iterator);
 
     /**
      * @brief This function calculates DDR5 based DDIMM's capacity
@@ -75,7 +75,7 @@ class DdimmVpdParser : public ParserInterface
      * @return calculated size or 0 in case of any error.
      */
     size_t getDdr5BasedDdimmSize(
-        types::BinaryVector::const_iterator i_iterator);
+        types::BinaryView::iterator i_iterator);
 
     /**
      * @brief This function calculates DDR4 based DDIMM's capacity
@@ -84,7 +84,7 @@ class DdimmVpdParser : public ParserInterface
      * @return calculated size or 0 in case of any error.
      */
     size_t getDdr4BasedDdimmSize(
-        types::BinaryVector::const_iterator i_iterator);
+        types::BinaryView::iterator i_iterator);
 
     /**
      * @brief This function calculates DDR5 based die per package
@@ -115,7 +115,7 @@ class DdimmVpdParser : public ParserInterface
                          uint8_t i_minValue, uint8_t i_maxValue);
 
     // VPD file to be parsed
-    const types::BinaryVector& m_vpdVector;
+    const types::BinaryView m_vpdVector;
 
     // Stores parsed VPD data.
     types::DdimmVpdMap m_parsedVpdMap{};
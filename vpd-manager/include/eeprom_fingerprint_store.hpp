@@ -0,0 +1,252 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vpd
+{
+/**
+ * @brief Class to keep fingerprints of EEPROMs whose VPD is on D-Bus.
+ *
+ * A fingerprint is a hash of the VPD bytes read from the EEPROM, along with
+ * the type of parser the VPD is parsed with and a hash of the EEPROM's entry in
+ * the system config JSON. VPD recollection skips parse and publish of an EEPROM
+ * whose fingerprint has not changed since its VPD was last published.
+ *
+ * Fingerprints are persisted to a file, so that they survive a restart of the
+ * service. A fingerprint has to be dropped by calling invalidate() whenever
+ * VPD of the EEPROM is removed from D-Bus. Fingerprint of an EEPROM whose VPD
+ * is only queued to be published is kept pending, till the outcome is known.
+ */
+class EepromFingerprintStore
+{
+  public:
+    /**
+     * @brief Structure to hold fingerprint of an EEPROM.
+     */
+    struct Fingerprint
+    {
+        // Hash of VPD bytes read from the EEPROM.
+        uint64_t m_contentHash{0};
+
+        // Type of parser the VPD is parsed with.
+        std::string m_parserType;
+
+        // Hash of the EEPROM's entry in system config JSON.
+        uint64_t m_configHash{0};
+
+        bool operator==(const Fingerprint&) const = default;
+    };
+
+    // Deleted APIs
+    EepromFingerprintStore() = delete;
+    EepromFingerprintStore(const EepromFingerprintStore&) = delete;
+    EepromFingerprintStore& operator=(const EepromFingerprintStore&) = delete;
+    EepromFingerprintStore(EepromFingerprintStore&&) = delete;
+    EepromFingerprintStore& operator=(EepromFingerprintStore&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * Persisted fingerprints are loaded on first use.
+     *
+     * @param[in] i_storeFilePath - File to persist fingerprints to.
+     */
+    explicit EepromFingerprintStore(const std::string& i_storeFilePath);
+
+    /**
+     * @brief API to get the store instance.
+     *
+     * Instance persists fingerprints to constants::eepromFingerprintFile.
+     *
+     * @return Shared pointer to the store.
+     */
+    static std::shared_ptr<EepromFingerprintStore> getStoreInstance();
+
+    /**
+     * @brief API to compute fingerprint of an EEPROM.
+     *
+     * Reads VPD of the EEPROM, starting from its offset in system config JSON.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_sysCfgJsonObj - System config JSON object.
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return Fingerprint of the EEPROM, std::nullopt in case of error.
+     */
+    static std::optional<Fingerprint> computeFingerprint(
+        const std::string& i_vpdFilePath, const nlohmann::json& i_sysCfgJsonObj,
+        uint16_t& o_errCode) noexcept;
+
+    /**
+     * @brief API to check if an EEPROM is unchanged since its VPD was
+     * published.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_fingerprint - Current fingerprint of the EEPROM.
+     *
+     * @return true if the stored fingerprint matches, false otherwise.
+     */
+    bool isUnchanged(const std::string& i_vpdFilePath,
+                     const Fingerprint& i_fingerprint) noexcept;
+
+    /**
+     * @brief API to store fingerprint of an EEPROM whose VPD got published.
+     *
+     * Change is persisted on next call to save().
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_fingerprint - Fingerprint of the EEPROM.
+     */
+    void update(const std::string& i_vpdFilePath,
+                const Fingerprint& i_fingerprint) noexcept;
+
+    /**
+     * @brief API to store fingerprint of an EEPROM whose VPD is queued to be
+     * published.
+     *
+     * Fingerprint is not used by isUnchanged() till confirmPending() finds
+     * the VPD published. Stored fingerprint of the EEPROM, if any, is dropped.
+     * Change is persisted on next call to save() or confirmPending().
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_fingerprint - Fingerprint of the EEPROM.
+     */
+    void setPending(const std::string& i_vpdFilePath,
+                    const Fingerprint& i_fingerprint) noexcept;
+
+    /**
+     * @brief API to store pending fingerprints, once outcome of publishing
+     * the VPD is known.
+     *
+     * Fingerprints of EEPROMs whose VPD failed to publish are dropped. Change
+     * is persisted right away.
+     *
+     * @param[in] i_failedVpdFilePaths - EEPROMs whose VPD failed to publish.
+     */
+    void confirmPending(
+        const std::unordered_set<std::string>& i_failedVpdFilePaths) noexcept;
+
+    /**
+     * @brief API to drop fingerprint of an EEPROM.
+     *
+     * Pending fingerprint of the EEPROM is dropped as well. Change is
+     * persisted right away.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     */
+    void invalidate(const std::string& i_vpdFilePath) noexcept;
+
+    /**
+     * @brief API to drop fingerprints of all EEPROMs, pending ones included.
+     *
+     * Change is persisted right away.
+     */
+    void invalidateAll() noexcept;
+
+    /**
+     * @brief API to persist fingerprints, if changed since last save.
+     *
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool save(uint16_t& o_errCode) noexcept;
+
+    /**
+     * @brief API to note the outcome of a VPD recollection.
+     *
+     * @param[in] i_skippedCount - Number of EEPROMs found unchanged.
+     * @param[in] i_processedCount - Number of EEPROMs parsed and published.
+     */
+    void setRecollectionCounts(const uint64_t i_skippedCount,
+                               const uint64_t i_processedCount) noexcept
+    {
+        m_skippedCount.store(i_skippedCount, std::memory_order_relaxed);
+        m_processedCount.store(i_processedCount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to get number of EEPROMs found unchanged in last VPD
+     * recollection.
+     *
+     * @return Skipped count.
+     */
+    uint64_t getSkippedCount() const noexcept
+    {
+        return m_skippedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to get number of EEPROMs parsed and published in last VPD
+     * recollection.
+     *
+     * @return Processed count.
+     */
+    uint64_t getProcessedCount() const noexcept
+    {
+        return m_processedCount.load(std::memory_order_relaxed);
+    }
+
+  private:
+    /**
+     * @brief API to compute FNV-1a hash of data.
+     *
+     * @param[in] i_data - Data to hash.
+     *
+     * @return Hash of the data.
+     */
+    static uint64_t getHash(types::BinaryView i_data) noexcept;
+
+    /**
+     * @brief API to load persisted fingerprints, once.
+     *
+     * Caller must hold m_mutex.
+     */
+    void loadIfRequired() noexcept;
+
+    /**
+     * @brief API to persist fingerprints.
+     *
+     * Caller must hold m_mutex.
+     *
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool persist(uint16_t& o_errCode) noexcept;
+
+    // File to persist fingerprints to.
+    std::string m_storeFilePath;
+
+    // Mutex to guard fingerprints.
+    std::mutex m_mutex;
+
+    // EEPROM path to its fingerprint.
+    std::unordered_map<std::string, Fingerprint> m_fingerprints;
+
+    // EEPROM path to its fingerprint, whose VPD is yet to be found published.
+    std::unordered_map<std::string, Fingerprint> m_pendingFingerprints;
+
+    // Tells if persisted fingerprints have been loaded.
+    bool m_isLoaded{false};
+
+    // Tells if fingerprints changed since last persisted.
+    bool m_isDirty{false};
+
+    // Number of EEPROMs found unchanged in last VPD recollection.
+    std::atomic<uint64_t> m_skippedCount{0};
+
+    // Number of EEPROMs parsed and published in last VPD recollection.
+    std::atomic<uint64_t> m_processedCount{0};
+};
+} // namespace vpd
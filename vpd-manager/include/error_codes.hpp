@@ -36,7 +36,7 @@ enum error_code
     ERROR_PROCESSING_SYSTEM_CMD,
     STANDARD_EXCEPTION,
     DBUS_FAILURE,
-    POPEN_FAILED,
+    COMMAND_SPAWN_FAILED,
     INVALID_HEXADECIMAL_VALUE_LENGTH,
     INVALID_HEXADECIMAL_VALUE,
     INVALID_INVENTORY_PATH,
@@ -52,7 +52,14 @@ enum error_code
     INVALID_KEYWORD_LENGTH,
     INVALID_VALUE_READ_FROM_DBUS,
     INVALID_VALUE_READ_FROM_EEPROM,
-    RECORD_NOT_FOUND
+    RECORD_NOT_FOUND,
+
+    // Command errors
+    COMMAND_TIMED_OUT,
+    COMMAND_FAILED,
+
+    // Config index errors
+    INVALID_CONFIG_INDEX
 };
 
 const std::unordered_map<int, std::string> errorCodeMap = {
@@ -82,6 +89,8 @@ const std::unordered_map<int, std::string> errorCodeMap = {
     {error_code::NO_EEPROM_PATH, "EEPROM path not found."},
     {error_code::INVALID_LOCATION_CODE_FORMAT,
      "Malformed location code format found."},
+    {error_code::INVALID_CONFIG_INDEX,
+     "Config index is either corrupt or not generated from the JSON in use."},
     {error_code::DEVICE_NOT_PRESENT,
      "Presence pin read successfully but device was absent."},
     {error_code::DEVICE_PRESENCE_UNKNOWN, "Exception on presence line GPIO."},
@@ -95,17 +104,21 @@ const std::unordered_map<int, std::string> errorCodeMap = {
     {error_code::FILE_SYSTEM_ERROR, "File system error."},
     {error_code::INVALID_KEYWORD_LENGTH, "Invalid keyword length."},
     {error_code::INVALID_VALUE_READ_FROM_DBUS, "Invalid value read from DBus"},
+    {error_code::INVALID_VALUE_READ_FROM_EEPROM,
+     "Value read from EEPROM doesn't match the value expected."},
     {error_code::RECORD_NOT_FOUND, "Record not found."},
     {error_code::FAILED_TO_DETECT_LOCATION_CODE_TYPE,
      "Failed to detect location code type"},
     {error_code::DBUS_FAILURE, "Dbus call failed"},
     {error_code::RECEIVED_INVALID_KWD_TYPE_FROM_DBUS,
      "Received invalid keyword data type from DBus."},
-    {error_code::POPEN_FAILED, "popen failed"},
+    {error_code::COMMAND_SPAWN_FAILED, "Failed to spawn command."},
     {error_code::INVALID_HEXADECIMAL_VALUE_LENGTH,
      "Invalid hexadecimal value length."},
     {error_code::INVALID_HEXADECIMAL_VALUE, "Invalid hexadecimal value."},
     {error_code::INVALID_INVENTORY_PATH, "Invalid inventory path."},
     {error_code::SERVICE_RUNNING, "Service is running"},
-    {error_code::SERVICE_NOT_RUNNING, "Service is not running"}};
+    {error_code::SERVICE_NOT_RUNNING, "Service is not running"},
+    {error_code::COMMAND_TIMED_OUT, "Command timed out."},
+    {error_code::COMMAND_FAILED, "Command exited with a failure status."}};
 } // namespace vpd
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+
+namespace vpd
+{
+/**
+ * @brief Class to monitor edge event file descriptors on an io context.
+ *
+ * All the watched descriptors, e.g. event fds of GPIO lines requested for edge
+ * events, are added to a single epoll instance and only the epoll descriptor
+ * is registered with the io context. Hence a single wait serves any number of
+ * lines.
+ *
+ * Edges are debounced, the settle callback of a descriptor is called once no
+ * further edge is seen on it for the debounce time.
+ */
+class GpioEdgeMonitor
+{
+  public:
+    // Deleted APIs
+    GpioEdgeMonitor() = delete;
+    GpioEdgeMonitor(const GpioEdgeMonitor&) = delete;
+    GpioEdgeMonitor& operator=(const GpioEdgeMonitor&) = delete;
+    GpioEdgeMonitor(GpioEdgeMonitor&&) = delete;
+    GpioEdgeMonitor& operator=(GpioEdgeMonitor&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_ioContext - IO context on which events are handled.
+     * @param[in] i_debounceTime - Time a descriptor has to stay quiet after an
+     * edge, before its settle callback is called.
+     *
+     * @throw std::system_error if epoll instance can't be created.
+     */
+    GpioEdgeMonitor(const std::shared_ptr<boost::asio::io_context>& i_ioContext,
+                    const std::chrono::milliseconds i_debounceTime);
+
+    /**
+     * @brief Destructor.
+     */
+    ~GpioEdgeMonitor() = default;
+
+    /**
+     * @brief API to watch a descriptor for edge events.
+     *
+     * @param[in] i_eventFd - Descriptor which turns readable on an edge. It
+     * remains owned by the caller and must be removed before being closed.
+     * @param[in] i_drainEvents - Called when descriptor is readable, must
+     * consume the pending events.
+     * @param[in] i_onSettled - Called once the edges settle.
+     *
+     * @throw std::system_error, std::invalid_argument
+     */
+    void addWatch(const int i_eventFd, std::function<void()> i_drainEvents,
+                  std::function<void()> i_onSettled);
+
+    /**
+     * @brief API to stop watching a descriptor.
+     *
+     * Pending settle callback of the descriptor is dropped.
+     *
+     * @param[in] i_eventFd - Descriptor to stop watching.
+     */
+    void removeWatch(const int i_eventFd) noexcept;
+
+    /**
+     * @brief API to get number of watched descriptors.
+     *
+     * @return Number of watched descriptors.
+     */
+    size_t getWatchCount() const noexcept
+    {
+        return m_watches.size();
+    }
+
+  private:
+    /**
+     * @brief Structure to hold a watched descriptor.
+     */
+    struct Watch
+    {
+        // Callback to consume pending events.
+        std::function<void()> m_drainEvents;
+
+        // Callback once the edges settle.
+        std::function<void()> m_onSettled;
+
+        // Timer to debounce the edges.
+        std::unique_ptr<boost::asio::steady_timer> m_debounceTimer;
+    };
+
+    /**
+     * @brief API to wait for the epoll descriptor to turn readable.
+     */
+    void waitForEvents();
+
+    /**
+     * @brief API to handle events of the ready descriptors.
+     *
+     * @param[in] i_errorCode - Error code of the wait.
+     */
+    void handleEvents(const boost::system::error_code& i_errorCode);
+
+    /**
+     * @brief API to handle expiry of debounce timer of a descriptor.
+     *
+     * @param[in] i_errorCode - Error code of the wait.
+     * @param[in] i_eventFd - Descriptor whose timer expired.
+     */
+    void handleDebounceExpiry(const boost::system::error_code& i_errorCode,
+                              const int i_eventFd);
+
+    // IO context on which events are handled.
+    std::shared_ptr<boost::asio::io_context> m_ioContext;
+
+    // Time a descriptor has to stay quiet after an edge.
+    std::chrono::milliseconds m_debounceTime;
+
+    // Epoll descriptor, owned and closed by the stream descriptor.
+    boost::asio::posix::stream_descriptor m_epollDescriptor;
+
+    // Watched descriptor to its watch.
+    std::map<int, Watch> m_watches;
+};
+} // namespace vpd
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "config_manager.hpp"
+#include "gpio_edge_monitor.hpp"
 #include "utility/common_utility.hpp"
 #include "utility/event_logger_utility.hpp"
 #include "worker.hpp"
 
 #include <boost/asio/steady_timer.hpp>
+#include <gpiod.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/asio/connection.hpp>
 
@@ -20,6 +22,9 @@ namespace vpd
  * monitors the presence of the FRU. If it detects any change, performs
  * deletion of FRU VPD if FRU is not present, otherwise performs VPD
  * collection if FRU gets added.
+ *
+ * Presence line is requested for edge events, which are delivered through the
+ * edge monitor. Line is polled periodically only if it can't deliver events.
  */
 class GpioEventHandler
 {
@@ -37,14 +42,18 @@ class GpioEventHandler
      * @param[in] i_fruPath - EEPROM path of the FRU.
      * @param[in] i_configManager - Pointer to Config manager object.
      * @param[in] i_ioContext - pointer to the io context object.
+     * @param[in] i_edgeMonitor - Monitor for presence line edge events, line
+     * is polled if null.
      *
      * @throw std::runtime_error
      */
     GpioEventHandler(
         const std::string i_fruPath,
         const std::shared_ptr<ConfigManager>& i_configManager,
-        const std::shared_ptr<boost::asio::io_context>& i_ioContext) :
-        m_fruPath(i_fruPath), m_configManager(i_configManager)
+        const std::shared_ptr<boost::asio::io_context>& i_ioContext,
+        const std::shared_ptr<GpioEdgeMonitor>& i_edgeMonitor = nullptr) :
+        m_fruPath(i_fruPath), m_configManager(i_configManager),
+        m_ioContext(i_ioContext), m_edgeMonitor(i_edgeMonitor)
     {
         if (m_fruPath.empty())
         {
@@ -64,7 +73,7 @@ class GpioEventHandler
                 "ASIO ioContext can not be null. It is mandatory for GpioEventHandle instantiation");
         }
 
-        const auto l_configJsonResult = m_configManager->getJsonObj(m_fruPath);
+        auto l_configJsonResult = m_configManager->getJsonSnapshot(m_fruPath);
 
         if (!l_configJsonResult.has_value())
         {
@@ -74,7 +83,7 @@ class GpioEventHandler
                 commonUtility::getErrCodeMsg(l_configJsonResult.error())));
         }
 
-        m_configJson = l_configJsonResult.value().get();
+        m_configJson = std::move(l_configJsonResult.value());
         setEventHandlerForGpioPresence(i_ioContext);
     }
 
@@ -93,14 +102,39 @@ class GpioEventHandler
     /**
      * @brief An API to set event handler for FRUs GPIO presence.
      *
-     * An API to set timer to call event handler to detect GPIO presence
-     * of the FRU.
+     * Presence line is monitored for edge events if possible, otherwise a
+     * timer is set to poll the line. Line is polled as well if initial
+     * presence can't be read.
      *
      * @param[in] i_ioContext - pointer to io context object
      */
     void setEventHandlerForGpioPresence(
         const std::shared_ptr<boost::asio::io_context>& i_ioContext);
 
+    /**
+     * @brief API to request presence line for edge events.
+     *
+     * @return true if line is requested and watched, false otherwise.
+     */
+    bool requestPresenceEvents() noexcept;
+
+    /**
+     * @brief API to release presence line requested for edge events.
+     */
+    void releasePresenceEvents() noexcept;
+
+    /**
+     * @brief API to handle settled edges on presence line.
+     *
+     * Takes action if the presence state differs from the last known state.
+     */
+    void handlePresenceEdge();
+
+    /**
+     * @brief API to set timer to poll the presence line.
+     */
+    void startPolling();
+
     /**
      * @brief API to handle timer expiry.
      *
@@ -117,11 +151,29 @@ class GpioEventHandler
     const std::string m_fruPath;
     const std::shared_ptr<ConfigManager>& m_configManager;
 
+    // IO context on which events are handled.
+    std::shared_ptr<boost::asio::io_context> m_ioContext;
+
+    // Monitor for presence line edge events.
+    std::shared_ptr<GpioEdgeMonitor> m_edgeMonitor;
+
+    // Presence line, when requested for edge events.
+    gpiod::line m_presenceLine;
+
+    // Name of the presence line.
+    std::string m_presencePinName;
+
+    // Line value which indicates FRU presence.
+    int m_presencePinValue = 0;
+
+    // Set once the line is being polled.
+    bool m_isPolling = false;
+
     // Preserves the GPIO pin value to compare. Default value is false.
     bool m_prevPresencePinValue = false;
 
-    // Chassis based JSON
-    nlohmann::json m_configJson;
+    // Chassis based JSON, borrowed from config snapshot.
+    types::JsonSnapshot m_configJson;
 };
 
 class GpioMonitor
@@ -188,6 +240,9 @@ class GpioMonitor
         const std::shared_ptr<boost::asio::io_context>& i_ioContext,
         const std::shared_ptr<ConfigManager>& i_configManager);
 
+    // Monitor for edge events of all presence lines.
+    std::shared_ptr<GpioEdgeMonitor> m_edgeMonitor;
+
     // Array of event handlers for all the attachable FRUs.
     std::vector<std::shared_ptr<GpioEventHandler>> m_gpioEventHandlerObjects;
 };
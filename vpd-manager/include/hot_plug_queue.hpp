@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to serve FRU presence changes off the D-Bus event loop.
+ *
+ * Presence changes are posted per FRU and handled by worker threads once the
+ * FRU has seen no further change for the coalesce time. A FRU flapping within
+ * that time is hence handled once, for its final presence state. Changes of a
+ * FRU are never handled concurrently, a change posted while the FRU is being
+ * handled waits for it to finish.
+ *
+ * Number of FRUs with a pending change is bounded, posting fails when full.
+ */
+class HotPlugQueue
+{
+  public:
+    /**
+     * @brief Handler of a presence change.
+     *
+     * Called on a worker thread with inventory path and presence state of the
+     * FRU.
+     */
+    using Handler = std::function<void(const std::string& i_inventoryPath,
+                                       const bool i_isPresent)>;
+
+    // Deleted APIs
+    HotPlugQueue() = delete;
+    HotPlugQueue(const HotPlugQueue&) = delete;
+    HotPlugQueue& operator=(const HotPlugQueue&) = delete;
+    HotPlugQueue(HotPlugQueue&&) = delete;
+    HotPlugQueue& operator=(HotPlugQueue&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_handler - Handler of presence changes.
+     * @param[in] i_threadCount - Number of worker threads.
+     * @param[in] i_coalesceTime - Time a FRU has to stay unchanged before its
+     * change is handled.
+     * @param[in] i_maxPendingFrus - Upper limit on FRUs with a pending change.
+     *
+     * @throw std::invalid_argument, std::system_error
+     */
+    HotPlugQueue(Handler i_handler, const size_t i_threadCount,
+                 const std::chrono::milliseconds i_coalesceTime,
+                 const size_t i_maxPendingFrus);
+
+    /**
+     * @brief Destructor.
+     *
+     * Waits for changes being handled, pending changes are dropped.
+     */
+    ~HotPlugQueue();
+
+    /**
+     * @brief API to post a presence change of a FRU.
+     *
+     * Replaces the pending change of the FRU, if any, and restarts its
+     * coalesce time.
+     *
+     * @param[in] i_inventoryPath - Inventory path of the FRU.
+     * @param[in] i_isPresent - Presence state of the FRU.
+     *
+     * @return true if posted, false if the queue is full or stopping.
+     */
+    bool post(const std::string& i_inventoryPath,
+              const bool i_isPresent) noexcept;
+
+    /**
+     * @brief API to get number of FRUs with a pending change.
+     *
+     * @return Number of pending changes.
+     */
+    size_t getPendingCount() const noexcept;
+
+    /**
+     * @brief API to get number of changes replaced by a later change of the
+     * same FRU.
+     *
+     * @return Number of coalesced changes.
+     */
+    uint64_t getCoalescedCount() const noexcept
+    {
+        return m_coalescedCount.load(std::memory_order_relaxed);
+    }
+
+  private:
+    /**
+     * @brief Structure to hold a pending presence change.
+     */
+    struct PendingChange
+    {
+        // Presence state of the FRU.
+        bool m_isPresent{false};
+
+        // Time at which the change is due for handling.
+        std::chrono::steady_clock::time_point m_dueTime;
+    };
+
+    /**
+     * @brief API run by worker threads till the queue is stopped.
+     */
+    void serve() noexcept;
+
+    // Handler of presence changes.
+    Handler m_handler;
+
+    // Time a FRU has to stay unchanged before its change is handled.
+    std::chrono::milliseconds m_coalesceTime;
+
+    // Upper limit on FRUs with a pending change.
+    size_t m_maxPendingFrus;
+
+    // Mutex to guard pending and in flight changes.
+    mutable std::mutex m_mutex;
+
+    // Notified on post, on completion of a change and on stop.
+    std::condition_variable m_cv;
+
+    // Inventory path to its pending change.
+    std::unordered_map<std::string, PendingChange> m_pendingChanges;
+
+    // Inventory paths whose change is being handled.
+    std::unordered_set<std::string> m_inFlightPaths;
+
+    // Set to stop worker threads.
+    bool m_isStopping{false};
+
+    // Number of changes replaced by a later change of the same FRU.
+    std::atomic<uint64_t> m_coalescedCount{0};
+
+    // Worker threads.
+    std::vector<std::thread> m_threads;
+};
+} // namespace vpd
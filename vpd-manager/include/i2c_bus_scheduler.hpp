@@ -0,0 +1,229 @@
+#pragma once
+
+#include "collection_thread_pool.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace vpd
+{
+/**
+ * @brief Class to schedule EEPROM access tasks based on their I2C bus.
+ *
+ * EEPROM paths of at24 devices encode the I2C bus and address of the device,
+ * e.g. /sys/bus/i2c/drivers/at24/<bus>-<addr>/eeprom. Tasks are queued per
+ * physical I2C bus, where the bus of a device behind a mux is the bus the mux
+ * sits on. At most a configured number of tasks of a bus are submitted to the
+ * thread pool at a time, the next task of the bus is submitted when one of its
+ * tasks completes. This keeps the pool threads spread across buses instead of
+ * piling up on a single bus.
+ *
+ * Tasks of devices behind a mux listed under "muxes" of the system config JSON
+ * are queued after the other tasks of the bus and the mux is enabled, if not
+ * done already, before such a task is submitted.
+ *
+ * Tasks of non I2C devices are not capped.
+ */
+class I2cBusScheduler
+{
+  public:
+    // Deleted APIs
+    I2cBusScheduler() = delete;
+    I2cBusScheduler(const I2cBusScheduler&) = delete;
+    I2cBusScheduler& operator=(const I2cBusScheduler&) = delete;
+    I2cBusScheduler(I2cBusScheduler&&) = delete;
+    I2cBusScheduler& operator=(I2cBusScheduler&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_threadPool - Thread pool on which tasks are run. Pool tasks
+     * refer to the scheduler, hence the pool must be joined before the
+     * scheduler is destroyed.
+     * @param[in] i_maxReadersPerBus - Maximum tasks of a bus running at a
+     * time, minimum of 1.
+     * @param[in] i_muxes - "muxes" array of the system config JSON.
+     */
+    I2cBusScheduler(CollectionThreadPool& i_threadPool,
+                    const size_t i_maxReadersPerBus,
+                    const nlohmann::json& i_muxes = nlohmann::json::array());
+
+    /**
+     * @brief API to schedule a task accessing the given EEPROM.
+     *
+     * Task is run on the caller's thread if the pool rejects it.
+     *
+     * @param[in] i_eepromPath - EEPROM accessed by the task.
+     * @param[in] i_task - Task to run.
+     *
+     * @throw std::runtime_error if task is empty.
+     */
+    void submit(const std::string& i_eepromPath, std::function<void()> i_task);
+
+    /**
+     * @brief API to set the muxes tasks may sit behind.
+     *
+     * Replaces muxes set earlier, muxes get enabled again before the next
+     * task behind them. Must be called when no task is queued or running.
+     *
+     * @param[in] i_muxes - "muxes" array of the system config JSON.
+     */
+    void setMuxes(const nlohmann::json& i_muxes);
+
+    /**
+     * @brief API to reset the utilisation statistics.
+     *
+     * Statistics are collected from the time of this call.
+     */
+    void resetStatistics() noexcept;
+
+    /**
+     * @brief API to get per bus utilisation since last reset, as a string.
+     *
+     * @return Utilisation of each bus in a human readable form.
+     */
+    std::string getBusUtilisationString() const;
+
+    /**
+     * @brief API to get maximum number of tasks of a bus which ran at a time.
+     *
+     * @param[in] i_eepromPath - Any EEPROM path on the bus.
+     *
+     * @return Peak number of running tasks of the bus since last reset.
+     */
+    size_t getPeakReaderCount(const std::string& i_eepromPath) const;
+
+    /**
+     * @brief API to get I2C bus number from an EEPROM path.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     *
+     * @return Bus number, or -1 if the path is not of an I2C device.
+     */
+    static int getI2cBusFromPath(const std::string& i_eepromPath) noexcept;
+
+  private:
+    /**
+     * @brief Structure to hold a queued task.
+     */
+    struct PendingTask
+    {
+        // Task to run.
+        std::function<void()> m_task;
+
+        // Hold idle path of mux the device sits behind, empty if none.
+        std::string m_muxHoldIdlePath;
+    };
+
+    /**
+     * @brief Structure to hold state of a physical bus.
+     */
+    struct BusState
+    {
+        // Tasks of devices directly on the bus.
+        std::deque<PendingTask> m_directTasks;
+
+        // Tasks of devices behind a mux, run after direct tasks.
+        std::deque<PendingTask> m_gatedTasks;
+
+        // Number of tasks of the bus running now.
+        size_t m_activeReaders{0};
+
+        // Maximum number of tasks of the bus which ran at a time.
+        size_t m_peakReaders{0};
+
+        // Number of tasks run on the bus.
+        size_t m_completedTasks{0};
+
+        // Sum of time spent by the tasks of the bus.
+        std::chrono::steady_clock::duration m_busyTime{};
+    };
+
+    /**
+     * @brief Structure to identify physical bus and mux of a device.
+     */
+    struct BusInfo
+    {
+        // Key of the physical bus.
+        std::string m_busKey;
+
+        // Hold idle path of mux the device sits behind, empty if none.
+        std::string m_muxHoldIdlePath;
+    };
+
+    /**
+     * @brief API to find physical bus and mux of an EEPROM.
+     *
+     * Mux topology is resolved through sysfs, bus of the EEPROM itself is
+     * considered as the physical bus if it can't be resolved.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     *
+     * @return Bus details of the EEPROM.
+     */
+    BusInfo getBusInfo(const std::string& i_eepromPath) const;
+
+    /**
+     * @brief API to submit queued tasks of a bus, as allowed by the cap.
+     *
+     * Must be called with m_mutex held. A task rejected by the pool is run on
+     * the caller's thread, with the lock released.
+     *
+     * @param[in] i_busKey - Key of the physical bus.
+     * @param[in,out] io_lock - Lock on m_mutex.
+     */
+    void dispatch(const std::string& i_busKey,
+                  std::unique_lock<std::mutex>& io_lock) noexcept;
+
+    /**
+     * @brief API to run a task and account it against its bus.
+     *
+     * Mux the task's device sits behind is enabled first, if needed. Must be
+     * called without m_mutex held.
+     *
+     * @param[in] i_busKey - Key of the physical bus.
+     * @param[in] i_pendingTask - Task to run.
+     */
+    void runTask(const std::string& i_busKey,
+                 const PendingTask& i_pendingTask) noexcept;
+
+    /**
+     * @brief API to enable a mux, if not enabled already.
+     *
+     * Enabling involves sysfs access, hence must be called without m_mutex
+     * held.
+     *
+     * @param[in] i_holdIdlePath - Hold idle path of the mux.
+     */
+    void enableMux(const std::string& i_holdIdlePath) noexcept;
+
+    // Thread pool on which tasks are run.
+    CollectionThreadPool& m_threadPool;
+
+    // Maximum tasks of a bus running at a time.
+    const size_t m_maxReadersPerBus;
+
+    // Mux device name (<bus>-<addr>) to its hold idle path.
+    std::map<std::string, std::string> m_muxHoldIdlePaths;
+
+    // Hold idle path of mux to flag set once the mux is enabled. Populated
+    // only while no task is queued or running, hence looked up without lock.
+    std::map<std::string, std::once_flag> m_muxEnableFlags;
+
+    // Mutex to guard the bus states.
+    mutable std::mutex m_mutex;
+
+    // Physical bus key to its state.
+    std::map<std::string, BusState> m_busStates;
+
+    // Time since when the statistics are collected.
+    std::chrono::steady_clock::time_point m_statisticsStartTime;
+};
+} // namespace vpd
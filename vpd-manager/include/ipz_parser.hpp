@@ -1,11 +1,13 @@
 #pragma once
 
+#include "ipz_vpd_view.hpp"
 #include "logger.hpp"
 #include "parser_interface.hpp"
 #include "types.hpp"
 
-#include <fstream>
+#include <map>
 #include <string_view>
+#include <unordered_map>
 
 namespace vpd
 {
@@ -28,28 +30,17 @@ class IpzVpdParser : public ParserInterface
     /**
      * @brief Constructor.
      *
-     * @param[in] vpdVector - VPD data.
+     * @param[in] vpdVector - View of VPD data, which needs to outlive the
+     * parser.
      * @param[in] vpdFilePath - Path to VPD EEPROM.
      * @param[in] vpdStartOffset - Offset from where VPD starts in the file.
      * Defaulted to 0.
      */
-    IpzVpdParser(const types::BinaryVector& vpdVector,
+    IpzVpdParser(types::BinaryView vpdVector,
                  const std::string& vpdFilePath, size_t vpdStartOffset = 0) :
         m_vpdVector(vpdVector), m_vpdFilePath(vpdFilePath),
         m_vpdStartOffset(vpdStartOffset)
-    {
-        try
-        {
-            m_vpdFileStream.exceptions(
-                std::ifstream::badbit | std::ifstream::failbit);
-            m_vpdFileStream.open(vpdFilePath, std::ios::in | std::ios::out |
-                                                  std::ios::binary);
-        }
-        catch (const std::fstream::failure& e)
-        {
-            Logger::getLoggerInstance()->logMessage(e.what());
-        }
-    }
+    {}
 
     /**
      * @brief Default destructor.
@@ -62,10 +53,47 @@ class IpzVpdParser : public ParserInterface
      * Note: Caller needs to check validity of the map returned. Throws
      * exception in certain situation, needs to be handled accordingly.
      *
+     * Parsed map is moved to the caller, hence the API can be called only
+     * once on an instance. A second call throws DataException.
+     *
      * @return parsed VPD data.
      */
     virtual types::VPDMapVariant parse() override;
 
+    /**
+     * @brief API to parse IPZ VPD file into a non-owning view.
+     *
+     * Performs the same header, VTOC and ECC checks as parse(), but only
+     * records location of every keyword instead of copying record names,
+     * keyword names and values into a map.
+     *
+     * Note: Returned view refers to the VPD data passed to the constructor,
+     * which needs to outlive the view.
+     *
+     * @return Parsed VPD as IpzVpdView.
+     *
+     * @throw DataException, EccException
+     */
+    IpzVpdView parseToView();
+
+    /**
+     * @brief API to get value of a keyword without parsing the whole VPD.
+     *
+     * On first call, VHDR and VTOC are validated and an index of record
+     * details is built from VTOC's PT keyword. A record is ECC checked and
+     * decoded only when one of its keywords is first asked for, later lookups
+     * in the same record are served from the decoded record.
+     *
+     * @param[in] i_recordName - Record name.
+     * @param[in] i_keywordName - Keyword name.
+     *
+     * @return Keyword's value.
+     *
+     * @throw DataException, EccException, std::runtime_error
+     */
+    std::string getKeywordValue(const types::Record& i_recordName,
+                                const types::Keyword& i_keywordName);
+
     /**
      * @brief API to check validity of VPD header.
      *
@@ -75,7 +103,7 @@ class IpzVpdParser : public ParserInterface
      * Don't change the parameter to reference as movement of passsed iterator
      * to an offset is not required after header check.
      */
-    void checkHeader(types::BinaryVector::const_iterator itrToVPD);
+    void checkHeader(types::BinaryView::iterator itrToVPD);
 
     /**
      * @brief API to read keyword's value from hardware
@@ -106,10 +134,70 @@ class IpzVpdParser : public ParserInterface
      */
     int writeKeywordOnHardware(const types::WriteVpdParams i_paramsToWriteData);
 
+    /**
+     * @brief Structure to hold update of a record by a keyword write.
+     */
+    struct RecordUpdate
+    {
+        // Record's offset, length, ECC offset and ECC length from VTOC.
+        types::RecordData m_recordDetails;
+
+        // Record's data with the keywords' new value set.
+        types::BinaryVector m_recordData;
+
+        // Offset in VPD and data of the record's changed keyword ranges.
+        // Keywords adjacent or overlapping in the record share a range.
+        std::vector<std::pair<size_t, types::BinaryVector>> m_keywordRanges;
+
+        // Number of bytes of keywords' value set in the record.
+        int m_sizeSet{0};
+    };
+
+    /**
+     * @brief API to get the records updated by writing the given keywords.
+     *
+     * Nothing is written on hardware and records' ECC is not computed, which
+     * is left to writeKeywordsOnHardware.
+     *
+     * @param[in] i_keywordsToWrite - List of record, keyword and value.
+     *
+     * @throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument.
+     * @throw sdbusplus::xyz::openbmc_project::Common::Error::NotAllowed.
+     * @throw DataException
+     *
+     * @return Record name to its update.
+     */
+    std::map<types::Record, RecordUpdate> getRecordUpdates(
+        const std::vector<types::IpzData>& i_keywordsToWrite);
+
+    /**
+     * @brief API to write value of multiple keywords on hardware.
+     *
+     * Keywords are grouped on record, so ECC of every record is computed once
+     * for all its keywords. Changed ranges of all records are then written
+     * together.
+     *
+     * @param[in] i_keywordsToWrite - List of record, keyword and value.
+     *
+     * @throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument.
+     * @throw sdbusplus::xyz::openbmc_project::Common::Error::NotAllowed.
+     * @throw DataException
+     * @throw EccException
+     *
+     * @return On success returns number of bytes written on hardware, On
+     * failure throws exception.
+     */
+    int writeKeywordsOnHardware(
+        const std::vector<types::IpzData>& i_keywordsToWrite);
+
     /**
      * @brief Compares the parsed VPD data in this instance with that of
      *        the provided redundant VPD parser.
      *
+     * Both VPDs are parsed alongside each other. Records are compared
+     * byte-wise and keywords are diffed only for records whose bytes differ.
+     * Differences found are logged as a single report.
+     *
      * @param[in] i_redundantParser - Shared pointer to redundant parser
      * instance.
      *
@@ -142,7 +230,7 @@ class IpzVpdParser : public ParserInterface
      * @param[in] iterator - Iterator to the record.
      * @return success/failure
      */
-    bool recordEccCheck(types::BinaryVector::const_iterator iterator);
+    bool recordEccCheck(types::BinaryView::iterator iterator);
 
     /**
      * @brief API to read VTOC record.
@@ -155,7 +243,7 @@ class IpzVpdParser : public ParserInterface
      * @param[in] itrToVPD - Iterator to beginning of VPD data.
      * @return Length of PT keyword.
      */
-    auto readTOC(types::BinaryVector::const_iterator& itrToVPD);
+    auto readTOC(types::BinaryView::iterator& itrToVPD);
 
     /**
      * @brief API to read PT record.
@@ -168,7 +256,7 @@ class IpzVpdParser : public ParserInterface
      * records found during parsing
      */
     std::pair<types::RecordOffsetList, types::InvalidRecordList> readPT(
-        types::BinaryVector::const_iterator& itrToPT, auto ptLength);
+        types::BinaryView::iterator& itrToPT, auto ptLength);
 
     /**
      * @brief API to read keyword data based on its encoding type.
@@ -179,7 +267,7 @@ class IpzVpdParser : public ParserInterface
      * @return keyword data, empty otherwise.
      */
     std::string readKwData(std::string_view kwdName, std::size_t kwdDataLength,
-                           types::BinaryVector::const_iterator itrToKwdData);
+                           types::BinaryView::iterator itrToKwdData);
 
     /**
      * @brief API to read keyword and its value under a record.
@@ -188,7 +276,19 @@ class IpzVpdParser : public ParserInterface
      * @return keyword-value map of keywords under that record.
      */
     types::IPZVpdMap::mapped_type readKeywords(
-        types::BinaryVector::const_iterator& itrToKwds);
+        types::BinaryView::iterator& itrToKwds);
+
+    /**
+     * @brief API to get location of all keywords under a record.
+     *
+     * @param[in] i_recordOffset - Offset of the record in VPD.
+     * @param[in,out] io_entries - List to append record's keyword entries to.
+     *
+     * @throw DataException
+     */
+    void readRecordEntries(
+        size_t i_recordOffset,
+        std::vector<IpzVpdView::KeywordEntry>& io_entries) const;
 
     /**
      * @brief API to process a record.
@@ -197,6 +297,28 @@ class IpzVpdParser : public ParserInterface
      */
     void processRecord(auto recordOffset);
 
+    /**
+     * @brief API to build index of records listed in VTOC's PT keyword.
+     *
+     * Validates VHDR and VTOC, including their ECC, and notes offset, length
+     * and ECC details of every record without decoding any of them. Index is
+     * built only once per parser instance.
+     *
+     * @throw DataException, EccException
+     */
+    void buildRecordIndex();
+
+    /**
+     * @brief API to get keywords of a record, decoding it on first access.
+     *
+     * @param[in] i_recordName - Record name.
+     *
+     * @return keyword-value map of keywords under that record.
+     *
+     * @throw DataException, EccException, std::runtime_error
+     */
+    const types::IPZKwdValueMap& getRecord(const types::Record& i_recordName);
+
     /**
      * @brief Get keyword's value from record
      *
@@ -234,29 +356,24 @@ class IpzVpdParser : public ParserInterface
      * This API is required to update the record's ECC based on the record's
      * current data.
      *
-     * @param[in] i_recordDataOffset - Record's data offset
-     * @param[in] i_recordDataLength - Record's data length
-     * @param[in] i_recordECCOffset - Record's ECC offset
-     * @param[in] i_recordECCLength - Record's ECC length
-     * @param[in,out] io_vpdVector - FRU VPD in vector to update record's ECC.
+     * @param[in] i_recordData - Record's data.
+     * @param[in,out] io_recordECC - Buffer of record's ECC length, to hold the
+     * updated ECC.
      *
      * @throw EccException
      */
-    void updateRecordECC(const auto& i_recordDataOffset,
-                         const auto& i_recordDataLength,
-                         const auto& i_recordECCOffset,
-                         size_t i_recordECCLength,
-                         types::BinaryVector& io_vpdVector);
+    void updateRecordECC(const types::BinaryVector& i_recordData,
+                         types::BinaryVector& io_recordECC);
 
     /**
-     * @brief API to set record's keyword's value on hardware.
+     * @brief API to set record's keyword's value in record's data.
      *
      * @param[in] i_recordName - Record name.
      * @param[in] i_keywordName - Keyword name.
      * @param[in] i_keywordData - Keyword data.
-     * @param[in] i_recordDataOffset - Offset to record's data.
-     * @param[in,out] io_vpdVector - FRU VPD in vector to read and write
-     * keyword's value.
+     * @param[in,out] io_recordData - Record's data, starting at record's
+     * offset, to read and set keyword's value.
+     * @param[out] o_kwdDataOffset - Offset of keyword's value in record.
      *
      * @throw DataException
      *
@@ -265,8 +382,23 @@ class IpzVpdParser : public ParserInterface
     int setKeywordValueInRecord(const types::Record& i_recordName,
                                 const types::Keyword& i_keywordName,
                                 const types::BinaryVector& i_keywordData,
-                                const types::RecordOffset& i_recordDataOffset,
-                                types::BinaryVector& io_vpdVector);
+                                types::BinaryVector& io_recordData,
+                                size_t& o_kwdDataOffset);
+
+    /**
+     * @brief API to write changed ranges of VPD on hardware.
+     *
+     * Ranges are written through VpdImage::writeRanges, which reads them
+     * back to verify the write.
+     *
+     * @param[in] i_dirtyRanges - List of offset in VPD and data to write at
+     * that offset.
+     *
+     * @throw DataException
+     */
+    void writeRangesOnHardware(
+        const std::vector<std::pair<size_t, types::BinaryView>>&
+            i_dirtyRanges);
 
     /**
      * @brief API to process list of invalid records found during parsing
@@ -283,28 +415,20 @@ class IpzVpdParser : public ParserInterface
         const types::InvalidRecordList& i_invalidRecordList) const noexcept;
 
     /**
-     * @brief Get the list of missing keywords from one VPD map compared to
-     * another.
-     *
-     * This function compares the keys present in i_mapToCompare against those
-     * present in i_mapToCompareWith. Any keys that exist in i_mapToCompareWith
-     * but are absent in i_mapToCompare are collected and returned as a list of
-     * missing keyword strings.
+     * @brief API to check if a record is byte-wise identical in this VPD and
+     * another one.
      *
-     * @param[in] i_mapToCompareWith - VPD map whose keys are considered
-     * mandatory.
-     * @param[in] i_mapToCompare - VPD map that will be checked for missing
-     * keys.
+     * Record is compared within its ECC protected bounds, as listed in VTOC of
+     * the respective VPD. Record index of both parsers must be built.
      *
-     * @return A vector of keyword strings that are present in
-     * i_mapToCompareWith but missing from i_mapToCompare. Returns an empty
-     * vector if none are missing.
+     * @param[in] i_otherParser - Parser of the VPD to compare with.
+     * @param[in] i_recordName - Record name.
      *
-     * @throw std::bad_variant_access
+     * @return true if the record is listed in both VPDs with same length and
+     * bytes, false otherwise.
      */
-    std::vector<std::string> getMissingDataFromMap(
-        const types::IpzVpdMapVariant& i_mapToCompareWith,
-        const types::IpzVpdMapVariant& i_mapToCompare) const;
+    bool isRecordIdentical(const IpzVpdParser& i_otherParser,
+                           const types::Record& i_recordName) const noexcept;
 
     /**
      * @brief Generate a formatted string representing VPD comparison
@@ -336,17 +460,23 @@ class IpzVpdParser : public ParserInterface
         const types::RecordKeywordsMap& i_mismatchedVpd) const noexcept;
 
     // Holds VPD data.
-    const types::BinaryVector& m_vpdVector;
+    const types::BinaryView m_vpdVector;
 
     // stores parsed VPD data.
     types::IPZVpdMap m_parsedVPDMap{};
 
+    // Record name to record's details from VTOC, filled by buildRecordIndex.
+    std::unordered_map<types::Record, types::RecordData> m_recordIndex{};
+
+    // Tells if m_recordIndex has been built.
+    bool m_isRecordIndexBuilt = false;
+
+    // Tells if parse() has handed over the parsed map.
+    bool m_isParsed = false;
+
     // Holds the VPD file path
     const std::string& m_vpdFilePath;
 
-    // Stream to the VPD file. Required to correct ECC
-    std::fstream m_vpdFileStream;
-
     // VPD start offset. Required for ECC correction.
     size_t m_vpdStartOffset = 0;
 };
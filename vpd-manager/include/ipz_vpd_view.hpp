@@ -0,0 +1,123 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to represent parsed IPZ VPD without owning any of its data.
+ *
+ * Parsed VPD is kept as a flat list of (record, keyword, offset, length)
+ * entries, sorted on record and keyword name. Names and values are views into
+ * the VPD image that was parsed, so the image must outlive this object.
+ *
+ * Lookups accept std::string_view and don't allocate. Callers which still need
+ * the nested map form can get it through toIpzVpdMap().
+ */
+class IpzVpdView
+{
+  public:
+    /**
+     * @brief Structure to hold location of a keyword in VPD image.
+     */
+    struct KeywordEntry
+    {
+        // Name of the record containing the keyword.
+        std::string_view m_record;
+
+        // Name of the keyword.
+        std::string_view m_keyword;
+
+        // Offset of keyword's value from start of VPD.
+        size_t m_offset{0};
+
+        // Length of keyword's value.
+        size_t m_length{0};
+    };
+
+    /**
+     * @brief Constructor
+     *
+     * Creates an empty view.
+     */
+    IpzVpdView() = default;
+
+    /**
+     * @brief Constructor
+     *
+     * Entries are sorted on record and keyword name. For duplicate
+     * record/keyword pairs, the entry found first in the image takes
+     * precedence, same as the map returned by IpzVpdParser::parse().
+     *
+     * @param[in] i_vpdVector - View of the parsed VPD image.
+     * @param[in] i_entries - Keyword entries found in the image.
+     */
+    IpzVpdView(types::BinaryView i_vpdVector,
+               std::vector<KeywordEntry>&& i_entries);
+
+    /**
+     * @brief API to get value of a keyword.
+     *
+     * @param[in] i_record - Record name.
+     * @param[in] i_keyword - Keyword name.
+     *
+     * @return View of keyword's value if found, std::nullopt otherwise.
+     */
+    std::optional<std::string_view> getKeywordValue(
+        std::string_view i_record, std::string_view i_keyword) const noexcept;
+
+    /**
+     * @brief API to check if a record is present.
+     *
+     * @param[in] i_record - Record name.
+     *
+     * @return true if the record has at least one keyword, false otherwise.
+     */
+    bool hasRecord(std::string_view i_record) const noexcept;
+
+    /**
+     * @brief API to get all keyword entries.
+     *
+     * @return Sorted list of keyword entries.
+     */
+    const std::vector<KeywordEntry>& getEntries() const noexcept
+    {
+        return m_entries;
+    }
+
+    /**
+     * @brief API to get value of a keyword entry.
+     *
+     * @param[in] i_entry - Keyword entry of this view.
+     *
+     * @return View of keyword's value.
+     */
+    std::string_view getValue(const KeywordEntry& i_entry) const noexcept
+    {
+        return std::string_view(
+            reinterpret_cast<const char*>(m_vpdVector.data()) +
+                i_entry.m_offset,
+            i_entry.m_length);
+    }
+
+    /**
+     * @brief API to convert the view to IPZ VPD map.
+     *
+     * @return Parsed VPD in IPZ VPD map form.
+     *
+     * @throw std::bad_alloc
+     */
+    types::IPZVpdMap toIpzVpdMap() const;
+
+  private:
+    // View of the parsed VPD image.
+    types::BinaryView m_vpdVector;
+
+    // Keyword entries sorted on record and keyword name.
+    std::vector<KeywordEntry> m_entries;
+};
+} // namespace vpd
@@ -29,7 +29,7 @@ class JedecSpdParser : public ParserInterface
      *
      * @param[in] i_spdVector - JEDEC SPD data.
      */
-    explicit JedecSpdParser(const types::BinaryVector& i_spdVector) :
+    explicit JedecSpdParser(types::BinaryView i_spdVector) :
         m_memSpd(i_spdVector)
     {}
 
@@ -50,7 +50,7 @@ class JedecSpdParser : public ParserInterface
      * @return- map of kwd:value
      */
     types::JedecSpdMap readKeywords(
-        types::BinaryVector::const_iterator& i_iterator);
+        types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function calculates DIMM size from DDR4 SPD
@@ -58,7 +58,7 @@ class JedecSpdParser : public ParserInterface
      * @param[in] i_iterator - iterator to buffer containing SPD
      * @return calculated size or 0 in case of any error.
      */
-    auto getDDR4DimmCapacity(types::BinaryVector::const_iterator& i_iterator);
+    auto getDDR4DimmCapacity(types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function calculates part number from DDR4 SPD
@@ -67,7 +67,7 @@ class JedecSpdParser : public ParserInterface
      * @return calculated part number or a default value.
      */
     std::string_view getDDR4PartNumber(
-        types::BinaryVector::const_iterator& i_iterator);
+        types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function calculates serial number from DDR4 SPD
@@ -76,7 +76,7 @@ class JedecSpdParser : public ParserInterface
      * @return calculated serial number or a default value.
      */
     std::string getDDR4SerialNumber(
-        types::BinaryVector::const_iterator& i_iterator);
+        types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function allocates FRU number based on part number
@@ -90,7 +90,7 @@ class JedecSpdParser : public ParserInterface
      */
     std::string_view getDDR4FruNumber(
         const std::string& i_partNumber,
-        types::BinaryVector::const_iterator& i_iterator);
+        types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function allocates CCIN based on part number for DDR4 SPD
@@ -113,7 +113,7 @@ class JedecSpdParser : public ParserInterface
      * @param[in] i_iterator - iterator to buffer containing SPD
      * @return calculated size or 0 in case of any error.
      */
-    auto getDDR5DimmCapacity(types::BinaryVector::const_iterator& i_iterator);
+    auto getDDR5DimmCapacity(types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function calculates part number from DDR5 SPD
@@ -121,7 +121,7 @@ class JedecSpdParser : public ParserInterface
      * @param[in] i_iterator - iterator to buffer containing SPD
      * @return calculated part number or a default value.
      */
-    auto getDDR5PartNumber(types::BinaryVector::const_iterator& i_iterator);
+    auto getDDR5PartNumber(types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function calculates serial number from DDR5 SPD
@@ -129,7 +129,7 @@ class JedecSpdParser : public ParserInterface
      * @param[in] i_iterator - iterator to buffer containing SPD
      * @return calculated serial number.
      */
-    auto getDDR5SerialNumber(types::BinaryVector::const_iterator& i_iterator);
+    auto getDDR5SerialNumber(types::BinaryView::iterator& i_iterator);
 
     /**
      * @brief This function allocates FRU number based on part number
@@ -151,7 +151,7 @@ class JedecSpdParser : public ParserInterface
     auto getDDR5CCIN(const std::string& i_partNumber);
 
     // SPD file to be parsed
-    const types::BinaryVector& m_memSpd;
+    const types::BinaryView m_memSpd;
 };
 
 } // namespace vpd
@@ -31,7 +31,7 @@ class KeywordVpdParser : public ParserInterface
      * @param[in] i_kwVpdVector - VPD data to be parsed
      * @param[in] i_vpdFilePath - Path to VPD EEPROM file
      */
-    KeywordVpdParser(const types::BinaryVector& i_kwVpdVector,
+    KeywordVpdParser(types::BinaryView i_kwVpdVector,
                      const std::string& i_vpdFilePath = "") :
         m_keywordVpdVector(i_kwVpdVector), m_vpdFilePath(i_vpdFilePath),
         m_vpdIterator(m_keywordVpdVector.begin()),
@@ -115,8 +115,8 @@ class KeywordVpdParser : public ParserInterface
      * @param[in] i_checkSumEnd - VPD iterator pointing at checksum end value
      * @throw DataException - checksum invalid, check VPD
      */
-    void validateChecksum(types::BinaryVector::const_iterator i_checkSumStart,
-                          types::BinaryVector::const_iterator i_checkSumEnd);
+    void validateChecksum(types::BinaryView::iterator i_checkSumStart,
+                          types::BinaryView::iterator i_checkSumEnd);
 
     /**
      * @brief It reads 2 bytes from current VPD pointer
@@ -171,7 +171,7 @@ class KeywordVpdParser : public ParserInterface
     void updateChecksum(types::BinaryVector& io_vpdVector);
 
     /*Vector of keyword VPD data*/
-    const types::BinaryVector& m_keywordVpdVector;
+    const types::BinaryView m_keywordVpdVector;
 
     /*Path to VPD file*/
     const std::string m_vpdFilePath;
@@ -180,7 +180,7 @@ class KeywordVpdParser : public ParserInterface
     std::fstream m_vpdFileStream;
 
     /*Iterator to VPD data*/
-    types::BinaryVector::const_iterator m_vpdIterator;
+    types::BinaryView::iterator m_vpdIterator;
 
     // Shared pointer to Logger object
     std::shared_ptr<Logger> m_logger;
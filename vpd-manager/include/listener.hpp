@@ -2,6 +2,7 @@
 
 #include "config_manager.hpp"
 #include "constants.hpp"
+#include "hot_plug_queue.hpp"
 #include "types.hpp"
 
 #include <nlohmann/json.hpp>
@@ -119,6 +120,15 @@ class Listener
     void presentPropertyChangeCallback(
         sdbusplus::message_t& i_msg) const noexcept;
 
+    /**
+     * @brief API to collect or delete VPD of a FRU on presence change.
+     *
+     * @param[in] i_inventoryPath - Inventory path of the FRU.
+     * @param[in] i_isPresent - Presence state of the FRU.
+     */
+    void processPresenceChange(const std::string& i_inventoryPath,
+                               const bool i_isPresent) const noexcept;
+
     /**
      * @brief API which is called when correlated property change is detected
      *
@@ -184,5 +194,9 @@ class Listener
 
     // A map of {service name,{interface name,match object}}
     types::MatchObjectMap m_matchObjectMap;
+
+    // Queue serving presence changes, declared last so that its threads are
+    // joined before other members go away.
+    std::unique_ptr<HotPlugQueue> m_hotPlugQueue;
 };
 } // namespace vpd
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vpd
+{
+/**
+ * @brief Class to index expanded location codes of inventory objects.
+ *
+ * The index maps an expanded location code to the inventory path(s) which
+ * carry it, and an inventory path to its expanded location code. It is fed
+ * with the LocationCode property of inventory objects, either from the object
+ * maps vpd-manager publishes or from inventory signals, so that lookups by
+ * location code don't need to read the inventory over D-Bus.
+ *
+ * Index can be updated and queried from multiple threads.
+ */
+class LocationCodeIndex
+{
+  public:
+    // Deleted APIs
+    LocationCodeIndex(const LocationCodeIndex&) = delete;
+    LocationCodeIndex& operator=(const LocationCodeIndex&) = delete;
+    LocationCodeIndex(LocationCodeIndex&&) = delete;
+    LocationCodeIndex& operator=(LocationCodeIndex&&) = delete;
+
+    /**
+     * @brief Constructor, creates an empty index.
+     */
+    LocationCodeIndex() = default;
+
+    /**
+     * @brief API to set expanded location code of an inventory object.
+     *
+     * Any location code previously set for the object is replaced.
+     *
+     * @param[in] i_inventoryPath - Inventory path.
+     * @param[in] i_expandedLocationCode - Expanded location code.
+     */
+    void update(const std::string& i_inventoryPath,
+                const std::string& i_expandedLocationCode) noexcept;
+
+    /**
+     * @brief API to update index from interfaces of an inventory object.
+     *
+     * Object is indexed only if it has LocationCode property under the
+     * location code interface, other interfaces are ignored.
+     *
+     * @param[in] i_inventoryPath - Inventory path, either absolute or relative
+     * to inventory root.
+     * @param[in] i_interfaceMap - Interfaces of the object.
+     */
+    void update(const std::string& i_inventoryPath,
+                const types::InterfaceMap& i_interfaceMap) noexcept;
+
+    /**
+     * @brief API to update index from an object map.
+     *
+     * @param[in] i_objectMap - Object map, as published on PIM.
+     */
+    void update(const types::ObjectMap& i_objectMap) noexcept;
+
+    /**
+     * @brief API to drop an inventory object from the index.
+     *
+     * @param[in] i_inventoryPath - Inventory path.
+     */
+    void remove(const std::string& i_inventoryPath) noexcept;
+
+    /**
+     * @brief API to get inventory paths of an expanded location code.
+     *
+     * @param[in] i_expandedLocationCode - Expanded location code.
+     *
+     * @return Inventory paths sorted by path, empty if none.
+     */
+    types::ListOfPaths getInventoryPaths(
+        const std::string& i_expandedLocationCode) const noexcept;
+
+    /**
+     * @brief API to get expanded location code of an inventory object.
+     *
+     * @param[in] i_inventoryPath - Inventory path.
+     *
+     * @return Expanded location code if indexed, std::nullopt otherwise.
+     */
+    std::optional<std::string> getLocationCode(
+        const std::string& i_inventoryPath) const noexcept;
+
+    /**
+     * @brief API to get number of indexed inventory objects.
+     *
+     * @return Number of objects.
+     */
+    size_t size() const noexcept;
+
+  private:
+    /**
+     * @brief API to get absolute inventory path.
+     *
+     * @param[in] i_inventoryPath - Inventory path, either absolute or relative
+     * to inventory root.
+     *
+     * @return Absolute inventory path.
+     */
+    static std::string getAbsolutePath(const std::string& i_inventoryPath);
+
+    /**
+     * @brief API to set location code of an object, with lock held.
+     *
+     * @param[in] i_inventoryPath - Absolute inventory path.
+     * @param[in] i_expandedLocationCode - Expanded location code.
+     */
+    void updateLocked(const std::string& i_inventoryPath,
+                      const std::string& i_expandedLocationCode);
+
+    /**
+     * @brief API to drop an object, with lock held.
+     *
+     * @param[in] i_inventoryPath - Absolute inventory path.
+     */
+    void removeLocked(const std::string& i_inventoryPath);
+
+    // Mutex to guard both the maps.
+    mutable std::shared_mutex m_mutex;
+
+    // Inventory path to its expanded location code.
+    std::unordered_map<std::string, std::string> m_invPathToLocCodeMap;
+
+    // Expanded location code to inventory paths carrying it.
+    std::unordered_map<std::string, std::set<std::string>>
+        m_locCodeToInvPathsMap;
+};
+} // namespace vpd
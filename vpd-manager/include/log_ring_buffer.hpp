@@ -0,0 +1,207 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace vpd
+{
+/**
+ * @brief Enum class defining what a producer does when the ring is full.
+ */
+enum class LogOverflowPolicy
+{
+    DROP_OLDEST, /* Oldest message is dropped to make space */
+    BLOCK        /* Producer waits till consumer makes space */
+};
+
+/**
+ * @brief Class implementing a bounded multi-producer single-consumer ring of
+ * log messages.
+ *
+ * The ring is an array of preallocated fixed size slots, each carrying a
+ * sequence number which tells whether the slot is free, being written or
+ * holds a message. Producers claim consecutive slots with a CAS on the tail
+ * position and copy the message in, so logging doesn't take a lock and doesn't
+ * allocate. A message longer than a slot spans multiple slots.
+ *
+ * Only one thread may pop messages at a time.
+ */
+class LogRingBuffer
+{
+  public:
+    // Deleted APIs
+    LogRingBuffer() = delete;
+    LogRingBuffer(const LogRingBuffer&) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+    LogRingBuffer(LogRingBuffer&&) = delete;
+    LogRingBuffer& operator=(LogRingBuffer&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_slotCount - Number of slots, rounded up to a power of 2.
+     * @param[in] i_overflowPolicy - What to do when the ring is full.
+     */
+    LogRingBuffer(const size_t i_slotCount,
+                  const LogOverflowPolicy i_overflowPolicy);
+
+    /**
+     * @brief Destructor.
+     */
+    ~LogRingBuffer() = default;
+
+    /**
+     * @brief API to push a message to the ring.
+     *
+     * Message longer than MAX_SLOTS_PER_MESSAGE slots is truncated.
+     *
+     * @param[in] i_message - Message.
+     * @param[in] i_time - Time the message is logged at.
+     */
+    void push(std::string_view i_message,
+              const std::chrono::system_clock::time_point i_time) noexcept;
+
+    /**
+     * @brief API to pop the oldest message from the ring.
+     *
+     * Must not be called by more than one thread at a time.
+     *
+     * @param[out] o_message - Message, its capacity is reused.
+     * @param[out] o_time - Time the message was logged at.
+     *
+     * @return true if a message is popped, false if the ring is empty or the
+     * oldest message is still being written.
+     *
+     * @throw std::bad_alloc
+     */
+    bool pop(std::string& o_message,
+             std::chrono::system_clock::time_point& o_time);
+
+    /**
+     * @brief API to check if the ring has no message.
+     *
+     * Messages being written by producers are counted as present.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool isEmpty() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) ==
+               m_tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief API to get number of messages dropped on overflow.
+     *
+     * @return Dropped message count.
+     */
+    uint64_t getDroppedCount() const noexcept
+    {
+        return m_droppedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to get number of slots in the ring.
+     *
+     * @return Slot count.
+     */
+    size_t getSlotCount() const noexcept
+    {
+        return m_mask + 1;
+    }
+
+    // Bytes of message a single slot carries.
+    static constexpr size_t SLOT_PAYLOAD_SIZE = 232;
+
+    // Maximum number of slots a message can span.
+    static constexpr size_t MAX_SLOTS_PER_MESSAGE = 16;
+
+  private:
+    /**
+     * @brief Structure of a slot.
+     *
+     * Sequence of a slot at position p is p when free, p + 1 once the
+     * message is written. It is set to p + number of slots in the ring once the
+     * message is read, which makes it free for the next round. Length, slot
+     * count and time are valid only in first slot of a message.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> m_sequence{0};
+        std::atomic<uint32_t> m_slotCount{0};
+        uint32_t m_length{0};
+        int64_t m_time{0};
+        char m_payload[SLOT_PAYLOAD_SIZE]{};
+    };
+
+    /**
+     * @brief API to get slot at a position.
+     *
+     * @param[in] i_position - Position.
+     *
+     * @return Slot.
+     */
+    Slot& getSlot(const uint64_t i_position) noexcept
+    {
+        return m_slots[i_position & m_mask];
+    }
+
+    /**
+     * @brief API to check if a message starting at a position is fully
+     * written.
+     *
+     * @param[in] i_position - Position of first slot of the message.
+     * @param[out] o_slotCount - Number of slots the message spans.
+     *
+     * @return true if written, false otherwise.
+     */
+    bool isMessageReady(const uint64_t i_position,
+                        uint32_t& o_slotCount) noexcept;
+
+    /**
+     * @brief API to make slots of a claimed message free for next round.
+     *
+     * @param[in] i_position - Position of first slot.
+     * @param[in] i_slotCount - Number of slots.
+     */
+    void releaseSlots(const uint64_t i_position,
+                      const uint32_t i_slotCount) noexcept;
+
+    /**
+     * @brief API to drop the oldest message to make space.
+     *
+     * @return true if a message is dropped, false if the oldest message isn't
+     * fully written yet or is claimed by someone else.
+     */
+    bool dropOldest() noexcept;
+
+    // Slots of the ring.
+    std::unique_ptr<Slot[]> m_slots;
+
+    // Slot count - 1, slot count is a power of 2.
+    uint64_t m_mask{0};
+
+    // What to do when the ring is full.
+    LogOverflowPolicy m_overflowPolicy;
+
+    // Position of next slot to write.
+    alignas(64) std::atomic<uint64_t> m_tail{0};
+
+    // Position of oldest unread slot.
+    alignas(64) std::atomic<uint64_t> m_head{0};
+
+    // Bumped whenever slots are released, blocked producers wait on it.
+    std::atomic<uint32_t> m_releaseCount{0};
+
+    // Whether any producer is waiting for release of slots.
+    std::atomic_bool m_hasBlockedProducers{false};
+
+    // Number of messages dropped on overflow.
+    std::atomic<uint64_t> m_droppedCount{0};
+};
+} // namespace vpd
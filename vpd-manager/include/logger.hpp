@@ -1,16 +1,23 @@
 #pragma once
 
+#include "collection_log_record.hpp"
+#include "log_ring_buffer.hpp"
 #include "types.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <shared_mutex>
 #include <source_location>
 #include <string_view>
+#include <thread>
 
 namespace vpd
 {
@@ -35,6 +42,15 @@ enum class PlaceHolder
     SYNC_PEL_WITH_DEVICE_CALLOUT   /* Creates sync PEL with device callouts*/
 };
 
+/**
+ * @brief Enum class defining format of a log file.
+ */
+enum class LogFileFormat
+{
+    TEXT,  /* Timestamped line per message */
+    BINARY /* Messages written as they are */
+};
+
 /**
  * @brief Class to handle file operations w.r.t logging.
  * Based on the placeholder the class will handle different file operations to
@@ -86,27 +102,31 @@ class ILogFileHandler
                     const size_t i_maxEntries);
 
     /**
-     * @brief API to generate timestamp in string format.
+     * @brief API to generate timestamp of a time point in string format.
+     *
+     * @param[in] i_time - Time point.
      *
      * @return Returns timestamp in string format on success, otherwise returns
      * empty string in case of any error.
      */
-    static inline std::string timestamp() noexcept
+    static inline std::string timestamp(
+        const std::chrono::system_clock::time_point& i_time) noexcept
     {
         try
         {
-            const auto l_now = std::chrono::system_clock::now();
             const auto l_in_time_t =
-                std::chrono::system_clock::to_time_t(l_now);
+                std::chrono::system_clock::to_time_t(i_time);
             const auto l_ms =
                 std::chrono::duration_cast<std::chrono::milliseconds>(
-                    l_now.time_since_epoch()) %
+                    i_time.time_since_epoch()) %
                 1000;
 
+            std::tm l_localTime{};
+            localtime_r(&l_in_time_t, &l_localTime);
+
             std::stringstream l_ss;
-            l_ss << std::put_time(std::localtime(&l_in_time_t),
-                                  "%Y-%m-%d %H:%M:%S")
-                 << "." << std::setfill('0') << std::setw(3) << l_ms.count();
+            l_ss << std::put_time(&l_localTime, "%Y-%m-%d %H:%M:%S") << "."
+                 << std::setfill('0') << std::setw(3) << l_ms.count();
             return l_ss.str();
         }
         catch (const std::exception& l_ex)
@@ -115,6 +135,17 @@ class ILogFileHandler
         }
     }
 
+    /**
+     * @brief API to generate current timestamp in string format.
+     *
+     * @return Returns timestamp in string format on success, otherwise returns
+     * empty string in case of any error.
+     */
+    static inline std::string timestamp() noexcept
+    {
+        return timestamp(std::chrono::system_clock::now());
+    }
+
   public:
     // deleted methods
     ILogFileHandler() = delete;
@@ -133,6 +164,16 @@ class ILogFileHandler
     virtual void logMessage(
         [[maybe_unused]] const std::string_view& i_message) = 0;
 
+    /**
+     * @brief API to get number of messages dropped by the handler.
+     *
+     * @return Dropped message count.
+     */
+    virtual uint64_t getDroppedCount() const noexcept
+    {
+        return 0;
+    }
+
     // destructor
     virtual ~ILogFileHandler()
     {
@@ -196,23 +237,44 @@ class SyncFileLogger final : public ILogFileHandler
  * @brief A class to handle asynchronous logging of messages to file
  *
  * This class implements methods to log messages asynchronously to a desired
- * file in the filesystem. It uses a queue for buffering the messages from
- * caller. The actual file operations are handled by a worker thread.
+ * file in the filesystem. Messages from callers are buffered in a bounded
+ * lock-free ring of preallocated slots, so logging from multiple threads
+ * neither contends on a lock nor allocates. The actual file operations are
+ * handled by a worker thread, which writes all buffered messages with a single
+ * flush per batch.
+ *
+ * In binary format messages are written without timestamp or separator, the
+ * caller is responsible for framing them.
  */
 class AsyncFileLogger final : public ILogFileHandler
 {
-    // queue for log messages
-    std::queue<std::string> m_messageQueue;
-
-    // mutex to control access to log message queue
-    std::mutex m_mutex;
+    // ring of buffered log messages
+    LogRingBuffer m_ringBuffer;
 
     // flag which indicates log worker thread if logging is finished
     std::atomic_bool m_stopLogging{false};
 
+    // flag which indicates log worker thread is waiting for messages
+    std::atomic_bool m_isWorkerWaiting{false};
+
+    // mutex for log worker thread to wait on
+    std::mutex m_mutex;
+
     // conditional variable to signal log worker thread
     std::condition_variable m_cv;
 
+    // format of the log file
+    LogFileFormat m_fileFormat;
+
+    // log worker thread
+    std::thread m_worker;
+
+    // number of slots in the message ring
+    static constexpr size_t RING_SLOT_COUNT = 512;
+
+    // max time a message stays buffered when worker thread is idle
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{100};
+
     /**
      * @brief Constructor
      * Private so that can't be initialized by class(es) other than friends.
@@ -220,13 +282,22 @@ class AsyncFileLogger final : public ILogFileHandler
      * @param[in] i_fileName - Name of the log file
      * @param[in] i_maxEntries - Maximum number of entries in the log file after
      * which the file will be rotated
+     * @param[in] i_fileFormat - Format of the log file
+     * @param[in] i_overflowPolicy - What to do when messages are logged faster
+     * than they are written to file and the ring is full
+     * @param[in] i_slotCount - Number of slots in the message ring
      */
-    AsyncFileLogger(const std::filesystem::path& i_fileName,
-                    const size_t i_maxEntries) :
-        ILogFileHandler(i_fileName, i_maxEntries)
+    AsyncFileLogger(
+        const std::filesystem::path& i_fileName, const size_t i_maxEntries,
+        const LogFileFormat i_fileFormat = LogFileFormat::TEXT,
+        const LogOverflowPolicy i_overflowPolicy = LogOverflowPolicy::BLOCK,
+        const size_t i_slotCount = RING_SLOT_COUNT) :
+        ILogFileHandler(i_fileName, i_maxEntries),
+        m_ringBuffer(i_slotCount, i_overflowPolicy),
+        m_fileFormat(i_fileFormat)
     {
-        // start worker thread in detached mode
-        std::thread{[this]() { this->fileWorker(); }}.detach();
+        // start worker thread
+        m_worker = std::thread{[this]() { this->fileWorker(); }};
     }
 
     /**
@@ -238,6 +309,9 @@ class AsyncFileLogger final : public ILogFileHandler
     // Friend class Logger.
     friend class Logger;
 
+    // Test fixture, creates the logger with a small ring.
+    friend class AsyncFileLoggerTest;
+
     // deleted methods
     AsyncFileLogger() = delete;
     AsyncFileLogger(const AsyncFileLogger&) = delete;
@@ -249,26 +323,37 @@ class AsyncFileLogger final : public ILogFileHandler
      * @brief API to log a message to file
      *
      * This API logs given message to a file. This API is multi-thread safe.
+     * Message longer than LogRingBuffer::MAX_SLOTS_PER_MESSAGE slots is
+     * truncated.
      *
      * @param[in] i_message - Message to log
-     *
-     * @throw std::runtime_error
      */
     void logMessage(const std::string_view& i_message) override;
 
+    /**
+     * @brief API to get number of messages dropped as the ring was full.
+     *
+     * @return Dropped message count.
+     */
+    uint64_t getDroppedCount() const noexcept override
+    {
+        return m_ringBuffer.getDroppedCount();
+    }
+
     // destructor
     ~AsyncFileLogger()
     {
-        std::unique_lock<std::mutex> l_lock(m_mutex);
-
-        m_stopLogging = true;
-
-        if (m_fileStream.is_open())
         {
-            m_fileStream.close();
+            std::scoped_lock l_lock(m_mutex);
+            m_stopLogging = true;
         }
-
         m_cv.notify_one();
+
+        // worker thread writes all buffered messages before it exits
+        if (m_worker.joinable())
+        {
+            m_worker.join();
+        }
     }
 };
 
@@ -315,6 +400,26 @@ class Logger
         const std::source_location& i_location =
             std::source_location::current()) noexcept;
 
+    /**
+     * @brief API to log a VPD collection event.
+     *
+     * With binary collection log, the event is written as fixed size records
+     * and formatted only when the log is decoded by vpd-tool. Otherwise it is
+     * formatted and logged as a collection message.
+     *
+     * @param[in] i_event - Event.
+     * @param[in] i_fruPath - FRU path the event is for.
+     * @param[in] i_errorCode - Error code, event specific.
+     * @param[in] i_value - Value, event specific.
+     * @param[in] i_payload - Payload, event specific.
+     * @param[in] i_location - Location from where event is logged.
+     */
+    void logEvent(const collectionLog::Event i_event,
+                  std::string_view i_fruPath, const int32_t i_errorCode = 0,
+                  const uint32_t i_value = 0, std::string_view i_payload = {},
+                  const std::source_location& i_location =
+                      std::source_location::current()) noexcept;
+
     /*
      * @brief API to set the dbus connection for Logger class.
      *
@@ -335,8 +440,25 @@ class Logger
      */
     void terminateVpdCollectionLogging() noexcept
     {
+        if (m_collectionLogger && m_collectionLogger->getDroppedCount() != 0)
+        {
+            logMessage(std::to_string(m_collectionLogger->getDroppedCount()) +
+                       " VPD collection log message(s) dropped.");
+        }
+
         m_collectionLogger.reset();
     }
+
+    /**
+     * @brief API to get number of dropped VPD collection log messages.
+     *
+     * @return Dropped message count of current collection log, 0 if no
+     * collection is being logged.
+     */
+    uint64_t getCollectionLogDroppedCount() const noexcept
+    {
+        return m_collectionLogger ? m_collectionLogger->getDroppedCount() : 0;
+    }
 #endif
 
   private:
@@ -347,6 +469,8 @@ class Logger
     {
 #ifdef ENABLE_FILE_LOGGING
         m_collectionLogger = nullptr;
+        m_isBinaryCollectionLog = isBinaryCollectionLogRequested();
+        m_collectionLogOverflowPolicy = getCollectionLogOverflowPolicy();
 #endif
     }
 
@@ -361,9 +485,72 @@ class Logger
      */
     void initiateVpdCollectionLogging() noexcept;
 
+    /**
+     * @brief API to check if binary VPD collection log is requested.
+     *
+     * Requested by the binary_collection_log build option, which can be
+     * overridden by setting VPD_BINARY_COLLECTION_LOG in the environment.
+     *
+     * @return true if requested, false otherwise.
+     */
+    static bool isBinaryCollectionLogRequested() noexcept;
+
+    /**
+     * @brief API to get overflow policy of VPD collection log.
+     *
+     * Given by the collection_log_overflow build option, which can be
+     * overridden by setting VPD_COLLECTION_LOG_OVERFLOW to "block" or
+     * "drop_oldest" in the environment.
+     *
+     * @return Overflow policy.
+     */
+    static LogOverflowPolicy getCollectionLogOverflowPolicy() noexcept;
+
+    /**
+     * @brief API to get index of a string in binary collection log.
+     *
+     * String seen first time gets the next index and is written to the log as
+     * a definition, before the index can be used by any other thread.
+     *
+     * @param[in] i_string - FRU path or source file name.
+     *
+     * @return Index, collectionLog::NO_STRING_INDEX if string is empty or the
+     * table is full.
+     */
+    uint16_t getStringIndex(std::string_view i_string) noexcept;
+
+    /**
+     * @brief API to write an event to binary collection log.
+     *
+     * Payload which doesn't fit a record is split across records.
+     *
+     * @param[in] i_event - Event.
+     * @param[in] i_fruIndex - Index of FRU path in string table.
+     * @param[in] i_errorCode - Error code.
+     * @param[in] i_value - Value.
+     * @param[in] i_payload - Payload.
+     */
+    void writeCollectionRecords(const collectionLog::Event i_event,
+                                const uint16_t i_fruIndex,
+                                const int32_t i_errorCode,
+                                const uint32_t i_value,
+                                std::string_view i_payload) noexcept;
+
     // logger object to handle VPD collection logs
     std::unique_ptr<ILogFileHandler> m_collectionLogger;
 
+    // Set if VPD collection is logged in binary format.
+    bool m_isBinaryCollectionLog{false};
+
+    // What collection logging does when messages outpace the file writes.
+    LogOverflowPolicy m_collectionLogOverflowPolicy{LogOverflowPolicy::BLOCK};
+
+    // Mutex to guard the string table.
+    std::shared_mutex m_stringTableMutex;
+
+    // String to its index in binary collection log.
+    std::map<std::string, uint16_t, std::less<>> m_stringTable;
+
 #endif
 
     // Dbus connection
@@ -4,6 +4,7 @@
 #include "config_manager.hpp"
 #include "constants.hpp"
 #include "gpio_monitor.hpp"
+#include "location_code_index.hpp"
 #include "logger.hpp"
 #include "thread_manager.hpp"
 #include "types.hpp"
@@ -71,6 +72,32 @@ class Manager
     int updateKeyword(const types::Path i_vpdPath,
                       const types::WriteVpdParams i_paramsToWriteData);
 
+    /**
+     * @brief Update value of multiple keywords.
+     *
+     * This API is used to update value of multiple keywords of an IPZ type FRU
+     * in a single request. Keywords are written on the given input path and
+     * its redundant path(s), if any taken from system config JSON, with ECC of
+     * every updated record computed once. Updated values are published on
+     * DBus together.
+     *
+     * The request succeeds or fails as a whole, there is no per keyword
+     * status. Callers needing that have to fall back to updateKeyword.
+     *
+     * Each input should be in the form of (Record, Keyword, Value).
+     * Eg: {("VINI", "SN", {0x01, 0x02}), ("VINI", "PN", {0x03, 0x04})}.
+     *
+     * @param[in] i_vpdPath - Path (inventory object path/FRU EEPROM path).
+     * @param[in] i_keywordsToUpdate - List of keywords to update.
+     *
+     * @return On success returns number of bytes written, on failure returns
+     * -1.
+     *
+     * @throw xyz.openbmc_project.Common.Error.InvalidArgument
+     */
+    int updateKeywords(const types::Path i_vpdPath,
+                       const std::vector<types::IpzData> i_keywordsToUpdate);
+
     /**
      * @brief Update keyword value on hardware.
      *
@@ -317,6 +344,86 @@ class Manager
      */
     void readVpdCollectionMode() noexcept;
 
+    /**
+     * @brief API to parse VPD of a FRU EEPROM into D-Bus format.
+     *
+     * @param[in] i_fruPath - FRU EEPROM path.
+     * @param[in] i_sysCfgJsonObj - System config JSON object.
+     *
+     * @throw xyz.openbmc_project.Common.Error.InvalidArgument
+     * @throw std::exception
+     *
+     * @return Parsed VPD as ParsedVpdMap variant.
+     */
+    types::ParsedVpdMap parseVpdForDbus(
+        const types::Path& i_fruPath,
+        const nlohmann::json& i_sysCfgJsonObj) const;
+
+    /**
+     * @brief API to borrow config JSON of a path.
+     *
+     * JSON is borrowed from the current config snapshot, not copied.
+     *
+     * @param[in] i_vpdPath - EEPROM or inventory object path.
+     *
+     * @return Config JSON of the path, empty JSON if not found.
+     */
+    types::JsonSnapshot getConfigJson(
+        const std::string& i_vpdPath) const noexcept;
+
+    /**
+     * @brief API to get FRU path to be updated for a given path.
+     *
+     * @param[in] i_vpdPath - EEPROM or inventory object path.
+     * @param[in] i_sysCfgJsonObj - Config JSON of the path.
+     *
+     * @return EEPROM path of the FRU from config JSON, if found. Given path
+     * otherwise.
+     */
+    types::Path getFruPathToUpdate(
+        const types::Path& i_vpdPath,
+        const nlohmann::json& i_sysCfgJsonObj) const noexcept;
+
+    /**
+     * @brief API to keep location code index in sync with the inventory.
+     *
+     * Index is fed with the object maps vpd-manager publishes, and with
+     * InterfacesAdded, InterfacesRemoved and LocationCode PropertiesChanged
+     * signals of PIM for objects published by anyone else.
+     */
+    void registerLocationCodeCallbacks() noexcept;
+
+    /**
+     * @brief Callback for InterfacesAdded signal of PIM.
+     *
+     * @param[in] i_msg - Callback message.
+     */
+    void interfacesAddedCallback(sdbusplus::message_t& i_msg) noexcept;
+
+    /**
+     * @brief Callback for InterfacesRemoved signal of PIM.
+     *
+     * @param[in] i_msg - Callback message.
+     */
+    void interfacesRemovedCallback(sdbusplus::message_t& i_msg) noexcept;
+
+    /**
+     * @brief Callback for LocationCode property change of an inventory object.
+     *
+     * @param[in] i_msg - Callback message.
+     */
+    void locationCodeChangeCallback(sdbusplus::message_t& i_msg) noexcept;
+
+    /**
+     * @brief API to seed location code index from PIM.
+     *
+     * Objects published before vpd-manager started, e.g. on a restart of the
+     * service, are not seen by the signal callbacks. The API reads them once
+     * with a single GetManagedObjects call. Seeding is retried on next call if
+     * the read fails.
+     */
+    void seedLocationCodeIndex() noexcept;
+
     // Shared pointer to Listener object.
     std::shared_ptr<Listener> m_eventListener;
 
@@ -356,6 +463,16 @@ class Manager
 
     // shared pointer to Config Manager object
     std::shared_ptr<ConfigManager> m_configManager{nullptr};
+
+    // Expanded location code index of inventory objects.
+    std::shared_ptr<LocationCodeIndex> m_locationCodeIndex{
+        std::make_shared<LocationCodeIndex>()};
+
+    // Match objects keeping location code index in sync with PIM.
+    std::vector<std::shared_ptr<sdbusplus::match>> m_locationCodeMatches;
+
+    // Whether objects already on PIM are read into location code index.
+    bool m_isLocationCodeIndexSeeded{false};
 };
 
 } // namespace vpd
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <sys/stat.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace vpd
+{
+/**
+ * @brief Class to cache parsed VPD of EEPROMs in memory.
+ *
+ * Parsed VPD is kept against the EEPROM path, so that repeated GetParsedVPD
+ * calls on the same EEPROM are served without reading and parsing it again.
+ * ReadKeyword always reads hardware and doesn't use the cache.
+ *
+ * Writes through a sysfs nvmem node don't change modification time of the
+ * EEPROM file, hence an entry is only dropped by calling invalidate(). Every
+ * Parser API which writes VPD, on the primary or the redundant EEPROM, does
+ * that, and so do collection and deletion of a FRU. vpd-tool writes through
+ * those APIs of vpd-manager. Modification time, size and inode of the file
+ * are noted as well, to catch a file mode copy being replaced.
+ *
+ * Entries are shared, a reader may keep using a parsed map after the entry is
+ * invalidated.
+ */
+class ParsedVpdCache
+{
+  public:
+    // Deleted APIs
+    ParsedVpdCache(const ParsedVpdCache&) = delete;
+    ParsedVpdCache& operator=(const ParsedVpdCache&) = delete;
+    ParsedVpdCache(ParsedVpdCache&&) = delete;
+    ParsedVpdCache& operator=(ParsedVpdCache&&) = delete;
+
+    /**
+     * @brief API to get the cache instance.
+     *
+     * @return Shared pointer to the cache.
+     */
+    static std::shared_ptr<ParsedVpdCache> getCacheInstance();
+
+    /**
+     * @brief API to get parsed VPD of an EEPROM.
+     *
+     * If the EEPROM has no valid entry, the given function is called to parse
+     * the EEPROM and its result is added to the cache.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     * @param[in] i_parseFunction - Function to parse the EEPROM.
+     *
+     * @return Parsed VPD of the EEPROM.
+     *
+     * @throw Any exception thrown by i_parseFunction.
+     */
+    std::shared_ptr<const types::ParsedVpdMap> getParsedVpd(
+        const types::Path& i_eepromPath,
+        const std::function<types::ParsedVpdMap()>& i_parseFunction);
+
+    /**
+     * @brief API to drop cached VPD of an EEPROM.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     */
+    void invalidate(const types::Path& i_eepromPath) noexcept;
+
+    /**
+     * @brief API to drop cached VPD of all EEPROMs.
+     */
+    void invalidateAll() noexcept;
+
+    /**
+     * @brief API to get number of lookups served from the cache.
+     *
+     * @return Hit count.
+     */
+    uint64_t getHitCount() const noexcept
+    {
+        return m_hitCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to get number of lookups which needed a parse.
+     *
+     * @return Miss count.
+     */
+    uint64_t getMissCount() const noexcept
+    {
+        return m_missCount.load(std::memory_order_relaxed);
+    }
+
+  private:
+    /**
+     * @brief Structure to identify a version of an EEPROM file.
+     */
+    struct FileFingerprint
+    {
+        // Inode of the file.
+        ino_t m_inode{0};
+
+        // Size of the file.
+        off_t m_size{0};
+
+        // Last modification time of the file.
+        timespec m_modifiedTime{};
+    };
+
+    /**
+     * @brief Structure to hold a cache entry.
+     */
+    struct CacheEntry
+    {
+        // Parsed VPD.
+        std::shared_ptr<const types::ParsedVpdMap> m_parsedVpd;
+
+        // Fingerprint of the EEPROM file when it was parsed.
+        FileFingerprint m_fingerprint;
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    ParsedVpdCache() = default;
+
+    /**
+     * @brief API to get fingerprint of a file.
+     *
+     * @param[in] i_filePath - File path.
+     * @param[out] o_fingerprint - Fingerprint of the file.
+     *
+     * @return true on success, false otherwise.
+     */
+    static bool getFingerprint(const types::Path& i_filePath,
+                               FileFingerprint& o_fingerprint) noexcept;
+
+    /**
+     * @brief API to check if two fingerprints are of the same file version.
+     *
+     * @param[in] i_lhs - Fingerprint.
+     * @param[in] i_rhs - Fingerprint.
+     *
+     * @return true if same, false otherwise.
+     */
+    static bool isSameFingerprint(const FileFingerprint& i_lhs,
+                                  const FileFingerprint& i_rhs) noexcept;
+
+    // Mutex to guard cache entries and generation.
+    std::mutex m_mutex;
+
+    // EEPROM path to its cache entry.
+    std::unordered_map<types::Path, CacheEntry> m_entries;
+
+    // Bumped on every invalidation, so that a parse which started before an
+    // invalidation doesn't add a stale entry.
+    uint64_t m_generation{0};
+
+    // Number of lookups served from the cache.
+    std::atomic<uint64_t> m_hitCount{0};
+
+    // Number of lookups which needed a parse.
+    std::atomic<uint64_t> m_missCount{0};
+};
+} // namespace vpd
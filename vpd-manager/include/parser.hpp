@@ -26,16 +26,23 @@ class Parser
      * @brief Constructor
      *
      * @param[in] i_vpdFilePath - Path to the VPD file.
-     * @param[in] i_parsedJson - Parsed JSON.
+     * @param[in] i_parsedJson - Parsed JSON, must outlive the parser. It is
+     * referred to and not copied.
      * @param[in] i_vpdCollectionMode - VPD collection mode, default is hardware
      * mode.
      *
      * @throw std::runtime_error
      */
-    Parser(const std::string& i_vpdFilePath, nlohmann::json i_parsedJson,
+    Parser(const std::string& i_vpdFilePath,
+           const nlohmann::json& i_parsedJson,
            types::VpdCollectionMode i_vpdCollectionMode =
                types::VpdCollectionMode::DEFAULT_MODE);
 
+    // Parser refers to the JSON, a temporary would dangle.
+    Parser(const std::string& i_vpdFilePath, nlohmann::json&& i_parsedJson,
+           types::VpdCollectionMode i_vpdCollectionMode =
+               types::VpdCollectionMode::DEFAULT_MODE) = delete;
+
     /**
      * @brief API to implement a generic parsing logic.
      *
@@ -51,6 +58,8 @@ class Parser
      *
      * This API detects the VPD type based on the file path passed to the
      * constructor of the class and returns the respective parser instance.
+     * VPD is loaded on every call, and the returned instance owns the image it
+     * parses.
      *
      * @return Parser instance.
      */
@@ -99,6 +108,21 @@ class Parser
     int updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData,
                          types::DbusVariantType& o_updatedValue);
 
+    /**
+     * @brief Update value of multiple keywords.
+     *
+     * Batched form of updateVpdKeyword for IPZ type VPD. EEPROM and its
+     * redundant path(s), if any, are written once for all keywords with ECC of
+     * every record computed once. Keyword values are updated on DBus with a
+     * single publication.
+     *
+     * @param[in] i_keywordsToUpdate - List of (Record, Keyword, Value).
+     *
+     * @return On success returns number of bytes written, on failure returns
+     * -1.
+     */
+    int updateVpdKeywords(const std::vector<types::IpzData>& i_keywordsToUpdate);
+
     /**
      * @brief Update keyword value on hardware.
      *
@@ -122,8 +146,9 @@ class Parser
      * @brief Wrapper API that invokes the concrete compareData implementation
      *        based on the VPD type.
      *
-     * This API creates a ParserInterface instance and calls compareData API of
-     * respective concrete parser.
+     * This API creates a ParserInterface instance for both EEPROMs, reading
+     * them alongside each other, and calls compareData API of respective
+     * concrete parser.
      *
      * @param[in] i_redundantEepromPath - Redundant EEPROM path.
      *
@@ -162,11 +187,8 @@ class Parser
     // Base VPD file path used for JSON lookups.
     const std::string& m_vpdFilePath;
 
-    // Path to configuration file, can be empty.
-    nlohmann::json m_parsedJson;
-
-    // Vector to hold VPD.
-    types::BinaryVector m_vpdVector;
+    // Configuration JSON, can be empty.
+    const nlohmann::json& m_parsedJson;
 
     // VPD collection mode, default is hardware mode.
     types::VpdCollectionMode m_vpdCollectionMode;
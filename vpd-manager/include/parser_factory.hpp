@@ -36,6 +36,9 @@ class ParserFactory
      * Note: API throws DataException in case vpd type check fails for any
      * unknown type. Caller responsibility to handle the exception.
      *
+     * Note: Returned parser holds a view of i_vpdVector, the underlying data
+     * needs to outlive the parser object.
+     *
      * @param[in] i_vpdVector - vpd file content to check for the type.
      * @param[in] i_vpdFilePath - FRU EEPROM path.
      * @param[in] i_vpdStartOffset - Offset from where VPD starts in the VPD
@@ -44,7 +47,7 @@ class ParserFactory
      * @return - Pointer to concrete parser class object.
      */
     static std::shared_ptr<ParserInterface> getParser(
-        const types::BinaryVector& i_vpdVector,
-        const std::string& i_vpdFilePath, size_t i_vpdStartOffset);
+        types::BinaryView i_vpdVector, const std::string& i_vpdFilePath,
+        size_t i_vpdStartOffset);
 };
 } // namespace vpd
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to publish VPD of a full collection to PIM in batches.
+ *
+ * While running, object maps published by any thread through
+ * dbusUtility::publishVpdOnDBus are queued instead of being sent. A flusher
+ * thread merges the queue in arrival order and sends it to PIM once
+ * constants::MAX_OBJECTS_PER_NOTIFY objects are pending or the oldest one has
+ * waited constants::PIM_PUBLISH_FLUSH_INTERVAL_MS, whichever comes first.
+ *
+ * Merging keeps the last value of a property, hence a FRU whose progress
+ * updates land in the same batch is published with its final status only.
+ *
+ * If a batch is rejected, its objects are sent one by one to find the failing
+ * ones. A FRU whose VPD failed to publish is reported with a Failed collection
+ * status, also when its Completed status comes in a later batch.
+ */
+class PimPublisher
+{
+  public:
+    // Deleted APIs
+    PimPublisher(const PimPublisher&) = delete;
+    PimPublisher& operator=(const PimPublisher&) = delete;
+    PimPublisher(PimPublisher&&) = delete;
+    PimPublisher& operator=(PimPublisher&&) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * Stops the publisher if running.
+     */
+    ~PimPublisher();
+
+    /**
+     * @brief API to get the publisher instance.
+     *
+     * @return Shared pointer to the publisher.
+     */
+    static const std::shared_ptr<PimPublisher>& getPublisherInstance();
+
+    /**
+     * @brief API to start queuing VPD published by the process.
+     *
+     * Failed object paths of the previous run are discarded. Call has no effect
+     * if the publisher is already running.
+     *
+     * @throw std::system_error
+     */
+    void start();
+
+    /**
+     * @brief API to stop queuing and send everything queued so far.
+     *
+     * Returns once the queue is sent. VPD published after this call goes to
+     * PIM right away.
+     *
+     * @return Object paths which failed to publish since start(), sorted.
+     */
+    std::vector<std::string> stop() noexcept;
+
+    /**
+     * @brief API to check if the publisher is running.
+     *
+     * @return true if running, false otherwise.
+     */
+    bool isRunning() const noexcept;
+
+  private:
+    /**
+     * @brief Constructor.
+     */
+    PimPublisher() = default;
+
+    /**
+     * @brief API set as publish sink, queues to the publisher instance.
+     *
+     * @param[in,out] io_objectMap - Object map, moved from if queued.
+     *
+     * @return true if queued, false if the publisher is not running.
+     */
+    static bool queueObjectMap(types::ObjectMap& io_objectMap) noexcept;
+
+    /**
+     * @brief API to queue an object map.
+     *
+     * @param[in,out] io_objectMap - Object map, moved from if queued.
+     *
+     * @return true if queued, false if the publisher is not running.
+     */
+    bool queue(types::ObjectMap& io_objectMap) noexcept;
+
+    /**
+     * @brief API run by the flusher thread till the publisher is stopped.
+     */
+    void flushLoop() noexcept;
+
+    /**
+     * @brief API to send queued object maps to PIM.
+     *
+     * @param[in] i_objectMaps - Object maps in arrival order.
+     */
+    void flush(std::vector<types::ObjectMap>&& i_objectMaps) noexcept;
+
+    /**
+     * @brief API to send a batch to PIM and record failing objects.
+     *
+     * @param[in] i_batch - Objects with paths relative to PIM path.
+     */
+    void sendBatch(const types::ObjectMap& i_batch) noexcept;
+
+    // Mutex to guard the queue and run state.
+    mutable std::mutex m_mutex;
+
+    // Notified on queuing and on stop.
+    std::condition_variable m_cv;
+
+    // Object maps queued since last flush, in arrival order.
+    std::vector<types::ObjectMap> m_queue;
+
+    // Number of objects across queued object maps.
+    size_t m_queuedObjectCount{0};
+
+    // Time the oldest queued object map was queued at.
+    std::chrono::steady_clock::time_point m_oldestQueueTime;
+
+    // Set while queuing.
+    bool m_isRunning{false};
+
+    // Set to make the flusher send what is queued and exit.
+    bool m_isStopping{false};
+
+    // Object paths, relative to PIM path, which failed to publish. Accessed
+    // only by the flusher thread while it runs.
+    std::set<std::string> m_failedObjectPaths;
+
+    // Thread sending queued object maps.
+    std::thread m_flusherThread;
+};
+} // namespace vpd
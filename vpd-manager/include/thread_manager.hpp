@@ -1,16 +1,22 @@
 #pragma once
 
+#include "collection_thread_pool.hpp"
 #include "config_manager.hpp"
+#include "i2c_bus_scheduler.hpp"
 #include "types.hpp"
 #include "worker.hpp"
 
 #include <sdbusplus/asio/object_server.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <vector>
 
 namespace vpd
 {
@@ -25,8 +31,8 @@ namespace vpd
  * synchronization details.
  *
  * Its primary responsibilities include:
- * - **Concurrency Abstraction**: Starting and Managing chassis-specific thread
- * pools and task scheduling for VPD collection.
+ * - **Concurrency Abstraction**: Managing the collection thread pool shared
+ * by all chassis and task scheduling for VPD collection.
  * - **State Management**: Implementing skip logic for redundant requests,
  * completion tracking, and failure handling.
  * - **Asynchronous Communication**: Monitoring background tasks and
@@ -59,49 +65,88 @@ class ThreadManager
 
     /**
      * @brief Destructor
+     *
+     * Waits for the ongoing VPD collection, if any, to finish.
      */
-    ~ThreadManager() = default;
+    ~ThreadManager();
 
     /**
      * @brief Trigger multi-threaded VPD collection for all FRUs
      *
-     * This API spawns threads to collect VPD for all FRUs in the system
-     * in parallel. It orchestrates the collection process across all chassis
+     * This API collects VPD for all FRUs in the system in parallel on the
+     * collection thread pool. It orchestrates the collection process across all chassis
      * and their respective FRUs.
+     *
+     * Overall collection status is set to Failed if VPD of any object failed
+     * to reach PIM.
      */
     void collectAllFruVpd();
 
   private:
+    struct CollectionContext;
+
     /**
-     * @brief Context structure for FRU collection thread pool
+     * @brief Context structure for FRU collection of a chassis
      *
-     * Encapsulates shared state for parallel FRU VPD collection threads.
-     * Multiple threads share a single instance to coordinate work distribution
-     * via a shared iterator over the FRU list.
+     * Tracks FRU collection of a chassis. Every FRU of the chassis is
+     * collected by a separate task on the shared collection thread pool, all
+     * the tasks share a single instance to find when the chassis is complete.
      */
-    struct FruThreadContext
+    struct ChassisCollectionContext
     {
         /**
          * @brief Constructor
          * @param[in] i_chassisEeepromPath - Chassis EEPROM path
          * @param[in] i_chassisJson - Chassis JSON containing FRU list
-         *
-         * @throw nlohmann json exception
+         * @param[in] i_fruCount - Number of FRUs to collect
          */
-        explicit FruThreadContext(const std::string& i_chassisEeepromPath,
-                                  const nlohmann::json& i_chassisJson) :
+        explicit ChassisCollectionContext(
+            const std::string& i_chassisEeepromPath,
+            const types::JsonSnapshot& i_chassisJson,
+            const size_t i_fruCount) :
             m_chassisEeepromPath(i_chassisEeepromPath),
-            m_chassisJson(i_chassisJson),
-            m_frus(m_chassisJson["frus"]
-                       .get_ref<const nlohmann::json::object_t&>()),
-            m_fruItr(m_frus.begin())
+            m_chassisJson(i_chassisJson), m_pendingFrus(i_fruCount),
+            m_startTime(std::chrono::steady_clock::now())
         {}
 
         const std::string m_chassisEeepromPath; // Chassis EEPROM
-        const nlohmann::json m_chassisJson;     // Chassis configuration
-        const nlohmann::json::object_t& m_frus; // FRU list reference
-        nlohmann::json::object_t::const_iterator m_fruItr; // Shared iterator
-        std::mutex m_fruItrMutex; // Iterator protection
+        const types::JsonSnapshot m_chassisJson; // Chassis configuration
+        std::atomic<size_t> m_pendingFrus;      // FRUs pending collection
+        const std::chrono::steady_clock::time_point m_startTime; // FRUs start
+    };
+
+    /**
+     * @brief Context structure for a VPD collection
+     *
+     * Every collectAllFruVpd call gets its own instance, which all its tasks
+     * capture. A task outliving its collection, e.g. on timeout, can then
+     * only update the collection it belongs to.
+     */
+    struct CollectionContext
+    {
+        // Mutex to guard members below
+        std::mutex m_mutex;
+
+        // Condition variable to signal chassis result, chassis completion and
+        // task completion
+        std::condition_variable m_completionCv;
+
+        // Tracks chassis VPD collection results awaiting processing
+        std::queue<types::ChassisCollectionResult> m_chassisResultQueue;
+
+        // Number of chassis whose VPD collection, including its FRUs, is
+        // pending
+        size_t m_chassisCount{0};
+
+        // Chassis whose FRUs are being collected, for reporting on timeout
+        std::vector<std::shared_ptr<ChassisCollectionContext>>
+            m_chassisContexts;
+
+        // Number of tasks submitted to the pool and not yet finished
+        size_t m_inFlightTasks{0};
+
+        // Set once the collection is abandoned, queued tasks are skipped
+        bool m_isCancelled{false};
     };
 
 #ifdef IBM_SYSTEM
@@ -109,20 +154,22 @@ class ThreadManager
      * @brief Handle chassis having system VPD for FRUs collection.
      *
      * The API reads the Present property from D-Bus, calls updateSystemView,
-     * and pushes the result onto m_chassisResultQueue to notify the completion
-     * handler, as VPD for the chassis having system VPD is collected already.
+     * and pushes the result onto the chassis result queue to notify the
+     * completion handler, as VPD for the chassis having system VPD is collected already.
      *
-     * In case of any error, chassis count will be decremented and the
-     * waiting thread is notified.
+     * In case of any error, chassis is marked complete.
      *
+     * @param[in] i_context - Context of the collection.
      * @param[in] i_chassisJson - Chassis JSON containing FRU configuration.
      * @param[in] i_chassisId   - Chassis ID.
      * @param[in] i_eepromPath  - EEPROM file path for the chassis containing
      * VPD.
      */
-    void handleChassisHavingSystemVpd(const nlohmann::json& i_chassisJson,
-                                      const std::string& i_chassisId,
-                                      const std::string& i_eepromPath) noexcept;
+    void handleChassisHavingSystemVpd(
+        const std::shared_ptr<CollectionContext>& i_context,
+        const types::JsonSnapshot& i_chassisJson,
+        const std::string& i_chassisId,
+        const std::string& i_eepromPath) noexcept;
 #endif
 
     // Shared pointer to ConfigManager object
@@ -138,34 +185,36 @@ class ThreadManager
     // Map of ChassisID to {Inventory path, Chassis presence}
     types::ChassisStateMap m_chassisStateMap;
 
-    // Mutex to guard critical resource
+    // Mutex to guard chassis state map
     std::mutex m_mutex;
 
-    // Tracks chassis VPD collection results awaiting processing
-    std::queue<types::ChassisCollectionResult> m_chassisResultQueue;
+    // Scheduler spreading collection tasks across I2C buses
+    std::unique_ptr<I2cBusScheduler> m_busScheduler{nullptr};
 
-    // Chassis VPD collection result, whose action based on the result is
-    // pending
-    std::atomic<size_t> m_chassisCount{0};
+    // Thread pool shared by collection of all chassis and FRUs. Declared
+    // after the scheduler, so that pool tasks are joined before the scheduler
+    // they refer to is destroyed.
+    std::unique_ptr<CollectionThreadPool> m_threadPool{nullptr};
 
-    // Number of FRUs pending VPD collection
-    std::atomic<size_t> m_frusCount{0};
-
-    // Condition variable to signal chassis and FRU VPD completion
-    std::condition_variable m_completionCv;
+    // Thread driving the ongoing or last VPD collection. Joined before a new
+    // collection starts and on destruction, before the pool and scheduler it
+    // uses are destroyed.
+    std::thread m_collectionThread;
 
     /**
      * @brief Trigger multi-threaded VPD collection of all chassis's motherboard
      *
-     * This API spawns thread for each chassis motherboard
-     * to collect VPD in parallel. Each thread receives:
+     * This API submits a task for each chassis motherboard to the collection
+     * thread pool to collect VPD in parallel. Each task receives:
      * - EEPROM path of the motherboard
      * - Chassis-specific JSON configuration
      * The method uses the Worker API to perform actual VPD collection for
      * each motherboard EEPROM.
      *
+     * @param[in] i_context - Context of the collection.
      */
-    void collectAllChassisVpd();
+    void collectAllChassisVpd(
+        const std::shared_ptr<CollectionContext>& i_context);
 
     /**
      * @brief Updates the system view with the given chassis information.
@@ -207,69 +256,149 @@ class ThreadManager
      *
      * 1. Pop chassis result from the queue.
      * 2. Verify chassis presence state.
-     * 3. Launch FRU VPD collection thread pool for the chassis.
-     * 4. Update FRU and chassis collection counters.
+     * 3. Launch FRU VPD collection for the chassis.
+     * 4. Mark chassis complete if there are no FRUs to collect.
      *
      * Processing continues until all chassis and FRU VPD collection is
      * complete, or until VPD_COLLECTION_TIMEOUT_SEC seconds have elapsed.
      * On timeout an async PEL is created.
      *
+     * @param[in] i_context - Context of the collection.
+     *
      * @return true if all chassis and FRU VPD collection completed
      *         successfully within the timeout window, otherwise returns false.
      */
-    bool processChassisResults() noexcept;
+    bool processChassisResults(
+        const std::shared_ptr<CollectionContext>& i_context) noexcept;
 
     /**
-     * @brief Launch FRU VPD collection threads for a chassis.
+     * @brief Launch FRU VPD collection of a chassis.
      *
-     * Creates a thread pool for the provided chassis and initiates
-     * parallel VPD collection for all FRUs belonging to that chassis.
+     * Submits a task per FRU of the chassis to the shared collection thread
+     * pool through the I2C bus scheduler. Chassis is marked complete once the
+     * last FRU is collected.
      *
+     * @param[in] i_context - Context of the collection.
      * @param[in] i_chassisEeepromPath - EEPROM path of the chassis where its
      * VPD is present.
      * @param[in] i_chassisJson - Chassis based JSON object.
-     * @param[in] i_maxThreadsPerChassis - Maximum threads allowed for
-     * collecting FRUs VPD per chassis.
      */
-    void launchFruCollectionPool(const std::string& i_chassisEeepromPath,
-                                 const nlohmann::json& i_chassisJson,
-                                 const size_t i_maxThreadsPerChassis) noexcept;
+    void launchFruCollection(
+        const std::shared_ptr<CollectionContext>& i_context,
+        const std::string& i_chassisEeepromPath,
+        const types::JsonSnapshot& i_chassisJson) noexcept;
+
+    /**
+     * @brief Collect VPD of a FRU of a chassis.
+     *
+     * Runs on the collection thread pool. After the FRU is processed, the
+     * pending FRU count of the chassis is updated and the chassis is marked
+     * complete if it was the last FRU.
+     *
+     * @param[in] i_context - Context of the collection.
+     * @param[in] i_chassisContext - Collection context of the chassis.
+     * @param[in] i_fruPath - EEPROM path of the FRU.
+     */
+    void collectChassisFru(
+        const std::shared_ptr<CollectionContext>& i_context,
+        const std::shared_ptr<ChassisCollectionContext>& i_chassisContext,
+        const std::string& i_fruPath) noexcept;
+
+    /**
+     * @brief Dump trace of the last VPD collection to the trace file.
+     */
+    void dumpCollectionTrace() noexcept;
+
+    /**
+     * @brief Log object paths which failed to publish during collection.
+     *
+     * @param[in] i_failedObjectPaths - Object paths which failed to publish.
+     */
+    void logFailedPublications(
+        const std::vector<std::string>& i_failedObjectPaths) noexcept;
+
+    /**
+     * @brief Confirm EEPROM fingerprints set pending during collection.
+     *
+     * Fingerprint of an EEPROM is dropped if any of its objects failed to
+     * publish, so that VPD recollection doesn't skip the FRU.
+     *
+     * @param[in] i_failedObjectPaths - Object paths which failed to publish,
+     * sorted.
+     */
+    void confirmFingerprints(
+        const std::vector<std::string>& i_failedObjectPaths) noexcept;
+
+    /**
+     * @brief Mark VPD collection of a chassis as complete.
+     *
+     * Decrements the pending chassis count of the collection and notifies
+     * the waiting thread.
+     *
+     * @param[in] i_context - Context of the collection.
+     */
+    static void markChassisComplete(
+        const std::shared_ptr<CollectionContext>& i_context) noexcept;
 
     /**
-     * @brief Process FRU VPD collection tasks from shared thread context
+     * @brief Submit a task of a collection through the I2C bus scheduler.
      *
-     * Continuously retrieves the next available FRU from the shared
-     * FruThreadContext and performs VPD collection for that FRU. Work is
-     * distributed across multiple worker threads using a shared, thread-safe
-     * iterator. Processing continues until no unprocessed FRUs remain in the
-     * context.
+     * Task is counted in flight till it returns. It is skipped if the
+     * collection gets cancelled before the task starts.
      *
-     * After each FRU is processed, the pending FRU count is updated and the
-     * waiting thread is notified.
+     * @param[in] i_context - Context of the collection.
+     * @param[in] i_eepromPath - EEPROM path the task reads.
+     * @param[in] i_task - Task to run.
      *
-     * @note The chassis EEPROM path is excluded from FRU VPD collection.
+     * @throw std::exception if the task can't be queued.
+     */
+    void submitCollectionTask(
+        const std::shared_ptr<CollectionContext>& i_context,
+        const std::string& i_eepromPath, std::function<void()> i_task);
+
+    /**
+     * @brief Cancel queued tasks of a collection and wait for running ones.
+     *
+     * Called before the publisher is stopped, so that no task of the
+     * collection publishes VPD or sets fingerprints pending afterwards.
      *
-     * @param[in] i_fruThreadContext - Shared context containing FRU
-     * configuration and work-distribution state.
+     * @param[in] i_context - Context of the collection.
      */
-    void processFruCollection(
-        const std::shared_ptr<FruThreadContext>& i_fruThreadContext) noexcept;
+    static void drainCollectionTasks(
+        const std::shared_ptr<CollectionContext>& i_context) noexcept;
 
     /**
-     * @brief Get next FRU path from shared context
+     * @brief Get number of threads for the collection thread pool.
      *
-     * Retrieves and advances the shared FRU iterator from the FruThreadContext
-     * object in a thread-safe manner. The chassis EEPROM path is skipped and
-     * not returned by this function. Multiple FRU collection threads use this
-     * API to coordinate work distribution.
+     * Value given at build time is used, unless overridden by the
+     * VPD_COLLECTION_THREADS environment variable. The value is bounded by
+     * constants::MAX_COLLECTION_THREADS.
+     *
+     * @return Number of threads.
+     */
+    static size_t getCollectionThreadCount() noexcept;
+
+    /**
+     * @brief Get maximum number of concurrent EEPROM readers per I2C bus.
+     *
+     * Value given at build time is used, unless overridden by the
+     * VPD_MAX_READERS_PER_I2C_BUS environment variable.
+     *
+     * @return Maximum readers per bus.
+     */
+    static size_t getMaxReadersPerI2cBus() noexcept;
+
+    /**
+     * @brief Get a count from an environment variable.
      *
-     * @param[in] i_fruThreadContext - Shared FRU thread context.
+     * @param[in] i_envName - Name of the environment variable.
+     * @param[in] i_defaultCount - Count to use if variable is not set or is
+     * not a positive number.
      *
-     * @return The next FRU path to process, or an empty string if no more
-     *         FRU paths are available.
+     * @return Count.
      */
-    std::string getNextFruPath(const std::shared_ptr<FruThreadContext>&
-                                   i_fruThreadContext) const noexcept;
+    static size_t getCountFromEnv(const char* i_envName,
+                                  const size_t i_defaultCount) noexcept;
 };
 
 } // namespace vpd
@@ -7,6 +7,8 @@
 #include <xyz/openbmc_project/Common/Progress/common.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 
+#include <memory>
+#include <span>
 #include <tuple>
 #include <unordered_map>
 #include <variant>
@@ -34,6 +36,8 @@ using PendingBIOSAttrItem =
 using PendingBIOSAttrs = std::vector<PendingBIOSAttrItem>;
 
 using BinaryVector = std::vector<uint8_t>;
+/* Non-owning read-only view of binary data */
+using BinaryView = std::span<const uint8_t>;
 
 // This covers mostly all the data type supported over Dbus for a property.
 // clang-format off
@@ -305,7 +309,11 @@ struct BaseActionResult
     uint16_t m_gpioPresenceErrorCode = 0;
 };
 
+// Config JSON borrowed from an immutable config snapshot, keeps the snapshot
+// alive while held.
+using JsonSnapshot = std::shared_ptr<const nlohmann::json>;
+
 // Tuple of <Is FRU Present, EEPROM Path, chassis Json object>
-using ChassisCollectionResult = std::tuple<bool, std::string, nlohmann::json>;
+using ChassisCollectionResult = std::tuple<bool, std::string, JsonSnapshot>;
 } // namespace types
 } // namespace vpd
@@ -6,13 +6,37 @@
 #include "error_codes.hpp"
 #include "logger.hpp"
 
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <format>
-#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 /**
@@ -98,48 +122,715 @@ inline std::string getCommand(T i_arg1, Types... i_args)
     return l_cmd;
 }
 
-// Mutex to wrap popen in multithreaded scenario.
-static std::mutex popen_mutex;
+/**
+ * @brief Structure to hold counters of commands executed by the process.
+ *
+ * Counters are updated on every command executed and can be read at any point
+ * of time, to derive average command latency.
+ */
+struct CommandStats
+{
+    // Number of commands executed.
+    std::atomic<uint64_t> m_commandCount{0};
+
+    // Number of commands which failed to spawn, timed out or exited non-zero.
+    std::atomic<uint64_t> m_failedCommandCount{0};
+
+    // Number of commands killed on timeout.
+    std::atomic<uint64_t> m_timedOutCommandCount{0};
+
+    // Cumulative time spent in commands, in microseconds.
+    std::atomic<uint64_t> m_totalLatencyUs{0};
+
+    // Longest time spent in a single command, in microseconds.
+    std::atomic<uint64_t> m_maxLatencyUs{0};
+};
 
 /**
- * @brief API to create shell command and execute.
+ * @brief API to get the process wide command counters.
  *
- * @throw std::runtime_error.
+ * @return Reference to command counters.
+ */
+inline CommandStats& getCommandStats() noexcept
+{
+    static CommandStats l_commandStats;
+    return l_commandStats;
+}
+
+/**
+ * @brief API to get command counters in printable format.
  *
- * @param[in] arguments for command
+ * @return Command counters as string.
+ */
+inline std::string getCommandStatsString() noexcept
+{
+    const auto& l_stats = getCommandStats();
+    const uint64_t l_commandCount = l_stats.m_commandCount.load();
+
+    return std::format(
+        "Commands executed: {}, failed: {}, timed out: {}, average latency: "
+        "{} us, max latency: {} us",
+        l_commandCount, l_stats.m_failedCommandCount.load(),
+        l_stats.m_timedOutCommandCount.load(),
+        (l_commandCount ? l_stats.m_totalLatencyUs.load() / l_commandCount
+                        : 0),
+        l_stats.m_maxLatencyUs.load());
+}
+
+/**
+ * @brief Structure to hold result of a command.
+ */
+struct CommandResult
+{
+    // Exit status of the command, -1 if it did not exit normally.
+    int m_exitStatus{-1};
+
+    // Lines written by the command on stdout, with new line retained.
+    std::vector<std::string> m_output;
+
+    // Time taken by the command.
+    std::chrono::microseconds m_latency{0};
+};
+
+/**
+ * @brief API to spawn a command without shell.
+ *
+ * Command is spawned with posix_spawnp, which doesn't copy the page tables of
+ * the process, in a process group of its own. Its stdout is a close-on-exec
+ * pipe, hence a command never inherits the pipe of another one.
+ *
+ * @param[in] i_argv - Command and its arguments, command is searched in PATH
+ * if it has no slash.
+ * @param[out] o_pid - PID of the command.
+ * @param[out] o_readFd - Read end of stdout of the command, to be closed by
+ * the caller.
  * @param[out] o_errCode - To set error code in case of error.
- * @returns output of that command
+ *
+ * @return true if the command is spawned, false otherwise.
  */
-template <typename T, typename... Types>
-inline std::vector<std::string> executeCmd(T&& i_path, uint16_t& o_errCode,
-                                           Types... i_args)
+inline bool spawnCommand(const std::vector<std::string>& i_argv, pid_t& o_pid,
+                         int& o_readFd, uint16_t& o_errCode) noexcept
+{
+    o_pid = -1;
+    o_readFd = -1;
+
+    if (i_argv.empty() || i_argv.front().empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return false;
+    }
+
+    std::vector<char*> l_argv;
+    l_argv.reserve(i_argv.size() + 1);
+    for (const auto& l_arg : i_argv)
+    {
+        l_argv.push_back(const_cast<char*>(l_arg.c_str()));
+    }
+    l_argv.push_back(nullptr);
+
+    std::array<int, 2> l_pipeFds{-1, -1};
+    int l_spawnRc = 0;
+    if (pipe2(l_pipeFds.data(), O_CLOEXEC) != 0)
+    {
+        l_spawnRc = errno;
+    }
+    else
+    {
+        // Duplicated descriptor drops close-on-exec, only in the child.
+        posix_spawn_file_actions_t l_fileActions;
+        posix_spawnattr_t l_spawnAttr;
+        posix_spawn_file_actions_init(&l_fileActions);
+        posix_spawn_file_actions_adddup2(&l_fileActions, l_pipeFds[1],
+                                         STDOUT_FILENO);
+        posix_spawnattr_init(&l_spawnAttr);
+        posix_spawnattr_setflags(&l_spawnAttr, POSIX_SPAWN_SETPGROUP);
+        posix_spawnattr_setpgroup(&l_spawnAttr, 0);
+
+        l_spawnRc = posix_spawnp(&o_pid, l_argv[0], &l_fileActions,
+                                 &l_spawnAttr, l_argv.data(), environ);
+
+        posix_spawnattr_destroy(&l_spawnAttr);
+        posix_spawn_file_actions_destroy(&l_fileActions);
+        close(l_pipeFds[1]);
+    }
+
+    if (l_spawnRc != 0)
+    {
+        if (l_pipeFds[0] >= 0)
+        {
+            close(l_pipeFds[0]);
+        }
+        o_pid = -1;
+        o_errCode = error_code::COMMAND_SPAWN_FAILED;
+        Logger::getLoggerInstance()->logMessage(
+            std::format("Failed to spawn command [{}], error: {}",
+                        i_argv.front(), std::strerror(l_spawnRc)));
+        return false;
+    }
+
+    o_readFd = l_pipeFds[0];
+    return true;
+}
+
+/**
+ * @brief API to split output of a command in lines.
+ *
+ * @param[in] i_output - Output of the command.
+ *
+ * @return Lines of the output, with new line retained.
+ */
+inline std::vector<std::string> splitCommandOutput(const std::string& i_output)
+{
+    std::vector<std::string> l_lines;
+
+    for (size_t l_lineStart = 0; l_lineStart < i_output.size();)
+    {
+        const size_t l_lineEnd = i_output.find('\n', l_lineStart);
+        const size_t l_lineLength = (l_lineEnd == std::string::npos)
+                                        ? std::string::npos
+                                        : l_lineEnd - l_lineStart + 1;
+        l_lines.emplace_back(i_output.substr(l_lineStart, l_lineLength));
+        l_lineStart += l_lines.back().size();
+    }
+
+    return l_lines;
+}
+
+/**
+ * @brief API to log a finished command and add it to command counters.
+ *
+ * @param[in] i_command - Command which finished.
+ * @param[in] i_result - Result of the command.
+ * @param[in] i_errCode - Error code the command finished with.
+ * @param[in] i_timeout - Time given to the command to finish.
+ */
+inline void recordCommandResult(
+    const std::string& i_command, const CommandResult& i_result,
+    const uint16_t i_errCode,
+    const std::chrono::milliseconds i_timeout) noexcept
+{
+    auto& l_stats = getCommandStats();
+
+    if (i_errCode == error_code::COMMAND_TIMED_OUT)
+    {
+        ++l_stats.m_timedOutCommandCount;
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Command [{}] killed after {} ms", i_command, i_timeout.count()));
+    }
+    else if (i_result.m_latency >=
+             std::chrono::milliseconds(constants::SLOW_CMD_THRESHOLD_MS))
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Command [{}] took {} ms", i_command,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                i_result.m_latency)
+                .count()));
+    }
+
+    const uint64_t l_latencyUs = i_result.m_latency.count();
+    ++l_stats.m_commandCount;
+    l_stats.m_totalLatencyUs += l_latencyUs;
+    if (i_errCode || i_result.m_exitStatus != 0)
+    {
+        ++l_stats.m_failedCommandCount;
+    }
+
+    uint64_t l_maxLatencyUs = l_stats.m_maxLatencyUs.load();
+    while (l_latencyUs > l_maxLatencyUs &&
+           !l_stats.m_maxLatencyUs.compare_exchange_weak(l_maxLatencyUs,
+                                                         l_latencyUs))
+    {}
+}
+
+/**
+ * @brief API to execute a command without shell.
+ *
+ * Command is spawned by spawnCommand, hence any number of threads can execute
+ * commands at once.
+ *
+ * Command runs in a process group of its own, the group is killed if the
+ * command doesn't finish in the given time. Commands slower than
+ * constants::SLOW_CMD_THRESHOLD_MS are logged.
+ *
+ * @param[in] i_argv - Command and its arguments, command is searched in PATH
+ * if it has no slash.
+ * @param[out] o_errCode - To set error code in case of error. Exit status of
+ * the command is not treated as an error.
+ * @param[in] i_timeout - Time given to the command to finish.
+ *
+ * @return Result of the command.
+ */
+inline CommandResult executeCommand(
+    const std::vector<std::string>& i_argv, uint16_t& o_errCode,
+    const std::chrono::milliseconds i_timeout =
+        std::chrono::milliseconds(constants::CMD_TIMEOUT_MS)) noexcept
 {
     o_errCode = 0;
-    std::vector<std::string> l_cmdOutput;
-    std::lock_guard<std::mutex> lock(popen_mutex);
+    CommandResult l_result;
+
+    const auto l_start = std::chrono::steady_clock::now();
+    const auto l_deadline = l_start + i_timeout;
+
+    pid_t l_pid = -1;
+    int l_readFd = -1;
+    if (!spawnCommand(i_argv, l_pid, l_readFd, o_errCode))
+    {
+        if (o_errCode == error_code::COMMAND_SPAWN_FAILED)
+        {
+            recordCommandResult(i_argv.front(), l_result, o_errCode,
+                                i_timeout);
+        }
+        return l_result;
+    }
+
     try
     {
+        bool l_isTimedOut = false;
+        std::string l_output;
         std::array<char, constants::CMD_BUFFER_LENGTH> l_buffer;
+        pollfd l_pollFd{l_readFd, POLLIN, 0};
 
-        std::string l_cmd = i_path + getCommand(i_args...);
+        // Read till the command closes stdout, or its time is up.
+        while (true)
+        {
+            const auto l_remainingMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    l_deadline - std::chrono::steady_clock::now())
+                    .count();
+            if (l_remainingMs <= 0)
+            {
+                l_isTimedOut = true;
+                break;
+            }
+
+            const int l_pollRc =
+                poll(&l_pollFd, 1, static_cast<int>(l_remainingMs));
+            if (l_pollRc == 0 || (l_pollRc < 0 && errno == EINTR))
+            {
+                continue;
+            }
+
+            const ssize_t l_readSize =
+                (l_pollRc < 0)
+                    ? -1
+                    : read(l_readFd, l_buffer.data(), l_buffer.size());
+            if (l_readSize < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (l_readSize <= 0)
+            {
+                break;
+            }
+            l_output.append(l_buffer.data(), l_readSize);
+        }
+        close(l_readFd);
+        l_readFd = -1;
 
-        std::unique_ptr<FILE, decltype(&pclose)> l_cmdPipe(
-            popen(l_cmd.c_str(), "r"), pclose);
+        // Command may keep running after closing stdout.
+        int l_status = 0;
+        while (true)
+        {
+            if (l_isTimedOut)
+            {
+                kill(-l_pid, SIGKILL);
+            }
+
+            const pid_t l_waitRc =
+                waitpid(l_pid, &l_status, l_isTimedOut ? 0 : WNOHANG);
+            if (l_waitRc == l_pid || (l_waitRc < 0 && errno != EINTR))
+            {
+                break;
+            }
+
+            if (l_waitRc == 0)
+            {
+                if (std::chrono::steady_clock::now() < l_deadline)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+                l_isTimedOut = true;
+            }
+        }
 
-        if (!l_cmdPipe)
+        if (WIFEXITED(l_status))
         {
-            o_errCode = error_code::POPEN_FAILED;
+            l_result.m_exitStatus = WEXITSTATUS(l_status);
+        }
+        l_result.m_output = splitCommandOutput(l_output);
+
+        if (l_isTimedOut)
+        {
+            o_errCode = error_code::COMMAND_TIMED_OUT;
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        if (l_readFd >= 0)
+        {
+            close(l_readFd);
+            kill(-l_pid, SIGKILL);
+            waitpid(l_pid, nullptr, 0);
+        }
+
+        o_errCode = error_code::STANDARD_EXCEPTION;
+        Logger::getLoggerInstance()->logMessage(
+            "Error while trying to execute command [" + i_argv.front() +
+            "], error : " + std::string(l_ex.what()));
+    }
+
+    l_result.m_latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - l_start);
+    recordCommandResult(i_argv.front(), l_result, o_errCode, i_timeout);
+
+    return l_result;
+}
+
+/**
+ * @brief Class to execute a command asynchronously on an IO context.
+ *
+ * Stdout of the command is read through a stream descriptor and the command is
+ * reaped once its pidfd turns readable, hence no thread waits on the command.
+ * All the handlers run on a strand, so the IO context may be run by any number
+ * of threads.
+ *
+ * Instance keeps itself alive through its pending handlers. If the IO context
+ * is destroyed before the command finishes, the command is killed and reaped.
+ *
+ * @tparam Handler - Completion handler, called as
+ * i_handler(CommandResult&&, uint16_t).
+ */
+template <typename Handler>
+class AsyncCommand : public std::enable_shared_from_this<AsyncCommand<Handler>>
+{
+  public:
+    // Deleted APIs
+    AsyncCommand() = delete;
+    AsyncCommand(const AsyncCommand&) = delete;
+    AsyncCommand& operator=(const AsyncCommand&) = delete;
+    AsyncCommand(AsyncCommand&&) = delete;
+    AsyncCommand& operator=(AsyncCommand&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_ioContext - IO context to run the command on.
+     * @param[in] i_timeout - Time given to the command to finish.
+     * @param[in] i_handler - Completion handler.
+     */
+    AsyncCommand(boost::asio::io_context& i_ioContext,
+                 const std::chrono::milliseconds i_timeout, Handler i_handler) :
+        m_strand(boost::asio::make_strand(i_ioContext)), m_pipe(m_strand),
+        m_pidFd(m_strand), m_timer(m_strand), m_timeout(i_timeout),
+        m_handler(std::move(i_handler))
+    {}
+
+    /**
+     * @brief Destructor.
+     *
+     * Kills and reaps the command if it is still running.
+     */
+    ~AsyncCommand()
+    {
+        if (m_pid > 0 && !m_isExited)
+        {
+            kill(-m_pid, SIGKILL);
+            waitpid(m_pid, nullptr, 0);
+        }
+    }
+
+    /**
+     * @brief API to spawn the command and start waiting on it.
+     *
+     * Handler is called on the IO context, even if the command can't be
+     * spawned.
+     *
+     * @param[in] i_argv - Command and its arguments.
+     *
+     * @throw std::bad_alloc
+     */
+    void start(const std::vector<std::string>& i_argv)
+    {
+        m_startTime = std::chrono::steady_clock::now();
+
+        int l_readFd = -1;
+        if (!spawnCommand(i_argv, m_pid, l_readFd, m_errCode))
+        {
+            m_command = i_argv.empty() ? std::string() : i_argv.front();
+            m_isExited = true;
+            m_isOutputClosed = true;
+            boost::asio::post(m_strand, [l_self = this->shared_from_this()]() {
+                l_self->complete();
+            });
+            return;
+        }
+        m_command = i_argv.front();
+
+        try
+        {
+            m_pipe.assign(l_readFd);
+            l_readFd = -1;
+
+            const int l_pidFd =
+                static_cast<int>(syscall(SYS_pidfd_open, m_pid, 0));
+            if (l_pidFd < 0)
+            {
+                throw std::runtime_error("pidfd_open failed, error: " +
+                                         std::string(std::strerror(errno)));
+            }
+
+            try
+            {
+                m_pidFd.assign(l_pidFd);
+            }
+            catch (...)
+            {
+                close(l_pidFd);
+                throw;
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            if (l_readFd >= 0)
+            {
+                close(l_readFd);
+            }
+
             Logger::getLoggerInstance()->logMessage(
-                "popen failed with error " +
-                std::error_code(errno, std::generic_category()).message());
-            return l_cmdOutput;
+                "Error while trying to execute command [" + m_command +
+                "], error : " + std::string(l_ex.what()));
+
+            m_errCode = error_code::STANDARD_EXCEPTION;
+            m_isOutputClosed = true;
+            boost::asio::post(m_strand, [l_self = this->shared_from_this()]() {
+                l_self->reap(false);
+            });
+            return;
+        }
+
+        boost::asio::dispatch(m_strand, [l_self = this->shared_from_this()]() {
+            l_self->m_timer.expires_after(l_self->m_timeout);
+            l_self->m_timer.async_wait(
+                [l_self](const boost::system::error_code& i_errorCode) {
+                    l_self->handleTimeout(i_errorCode);
+                });
+            l_self->readOutput();
+            l_self->m_pidFd.async_wait(
+                boost::asio::posix::stream_descriptor::wait_read,
+                [l_self](const boost::system::error_code& i_errorCode) {
+                    l_self->reap(!i_errorCode);
+                });
+        });
+    }
+
+  private:
+    /**
+     * @brief API to read stdout of the command till it is closed.
+     */
+    void readOutput()
+    {
+        m_pipe.async_read_some(
+            boost::asio::buffer(m_buffer),
+            [l_self = this->shared_from_this()](
+                const boost::system::error_code& i_errorCode,
+                const size_t i_readSize) {
+                if (!i_errorCode)
+                {
+                    l_self->m_output.append(l_self->m_buffer.data(),
+                                            i_readSize);
+                    l_self->readOutput();
+                    return;
+                }
+
+                // End of file, or pipe closed on timeout.
+                l_self->m_isOutputClosed = true;
+                l_self->complete();
+            });
+    }
+
+    /**
+     * @brief API to reap the command.
+     *
+     * @param[in] i_isExited - true if pidfd of the command turned readable,
+     * i.e. the command has exited, false if it has to be killed first.
+     */
+    void reap(const bool i_isExited)
+    {
+        if (!i_isExited)
+        {
+            kill(-m_pid, SIGKILL);
         }
 
-        while (fgets(l_buffer.data(), l_buffer.size(), l_cmdPipe.get()) !=
-               nullptr)
+        int l_status = 0;
+        while (waitpid(m_pid, &l_status, 0) < 0 && errno == EINTR)
+        {}
+
+        if (WIFEXITED(l_status))
         {
-            l_cmdOutput.emplace_back(l_buffer.data());
+            m_exitStatus = WEXITSTATUS(l_status);
         }
+        m_isExited = true;
+        complete();
+    }
+
+    /**
+     * @brief API to kill the command when its time is up.
+     *
+     * @param[in] i_errorCode - Error code of the timer wait.
+     */
+    void handleTimeout(const boost::system::error_code& i_errorCode)
+    {
+        if (i_errorCode || m_isCompleted)
+        {
+            return;
+        }
+
+        // Closing the pipe stops the read, even if a process which left the
+        // group still holds stdout open.
+        m_isTimedOut = true;
+        kill(-m_pid, SIGKILL);
+        boost::system::error_code l_ignoredError;
+        m_pipe.close(l_ignoredError);
+    }
+
+    /**
+     * @brief API to call the handler once the command has exited and closed
+     * stdout.
+     */
+    void complete()
+    {
+        if (m_isCompleted || !m_isExited || !m_isOutputClosed)
+        {
+            return;
+        }
+        m_isCompleted = true;
+
+        boost::system::error_code l_ignoredError;
+        m_timer.cancel();
+        m_pipe.close(l_ignoredError);
+        m_pidFd.close(l_ignoredError);
+
+        CommandResult l_result;
+        l_result.m_exitStatus = m_exitStatus;
+        l_result.m_output = splitCommandOutput(m_output);
+        l_result.m_latency =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_startTime);
+
+        if (m_isTimedOut)
+        {
+            m_errCode = error_code::COMMAND_TIMED_OUT;
+        }
+
+        // Command which failed validation is not counted, as in
+        // executeCommand.
+        if (m_pid > 0 || m_errCode == error_code::COMMAND_SPAWN_FAILED)
+        {
+            recordCommandResult(m_command, l_result, m_errCode, m_timeout);
+        }
+
+        m_handler(std::move(l_result), m_errCode);
+    }
+
+    // Strand on which all the handlers run.
+    boost::asio::strand<boost::asio::io_context::executor_type> m_strand;
+
+    // Read end of stdout of the command.
+    boost::asio::posix::stream_descriptor m_pipe;
+
+    // Descriptor of the command, readable once it exits.
+    boost::asio::posix::stream_descriptor m_pidFd;
+
+    // Timer to kill the command on timeout.
+    boost::asio::steady_timer m_timer;
+
+    // Time given to the command to finish.
+    std::chrono::milliseconds m_timeout;
+
+    // Completion handler.
+    Handler m_handler;
+
+    // Command, for logs.
+    std::string m_command;
+
+    // PID of the command, -1 if it isn't spawned.
+    pid_t m_pid{-1};
+
+    // Time the command is started at.
+    std::chrono::steady_clock::time_point m_startTime;
+
+    // Buffer for a read from stdout.
+    std::array<char, constants::CMD_BUFFER_LENGTH> m_buffer{};
+
+    // Stdout of the command.
+    std::string m_output;
+
+    // Exit status of the command, -1 if it did not exit normally.
+    int m_exitStatus{-1};
+
+    // Error code the command finishes with.
+    uint16_t m_errCode{0};
+
+    bool m_isExited{false};
+    bool m_isOutputClosed{false};
+    bool m_isTimedOut{false};
+    bool m_isCompleted{false};
+};
+
+/**
+ * @brief API to execute a command without shell, asynchronously.
+ *
+ * Command is spawned by spawnCommand and waited on the IO context through an
+ * AsyncCommand, no thread is blocked on it. Process group of the command is
+ * killed if it doesn't finish in the given time.
+ *
+ * Handler is called on the IO context, as i_handler(CommandResult&&, uint16_t),
+ * once the command has exited and closed stdout.
+ *
+ * @param[in] i_ioContext - IO context to run the command on.
+ * @param[in] i_argv - Command and its arguments.
+ * @param[in] i_timeout - Time given to the command to finish.
+ * @param[in] i_handler - Completion handler.
+ *
+ * @throw std::bad_alloc
+ */
+template <typename Handler>
+inline void asyncExecuteCommand(boost::asio::io_context& i_ioContext,
+                                const std::vector<std::string>& i_argv,
+                                const std::chrono::milliseconds i_timeout,
+                                Handler&& i_handler)
+{
+    std::make_shared<AsyncCommand<std::decay_t<Handler>>>(
+        i_ioContext, i_timeout, std::forward<Handler>(i_handler))
+        ->start(i_argv);
+}
+
+/**
+ * @brief API to create shell command and execute.
+ *
+ * Command is run by /bin/sh through executeCommand, for commands relying on
+ * the shell, e.g. for redirection. Exit status of the command is not checked.
+ *
+ * @throw std::runtime_error.
+ *
+ * @param[in] arguments for command
+ * @param[out] o_errCode - To set error code in case of error.
+ * @returns output of that command
+ */
+template <typename T, typename... Types>
+inline std::vector<std::string> executeCmd(T&& i_path, uint16_t& o_errCode,
+                                           Types... i_args)
+{
+    o_errCode = 0;
+    std::vector<std::string> l_cmdOutput;
+    try
+    {
+        std::string l_cmd = i_path + getCommand(i_args...);
+
+        l_cmdOutput =
+            executeCommand({"/bin/sh", "-c", std::move(l_cmd)}, o_errCode)
+                .m_output;
     }
     catch (const std::exception& l_ex)
     {
@@ -332,7 +1023,8 @@ inline bool isFieldModeEnabled(uint16_t& o_errCode) noexcept
     try
     {
         std::vector<std::string> l_cmdOutput =
-            executeCmd("/sbin/fw_printenv fieldmode", o_errCode);
+            executeCommand({"/sbin/fw_printenv", "fieldmode"}, o_errCode)
+                .m_output;
 
         if (l_cmdOutput.size() > 0)
         {
@@ -372,7 +1064,8 @@ inline types::VpdCollectionMode getVpdCollectionMode(
     try
     {
         std::vector<std::string> l_cmdOutput =
-            commonUtility::executeCmd("/sbin/fw_printenv vpdmode", o_errCode);
+            executeCommand({"/sbin/fw_printenv", "vpdmode"}, o_errCode)
+                .m_output;
 
         if (l_cmdOutput.size() > 0)
         {
@@ -471,9 +1164,16 @@ inline bool restartService(const std::string& i_serviceName,
 
     try
     {
-        const auto l_cmd = "systemctl restart " + i_serviceName;
+        const auto l_result =
+            executeCommand({"systemctl", "restart", i_serviceName}, o_errCode);
 
-        executeCmd(l_cmd, o_errCode);
+        if (o_errCode == vpd::constants::VALUE_0 && l_result.m_exitStatus != 0)
+        {
+            o_errCode = error_code::COMMAND_FAILED;
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "Failed to restart service [{}], exit status {}",
+                i_serviceName, l_result.m_exitStatus));
+        }
 
         return o_errCode == vpd::constants::VALUE_0;
     }
@@ -6,9 +6,13 @@
 #include "logger.hpp"
 #include "types.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <expected>
 #include <format>
+#include <functional>
+#include <memory>
+#include <optional>
 
 namespace vpd
 {
@@ -305,13 +309,263 @@ inline bool writeDbusProperty(
     }
 }
 
+/**
+ * @brief Structure to hold counters of VPD publication towards PIM.
+ *
+ * Counters are updated on every Notify call made to PIM and can be read at any
+ * point of time, to derive average batch size and Notify latency.
+ */
+struct PimPublishStats
+{
+    // Number of Notify calls made to PIM.
+    std::atomic<uint64_t> m_notifyCount{0};
+
+    // Number of Notify calls which failed.
+    std::atomic<uint64_t> m_failedNotifyCount{0};
+
+    // Number of objects published across all Notify calls.
+    std::atomic<uint64_t> m_objectCount{0};
+
+    // Largest number of objects sent in a single Notify call.
+    std::atomic<uint64_t> m_maxBatchSize{0};
+
+    // Cumulative time spent in Notify calls, in microseconds.
+    std::atomic<uint64_t> m_totalLatencyUs{0};
+
+    // Longest time spent in a single Notify call, in microseconds.
+    std::atomic<uint64_t> m_maxLatencyUs{0};
+};
+
+/**
+ * @brief API to get the process wide PIM publication counters.
+ *
+ * @return Reference to PIM publication counters.
+ */
+inline PimPublishStats& getPimPublishStats() noexcept
+{
+    static PimPublishStats l_pimPublishStats;
+    return l_pimPublishStats;
+}
+
+/**
+ * @brief API to get PIM publication counters in printable format.
+ *
+ * @return PIM publication counters as string.
+ */
+inline std::string getPimPublishStatsString() noexcept
+{
+    const auto& l_stats = getPimPublishStats();
+    const uint64_t l_notifyCount = l_stats.m_notifyCount.load();
+
+    return std::format(
+        "PIM Notify calls: {}, failed: {}, objects: {}, average batch size: {}, "
+        "max batch size: {}, average latency: {} us, max latency: {} us",
+        l_notifyCount, l_stats.m_failedNotifyCount.load(),
+        l_stats.m_objectCount.load(),
+        (l_notifyCount ? l_stats.m_objectCount.load() / l_notifyCount : 0),
+        l_stats.m_maxBatchSize.load(),
+        (l_notifyCount ? l_stats.m_totalLatencyUs.load() / l_notifyCount : 0),
+        l_stats.m_maxLatencyUs.load());
+}
+
+/**
+ * @brief API to get handle of D-Bus connection owned by the calling thread.
+ *
+ * sd-bus connections are not thread safe, hence each thread owns a connection
+ * which lives till the thread exits. This avoids connection set-up on every
+ * call made to PIM from the same thread.
+ *
+ * @return Reference to the thread's connection handle, null if not yet opened.
+ */
+inline std::unique_ptr<sdbusplus::bus_t>& getThreadBusHandle() noexcept
+{
+    thread_local std::unique_ptr<sdbusplus::bus_t> l_bus;
+    return l_bus;
+}
+
+/**
+ * @brief API to get D-Bus connection of the calling thread.
+ *
+ * Connection is opened on first use from a thread and reused afterwards.
+ *
+ * @return Reference to the thread's D-Bus connection.
+ *
+ * @throw sdbusplus::exception::exception
+ */
+inline sdbusplus::bus_t& getThreadBus()
+{
+    auto& l_bus = getThreadBusHandle();
+    if (!l_bus)
+    {
+        l_bus = std::make_unique<sdbusplus::bus_t>(
+            sdbusplus::bus::new_default());
+    }
+    return *l_bus;
+}
+
+/**
+ * @brief API to merge an object map into another.
+ *
+ * Interfaces and properties of an object present in both the maps are merged,
+ * property values from source map take precedence.
+ *
+ * @param[in,out] io_targetMap - Map to merge into.
+ * @param[in] i_sourceMap - Map to merge from.
+ */
+inline void mergeObjectMap(types::ObjectMap& io_targetMap,
+                           types::ObjectMap&& i_sourceMap)
+{
+    if (io_targetMap.empty())
+    {
+        io_targetMap = std::move(i_sourceMap);
+        return;
+    }
+
+    for (auto& [l_objectPath, l_interfaceMap] : i_sourceMap)
+    {
+        auto& l_targetInterfaceMap = io_targetMap[l_objectPath];
+        for (auto& [l_interface, l_propertyMap] : l_interfaceMap)
+        {
+            auto& l_targetPropertyMap = l_targetInterfaceMap[l_interface];
+            for (auto& [l_property, l_value] : l_propertyMap)
+            {
+                l_targetPropertyMap.insert_or_assign(l_property,
+                                                     std::move(l_value));
+            }
+        }
+    }
+}
+
+/**
+ * @brief API to get the Notify call override.
+ *
+ * When set, notifyPIM hands every batch to the override instead of calling
+ * Notify on PIM. Override signals a failed call by throwing. Meant for unit
+ * tests, has to be set before any thread starts publishing.
+ *
+ * @return Reference to the override.
+ */
+inline std::function<void(const types::ObjectMap&)>& getPimNotifyOverride()
+{
+    static std::function<void(const types::ObjectMap&)> l_pimNotifyOverride;
+    return l_pimNotifyOverride;
+}
+
+/**
+ * @brief API to get observer of VPD published by the process.
+ *
+ * When set, the observer is called with every object map PIM has taken, once
+ * the Notify call has succeeded. Object paths may be relative to PIM path.
+ * Observer has to be set before any thread starts publishing, must not throw
+ * and must not publish itself.
+ *
+ * @return Reference to the observer.
+ */
+inline std::function<void(const types::ObjectMap&)>& getPublishObserver()
+{
+    static std::function<void(const types::ObjectMap&)> l_publishObserver;
+    return l_publishObserver;
+}
+
+/**
+ * @brief API to update PIM publication counters for a Notify call.
+ *
+ * @param[in] i_batchSize - Number of objects sent in the call.
+ * @param[in] i_start - Time the call started at.
+ * @param[in] i_isFailed - true if the call failed.
+ */
+inline void updatePimPublishStats(
+    const uint64_t i_batchSize,
+    const std::chrono::steady_clock::time_point& i_start,
+    const bool i_isFailed) noexcept
+{
+    auto& l_stats = getPimPublishStats();
+    const uint64_t l_latencyUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - i_start)
+            .count();
+
+    ++l_stats.m_notifyCount;
+    if (i_isFailed)
+    {
+        ++l_stats.m_failedNotifyCount;
+    }
+    l_stats.m_objectCount += i_batchSize;
+    l_stats.m_totalLatencyUs += l_latencyUs;
+
+    uint64_t l_maxBatchSize = l_stats.m_maxBatchSize.load();
+    while (i_batchSize > l_maxBatchSize &&
+           !l_stats.m_maxBatchSize.compare_exchange_weak(l_maxBatchSize,
+                                                         i_batchSize))
+    {}
+
+    uint64_t l_maxLatencyUs = l_stats.m_maxLatencyUs.load();
+    while (l_latencyUs > l_maxLatencyUs &&
+           !l_stats.m_maxLatencyUs.compare_exchange_weak(l_maxLatencyUs,
+                                                         l_latencyUs))
+    {}
+}
+
+/**
+ * @brief API to make a single Notify call on PIM.
+ *
+ * The API uses calling thread's D-Bus connection and updates PIM publication
+ * counters. Object paths are expected to be relative to PIM path. Publish
+ * observer is called once the call succeeds.
+ *
+ * @param[in] i_objectMap - Object, its interface and data.
+ *
+ * @throw sdbusplus::exception::exception
+ */
+inline void notifyPIM(const types::ObjectMap& i_objectMap)
+{
+    const auto l_start = std::chrono::steady_clock::now();
+
+    try
+    {
+        if (const auto& l_pimNotifyOverride = getPimNotifyOverride();
+            l_pimNotifyOverride)
+        {
+            l_pimNotifyOverride(i_objectMap);
+        }
+        else
+        {
+            auto& l_bus = getThreadBus();
+            auto l_pimMsg = l_bus.new_method_call(
+                constants::pimServiceName, constants::pimPath,
+                constants::pimIntf, "Notify");
+            l_pimMsg.append(i_objectMap);
+            l_bus.call(l_pimMsg);
+        }
+    }
+    catch (const sdbusplus::exception::exception&)
+    {
+        // Drop the connection, a fresh one gets opened on next use.
+        getThreadBusHandle().reset();
+        updatePimPublishStats(i_objectMap.size(), l_start, true);
+        throw;
+    }
+
+    updatePimPublishStats(i_objectMap.size(), l_start, false);
+
+    if (const auto& l_publishObserver = getPublishObserver(); l_publishObserver)
+    {
+        l_publishObserver(i_objectMap);
+    }
+}
+
 /**
  * @brief API to publish data on PIM
  *
- * The API calls notify on PIM object to publlish VPD.
+ * The API calls notify on PIM object to publlish VPD. Objects are sent in
+ * batches of at most constants::MAX_OBJECTS_PER_NOTIFY objects, over the
+ * calling thread's D-Bus connection. A failed Notify call aborts publication of
+ * remaining batches.
  *
  * @param[in] objectMap - Object, its interface and data.
  * @return bool - Status of call to PIM notify.
+ *
+ * @throw sdbusplus::exception::exception
  */
 inline bool callPIM(types::ObjectMap&& objectMap)
 {
@@ -329,12 +583,23 @@ inline bool callPIM(types::ObjectMap&& objectMap)
             }
         }
 
-        auto bus = sdbusplus::bus::new_default();
-        auto pimMsg =
-            bus.new_method_call(constants::pimServiceName, constants::pimPath,
-                                constants::pimIntf, "Notify");
-        pimMsg.append(std::move(objectMap));
-        bus.call(pimMsg);
+        if (objectMap.size() <= constants::MAX_OBJECTS_PER_NOTIFY)
+        {
+            notifyPIM(objectMap);
+            return true;
+        }
+
+        while (!objectMap.empty())
+        {
+            types::ObjectMap l_batch;
+            while (!objectMap.empty() &&
+                   l_batch.size() < constants::MAX_OBJECTS_PER_NOTIFY)
+            {
+                l_batch.insert(objectMap.extract(objectMap.begin()));
+            }
+
+            notifyPIM(l_batch);
+        }
     }
     catch (const sdbusplus::exception::internal_exception& e)
     {
@@ -343,6 +608,34 @@ inline bool callPIM(types::ObjectMap&& objectMap)
     return true;
 }
 
+/**
+ * @brief API to get calling thread's pending VPD publication.
+ *
+ * Holds a value only while a PublishBatch owned by the thread is alive.
+ *
+ * @return Reference to thread's pending object map.
+ */
+inline std::optional<types::ObjectMap>& getThreadPublishBatch()
+{
+    thread_local std::optional<types::ObjectMap> l_publishBatch;
+    return l_publishBatch;
+}
+
+/**
+ * @brief API to get sink of VPD published by the process.
+ *
+ * When set, publishVpdOnDBus hands every object map to the sink instead of
+ * calling PIM. A sink which returns false leaves the map untouched and it is
+ * published right away. Can be set and cleared while threads are publishing.
+ *
+ * @return Reference to the sink.
+ */
+inline std::atomic<bool (*)(types::ObjectMap&)>& getPublishSink() noexcept
+{
+    static std::atomic<bool (*)(types::ObjectMap&)> l_publishSink{nullptr};
+    return l_publishSink;
+}
+
 /*
  * @brief API to update the VPD data on dbus.
  *
@@ -350,18 +643,40 @@ inline bool callPIM(types::ObjectMap&& objectMap)
  * based on the configuration.
  * NOTE- In future, support else part to call other service/method.
  *
+ * Data is published right away, unless
+ * - a PublishBatch is alive on the calling thread, whose commit() then
+ *   returns the outcome, or
+ * - PimPublisher is running, whose stop() then returns object paths which
+ *   failed to publish.
+ * In both cases true only means the data is taken.
+ *
  * @param[in] i_objectMap - map of object and it's data
  *
  * @return bool - true if success, false otherwise.
  */
 inline bool publishVpdOnDBus(types::ObjectMap&& i_objectMap)
 {
+    if (auto& l_publishBatch = getThreadPublishBatch(); l_publishBatch)
+    {
+        // Published, and outcome reported, by PublishBatch::commit().
+        mergeObjectMap(*l_publishBatch, std::move(i_objectMap));
+        return true;
+    }
+
     // Initialise it as default, otherwise compiler fails it assuming if
     // "if condition" doesn't match then it will be left uninitialised.
     // Once other service will be supported, it will be overwritten in
     // else section.
     [[maybe_unused]] bool (*dBusCall)(types::ObjectMap&&) = callPIM;
 
+    // Outcome is reported by PimPublisher::stop().
+    if (const auto l_publishSink =
+            getPublishSink().load(std::memory_order_acquire);
+        l_publishSink != nullptr && l_publishSink(i_objectMap))
+    {
+        return true;
+    }
+
 #if IBM_SYSTEM
     dBusCall = callPIM;
 #endif
@@ -371,6 +686,87 @@ inline bool publishVpdOnDBus(types::ObjectMap&& i_objectMap)
     return reply;
 }
 
+/**
+ * @brief Scope batching VPD publication on calling thread.
+ *
+ * While the scope is alive, publishVpdOnDBus calls from the thread merge their
+ * data into a single object map instead of calling PIM, and report success.
+ * Outcome of publishing the merged data is returned by commit. A scope which
+ * is not committed publishes the merged data on destruction, ignoring the
+ * outcome.
+ *
+ * A scope created while another one is alive on the thread joins it. Its
+ * commit then leaves the data to be published by the outer scope.
+ */
+class PublishBatch
+{
+  public:
+    /**
+     * @brief Constructor
+     */
+    PublishBatch() : m_isOwner(!getThreadPublishBatch().has_value())
+    {
+        if (m_isOwner)
+        {
+            getThreadPublishBatch().emplace();
+        }
+    }
+
+    PublishBatch(const PublishBatch&) = delete;
+    PublishBatch& operator=(const PublishBatch&) = delete;
+    PublishBatch(PublishBatch&&) = delete;
+    PublishBatch& operator=(PublishBatch&&) = delete;
+
+    /**
+     * @brief Destructor
+     */
+    ~PublishBatch()
+    {
+        try
+        {
+            commit();
+        }
+        catch (const std::exception&)
+        {
+            // Outcome is reported only to commit caller.
+        }
+    }
+
+    /**
+     * @brief API to publish everything merged since the scope began.
+     *
+     * Data is published with a single call to publishVpdOnDBus, batching ends
+     * on the thread.
+     *
+     * @return bool - true if success or nothing to publish, false otherwise.
+     *
+     * @throw sdbusplus::exception::exception
+     */
+    bool commit()
+    {
+        if (!m_isOwner)
+        {
+            return true;
+        }
+        m_isOwner = false;
+
+        auto& l_publishBatch = getThreadPublishBatch();
+        types::ObjectMap l_objectMap = std::move(*l_publishBatch);
+        l_publishBatch.reset();
+
+        if (l_objectMap.empty())
+        {
+            return true;
+        }
+
+        return publishVpdOnDBus(std::move(l_objectMap));
+    }
+
+  private:
+    // True if the scope started batching and is yet to commit.
+    bool m_isOwner;
+};
+
 /**
  * @brief API to check if a D-Bus service is running or not.
  *
@@ -84,20 +84,13 @@ inline size_t getVPDOffset(const std::string& i_vpdFilePath,
         return l_sysCfgJsonObj["frus"][i_vpdFilePath].at(0).value("offset", 0);
     }
 
-    const nlohmann::json& l_fruList =
-        l_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
-
-    for (const auto& l_fru : l_fruList.items())
+    // check if given path is redundant FRU path
+    if (const auto l_fruRecord = l_configManager->findFru(i_vpdFilePath);
+        l_fruRecord.has_value() &&
+        l_fruRecord->m_redundantEeprom == i_vpdFilePath)
     {
-        const auto l_fruPath = l_fru.key();
-
-        // check if given path is redundant FRU path
-        if (i_vpdFilePath == l_sysCfgJsonObj["frus"][l_fruPath].at(0).value(
-                                 "redundantEeprom", ""))
-        {
-            // Return the offset of redundant EEPROM taken from JSON.
-            return l_sysCfgJsonObj["frus"][l_fruPath].at(0).value("offset", 0);
-        }
+        // Return the offset of redundant EEPROM taken from JSON.
+        return l_fruRecord->m_vpdOffset;
     }
 
     return 0;
@@ -199,22 +192,11 @@ inline std::string getInventoryObjPathFromJson(const std::string& i_vpdPath,
             "inventoryPath", "");
     }
 
-    const nlohmann::json& l_fruList =
-        l_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
-
-    for (const auto& l_fru : l_fruList.items())
+    // check if given path is redundant FRU path or inventory path
+    if (const auto l_fruRecord = l_configManager->findFru(i_vpdPath);
+        l_fruRecord.has_value())
     {
-        const auto l_fruPath = l_fru.key();
-        const auto l_invObjPath =
-            l_sysCfgJsonObj["frus"][l_fruPath].at(0).value("inventoryPath", "");
-
-        // check if given path is redundant FRU path or inventory path
-        if (i_vpdPath == l_sysCfgJsonObj["frus"][l_fruPath].at(0).value(
-                             "redundantEeprom", "") ||
-            (i_vpdPath == l_invObjPath))
-        {
-            return l_invObjPath;
-        }
+        return std::string(l_fruRecord->m_inventoryPath);
     }
 
     return std::string{};
@@ -915,23 +897,11 @@ inline std::string getRedundantEepromPathFromJson(const std::string& i_vpdPath,
             "redundantEeprom", "");
     }
 
-    const nlohmann::json& l_fruList =
-        l_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
-
-    for (const auto& l_fru : l_fruList.items())
+    // check if given path is inventory path or redundant FRU path
+    if (const auto l_fruRecord = l_configManager->findFru(i_vpdPath);
+        l_fruRecord.has_value())
     {
-        const std::string& l_fruPath = l_fru.key();
-        const std::string& l_redundantFruPath =
-            l_sysCfgJsonObj["frus"][l_fruPath].at(0).value("redundantEeprom",
-                                                           "");
-
-        // check if given path is inventory path or redundant FRU path
-        if ((l_sysCfgJsonObj["frus"][l_fruPath].at(0).value("inventoryPath",
-                                                            "") == i_vpdPath) ||
-            (l_redundantFruPath == i_vpdPath))
-        {
-            return l_redundantFruPath;
-        }
+        return std::string(l_fruRecord->m_redundantEeprom);
     }
 
     return std::string();
@@ -980,21 +950,11 @@ inline std::string getFruPathFromJson(const std::string& i_vpdPath,
         return i_vpdPath;
     }
 
-    const nlohmann::json& l_fruList =
-        l_parsedConfigJson["frus"].get_ref<const nlohmann::json::object_t&>();
-
-    for (const auto& l_fru : l_fruList.items())
+    // check if given path is redundant FRU path or inventory path
+    if (const auto l_fruRecord = l_configManager->findFru(i_vpdPath);
+        l_fruRecord.has_value())
     {
-        const auto l_fruPath = l_fru.key();
-
-        // check if given path is redundant FRU path or inventory path
-        if (i_vpdPath == l_parsedConfigJson["frus"][l_fruPath].at(0).value(
-                             "redundantEeprom", "") ||
-            (i_vpdPath == l_parsedConfigJson["frus"][l_fruPath].at(0).value(
-                              "inventoryPath", "")))
-        {
-            return l_fruPath;
-        }
+        return std::string(l_fruRecord->m_eepromPath);
     }
 
     o_errCode = error_code::FRU_PATH_NOT_FOUND;
@@ -94,7 +94,7 @@ inline std::string generateBadVPDFileName(const std::string& i_vpdFilePath,
  * @return On success returns 0, otherwise returns -1.
  */
 inline int dumpBadVpd(const std::string& i_vpdFilePath,
-                      const types::BinaryVector& i_vpdVector,
+                      types::BinaryView i_vpdVector,
                       uint16_t& o_errCode) noexcept
 {
     o_errCode = 0;
@@ -690,6 +690,55 @@ inline bool isPass1Planar(uint16_t& o_errCode) noexcept
     return l_rc;
 }
 
+/**
+ * @brief API to enable a mux.
+ *
+ * Mux is brought out of idle state by writing 0 to its hold idle path, unless
+ * it holds 0 already.
+ *
+ * @param[in] i_holdIdlePath - Hold idle path of the mux.
+ * @param[out] o_errCode - To set error code in case of error.
+ *
+ * @return True if the mux got enabled by this call, false otherwise.
+ */
+inline bool enableMux(const std::string& i_holdIdlePath,
+                      uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+
+    try
+    {
+        std::string l_holdIdleValue;
+        {
+            std::ifstream l_holdIdleFile(i_holdIdlePath);
+            l_holdIdleFile >> l_holdIdleValue;
+        }
+
+        if (l_holdIdleValue == "0")
+        {
+            return false;
+        }
+
+        std::ofstream l_holdIdleFile(i_holdIdlePath);
+        l_holdIdleFile << "0";
+        l_holdIdleFile.close();
+
+        if (!l_holdIdleFile)
+        {
+            o_errCode = error_code::FILE_ACCESS_ERROR;
+            return false;
+        }
+
+        return true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+
+    return false;
+}
+
 /**
  * @brief API to get interface(s) properties corresponding to given
  * record and keyword.
@@ -948,6 +997,56 @@ inline const std::string convertWriteVpdParamsToString(
     return std::string{};
 }
 
+/**
+ * @brief API to get the IPZ keywords which can be written on an EEPROM.
+ *
+ * A keyword can't be written if its value is empty, its record is VHDR or VTOC,
+ * or its record or keyword is missing in the parsed VPD of the EEPROM. A single
+ * such keyword fails a batched write of all the keywords.
+ *
+ * @param[in] i_keywords - List of (Record, Keyword, Value).
+ * @param[in] i_vpdMap - Parsed VPD of the EEPROM. Keywords are not looked up
+ * if it is empty.
+ * @param[out] o_invalidKeywords - (Record, Keyword) of the keywords which can't
+ * be written.
+ *
+ * @return Keywords which can be written, in the given order.
+ */
+inline std::vector<types::IpzData> getWritableIpzKeywords(
+    const std::vector<types::IpzData>& i_keywords,
+    const types::IPZVpdMap& i_vpdMap,
+    std::vector<types::IpzType>& o_invalidKeywords)
+{
+    std::vector<types::IpzData> l_writableKeywords;
+    l_writableKeywords.reserve(i_keywords.size());
+
+    for (const auto& l_ipzData : i_keywords)
+    {
+        const auto& [l_recordName, l_keywordName, l_value] = l_ipzData;
+
+        bool l_isWritable = !l_value.empty() && l_recordName != "VHDR" &&
+                            l_recordName != "VTOC";
+
+        if (l_isWritable && !i_vpdMap.empty())
+        {
+            const auto l_recordItr = i_vpdMap.find(l_recordName);
+            l_isWritable = l_recordItr != i_vpdMap.end() &&
+                           l_recordItr->second.contains(l_keywordName);
+        }
+
+        if (l_isWritable)
+        {
+            l_writableKeywords.push_back(l_ipzData);
+        }
+        else
+        {
+            o_invalidKeywords.emplace_back(l_recordName, l_keywordName);
+        }
+    }
+
+    return l_writableKeywords;
+}
+
 /**
  * @brief An API to read IM value from VPD.
  *
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to hold read-only image of a VPD file.
+ *
+ * The class loads VPD of a FRU and exposes it as a non-owning view, which can
+ * be handed over to the parsers without copying the image.
+ *
+ * Regular files (e.g. file mode cache of the EEPROM) are memory mapped
+ * read-only. Files which can't be mapped, like sysfs EEPROM nodes, are read
+ * with positioned reads into a buffer sized to the VPD to be read.
+ *
+ * Writes to the VPD file go through writeRanges, images already loaded don't
+ * see them.
+ */
+class VpdImage
+{
+  public:
+    // Deleted APIs
+    VpdImage(const VpdImage&) = delete;
+    VpdImage& operator=(const VpdImage&) = delete;
+    VpdImage(VpdImage&&) = delete;
+    VpdImage& operator=(VpdImage&&) = delete;
+
+    /**
+     * @brief Constructor
+     */
+    VpdImage() = default;
+
+    /**
+     * @brief Destructor
+     *
+     * Unmaps the image if mapped.
+     */
+    ~VpdImage();
+
+    /**
+     * @brief API to load VPD of the given file.
+     *
+     * Any previously loaded image is released. At most
+     * constants::MAX_VPD_SIZE bytes are loaded, starting from the given offset.
+     *
+     * @param[in] i_vpdFilePath - Path to the VPD file.
+     * @param[in] i_vpdStartOffset - Offset of VPD data in the file.
+     * @param[out] o_errCode - To set error code in case of error.
+     */
+    void load(const std::string& i_vpdFilePath, size_t i_vpdStartOffset,
+              uint16_t& o_errCode) noexcept;
+
+    /**
+     * @brief API to get view of the loaded VPD.
+     *
+     * The view is valid till the object is destroyed or the image is loaded
+     * again.
+     *
+     * @return View of the loaded VPD, empty if nothing is loaded.
+     */
+    types::BinaryView getView() const noexcept
+    {
+        return m_view;
+    }
+
+    /**
+     * @brief API to check if the loaded VPD is memory mapped.
+     *
+     * @return true if memory mapped, false otherwise.
+     */
+    bool isMapped() const noexcept
+    {
+        return m_mappedAddress != nullptr;
+    }
+
+    /**
+     * @brief API to write ranges of VPD to the given file.
+     *
+     * Each range is written with positioned writes which don't cross an
+     * EEPROM page, and is read back to verify the write once all ranges are
+     * written.
+     *
+     * @param[in] i_vpdFilePath - Path to the VPD file.
+     * @param[in] i_vpdStartOffset - Offset of VPD data in the file.
+     * @param[in] i_ranges - List of offset in VPD and data to write at that
+     * offset.
+     * @param[out] o_errCode - To set error code in case of error.
+     */
+    static void writeRanges(
+        const std::string& i_vpdFilePath, size_t i_vpdStartOffset,
+        const std::vector<std::pair<size_t, types::BinaryView>>& i_ranges,
+        uint16_t& o_errCode) noexcept;
+
+  private:
+    /**
+     * @brief API to release the loaded image.
+     */
+    void release() noexcept;
+
+    // Start address of the mapping, null if file is not mapped.
+    void* m_mappedAddress{nullptr};
+
+    // Length of the mapping.
+    size_t m_mappedLength{0};
+
+    // Holds VPD read from the file, when the file can't be mapped.
+    types::BinaryVector m_buffer;
+
+    // View to the VPD in either the mapping or the buffer.
+    types::BinaryView m_view;
+};
+} // namespace vpd
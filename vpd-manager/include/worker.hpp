@@ -110,7 +110,9 @@ class Worker
      * @brief  Perform VPD recollection
      *
      * This api will trigger parser to perform VPD recollection for FRUs that
-     * can be replaced at standby.
+     * can be replaced at standby. FRUs whose EEPROM fingerprint is unchanged
+     * since their VPD was confirmed published are not parsed again, only their
+     * present and collection status properties are re-asserted.
      *
      * @param[in] i_sysCfgJsonObj - System config JSON object.
      */
@@ -436,6 +438,36 @@ class Worker
                i_fru.value("handlePresence", true);
     }
 
+    /**
+     * @brief API to check if a FRU can be skipped on recollection based on
+     * fingerprint of its EEPROM.
+     *
+     * Redundant FRUs and FRUs which need a pre or post action in collection
+     * flow always go through the full collection.
+     *
+     * @param[in] i_sysCfgJsonObj - System config JSON object.
+     * @param[in] i_vpdFilePath - EEPROM file path.
+     *
+     * @return true if fingerprint is applicable, false otherwise.
+     */
+    bool isFingerprintApplicable(
+        const nlohmann::json& i_sysCfgJsonObj,
+        const std::string& i_vpdFilePath) const noexcept;
+
+    /**
+     * @brief API to set pending fingerprint of a FRU collected in full
+     * collection.
+     *
+     * Fingerprint is kept pending as VPD is only queued to PIM, it is
+     * confirmed once the collection ends. Applies only to FRUs replaceable at
+     * standby.
+     *
+     * @param[in] i_cfgJsonObj - Config JSON object.
+     * @param[in] i_vpdFilePath - EEPROM file path.
+     */
+    void setPendingFingerprint(const nlohmann::json& i_cfgJsonObj,
+                               const std::string& i_vpdFilePath) noexcept;
+
     /**
      * @brief API to check and execute post fail action if needed.
      *
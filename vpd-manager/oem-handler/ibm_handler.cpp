@@ -195,17 +195,17 @@ void IbmHandler::enableMuxChips()
         uint16_t l_errCode = 0;
         if (item.contains("holdidlepath"))
         {
-            std::string cmd = "echo 0 > ";
-            cmd += item["holdidlepath"];
+            const std::string l_holdIdlePath = item["holdidlepath"];
 
-            m_logger->logMessage("Enabling mux with command = " + cmd);
+            m_logger->logMessage("Enabling mux with hold idle path = " +
+                                 l_holdIdlePath);
 
-            commonUtility::executeCmd(cmd, l_errCode);
+            vpdSpecificUtility::enableMux(l_holdIdlePath, l_errCode);
 
             if (l_errCode)
             {
                 m_logger->logMessage(
-                    "Failed to execute command [" + cmd +
+                    "Failed to enable mux [" + l_holdIdlePath +
                     "], error : " + commonUtility::getErrCodeMsg(l_errCode));
             }
 
@@ -292,7 +292,8 @@ void IbmHandler::setEnvAndReboot(const std::string& i_key,
 {
     // set env and reboot and break.
     uint16_t l_errCode = 0;
-    commonUtility::executeCmd("/sbin/fw_setenv", l_errCode, i_key, i_value);
+    commonUtility::executeCommand({"/sbin/fw_setenv", i_key, i_value},
+                                  l_errCode);
 
     if (l_errCode)
     {
@@ -320,7 +321,8 @@ std::string IbmHandler::readFitConfigValue()
 {
     uint16_t l_errCode = 0;
     std::vector<std::string> l_output =
-        commonUtility::executeCmd("/sbin/fw_printenv", l_errCode);
+        commonUtility::executeCommand({"/sbin/fw_printenv"}, l_errCode)
+            .m_output;
 
     if (l_errCode)
     {
@@ -288,35 +288,86 @@ types::BinaryStringKwValuePair BackupAndRestore::getBinaryAndStrIpzKwValue(
 }
 
 void BackupAndRestore::syncIpzData(
-    const std::string& i_fruPath, const types::IpzType& i_recordKwName,
-    const types::BinaryStringKwValuePair& i_binaryStrValue,
-    types::IPZVpdMap& o_vpdMap) const noexcept
+    const std::string& i_fruPath,
+    const std::vector<types::IpzData>& i_keywordsToSync,
+    types::IPZVpdMap& io_vpdMap) const noexcept
 {
-    std::string l_recordName = std::get<0>(i_recordKwName);
-    std::string l_keywordName = std::get<1>(i_recordKwName);
-
-    types::BinaryVector l_binaryValue = std::get<0>(i_binaryStrValue);
-    std::string l_strValue = std::get<1>(i_binaryStrValue);
-
-    if (i_fruPath.empty() || l_recordName.empty() || l_keywordName.empty() ||
-        l_binaryValue.empty() || l_strValue.empty())
+    if (i_keywordsToSync.empty())
     {
-        m_logger->logMessage("Invalid input received");
         return;
     }
 
-    // Update keyword's value on hardware
-    auto l_vpdParser = std::make_shared<Parser>(i_fruPath, m_sysCfgJsonObj);
+    try
+    {
+        if (i_fruPath.empty())
+        {
+            throw std::runtime_error("Invalid input received");
+        }
+
+        // A keyword which can't be written fails the whole batch, leave such
+        // keywords out.
+        std::vector<types::IpzType> l_invalidKeywords;
+        const auto l_keywordsToSync =
+            vpdSpecificUtility::getWritableIpzKeywords(
+                i_keywordsToSync, io_vpdMap, l_invalidKeywords);
 
-    const auto l_bytesUpdatedOnHardware = l_vpdParser->updateVpdKeyword(
-        types::IpzData(l_recordName, l_keywordName, l_binaryValue));
+        for (const auto& [l_recordName, l_keywordName] : l_invalidKeywords)
+        {
+            m_logger->logMessage("Skipping sync of keyword [" + l_recordName +
+                                 "][" + l_keywordName + "] on path [" +
+                                 i_fruPath + "], keyword can't be written.");
+        }
 
-    /* To keep the data in sync between hardware and parsed map
-    updating the o_vpdMap. This should only be done if write
-    on hardware returns success.*/
-    if (!o_vpdMap.empty() && l_bytesUpdatedOnHardware > 0)
+        if (l_keywordsToSync.empty())
+        {
+            return;
+        }
+
+        /* To keep the data in sync between hardware and parsed map
+        updating the io_vpdMap. This should only be done if write
+        on hardware returns success.*/
+        const auto l_updateVpdMap = [&io_vpdMap](
+                                        const types::IpzData& i_ipzData) {
+            if (!io_vpdMap.empty())
+            {
+                const auto& [l_recordName, l_keywordName, l_binaryValue] =
+                    i_ipzData;
+                io_vpdMap[l_recordName][l_keywordName].assign(
+                    l_binaryValue.begin(), l_binaryValue.end());
+            }
+        };
+
+        // Update keywords' value on hardware, one pass for all of them.
+        Parser l_vpdParser(i_fruPath, m_sysCfgJsonObj);
+
+        if (l_vpdParser.updateVpdKeywords(l_keywordsToSync) > 0)
+        {
+            std::ranges::for_each(l_keywordsToSync, l_updateVpdMap);
+            return;
+        }
+
+        if (l_keywordsToSync.size() == 1)
+        {
+            return;
+        }
+
+        // Retry keywords one by one, so that a keyword failing the batch
+        // doesn't hold back the rest.
+        m_logger->logMessage("Failed to sync keywords in a batch on path [" +
+                             i_fruPath + "], syncing them one by one.");
+
+        for (const auto& l_ipzData : l_keywordsToSync)
+        {
+            if (l_vpdParser.updateVpdKeyword(l_ipzData) > 0)
+            {
+                l_updateVpdMap(l_ipzData);
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
     {
-        o_vpdMap[l_recordName][l_keywordName] = l_strValue;
+        m_logger->logMessage("Failed to sync keywords on path [" + i_fruPath +
+                             "], error: " + std::string(l_ex.what()));
     }
 }
 
@@ -434,6 +485,10 @@ void BackupAndRestore::backupAndRestoreIpzVpd(types::IPZVpdMap& io_srcVpdMap,
         return;
     }
 
+    // Keywords to restore on each EEPROM, written once all are known.
+    std::vector<types::IpzData> l_srcKeywordsToSync;
+    std::vector<types::IpzData> l_dstKeywordsToSync;
+
     for (const auto& l_aRecordKwInfo :
          m_backupAndRestoreCfgJsonObj["backupMap"])
     {
@@ -486,19 +541,15 @@ void BackupAndRestore::backupAndRestoreIpzVpd(types::IPZVpdMap& io_srcVpdMap,
             // restore config JSON.
             if (l_dstBinaryValue == l_defaultBinaryValue)
             {
-                syncIpzData(m_dstFruPath,
-                            std::make_tuple(l_dstRecordName, l_dstKeywordName),
-                            std::make_tuple(l_srcBinaryValue, l_srcStrValue),
-                            io_dstVpdMap);
+                l_dstKeywordsToSync.emplace_back(
+                    l_dstRecordName, l_dstKeywordName, l_srcBinaryValue);
                 continue;
             }
 
             if (l_srcBinaryValue == l_defaultBinaryValue)
             {
-                syncIpzData(m_srcFruPath,
-                            std::make_tuple(l_srcRecordName, l_srcKeywordName),
-                            std::make_tuple(l_dstBinaryValue, l_dstStrValue),
-                            io_srcVpdMap);
+                l_srcKeywordsToSync.emplace_back(
+                    l_srcRecordName, l_srcKeywordName, l_dstBinaryValue);
             }
             else
             {
@@ -546,6 +597,9 @@ void BackupAndRestore::backupAndRestoreIpzVpd(types::IPZVpdMap& io_srcVpdMap,
                                     std::nullopt, std::nullopt});
         }
     }
+
+    syncIpzData(m_dstFruPath, l_dstKeywordsToSync, io_dstVpdMap);
+    syncIpzData(m_srcFruPath, l_srcKeywordsToSync, io_srcVpdMap);
 }
 
 void BackupAndRestore::setBackupAndRestoreStatus(
@@ -554,6 +608,36 @@ void BackupAndRestore::setBackupAndRestoreStatus(
     m_backupAndRestoreStatus = i_status;
 }
 
+std::string BackupAndRestore::getBackupCounterpartPath(
+    const std::string& i_fruPath, bool& o_inputPathIsSourcePath) const noexcept
+{
+    o_inputPathIsSourcePath = false;
+
+    if (!m_backupAndRestoreCfgJsonObj.contains("source") ||
+        !m_backupAndRestoreCfgJsonObj.contains("destination"))
+    {
+        return std::string{};
+    }
+
+    const std::string l_srcPath =
+        m_backupAndRestoreCfgJsonObj["source"].value("hardwarePath", "");
+    const std::string l_dstPath =
+        m_backupAndRestoreCfgJsonObj["destination"].value("hardwarePath", "");
+
+    if (l_srcPath.empty() || l_dstPath.empty())
+    {
+        return std::string{};
+    }
+
+    if (l_srcPath == i_fruPath)
+    {
+        o_inputPathIsSourcePath = true;
+        return l_dstPath;
+    }
+
+    return (l_dstPath == i_fruPath) ? l_srcPath : std::string{};
+}
+
 int BackupAndRestore::updateKeywordOnPrimaryOrBackupPath(
     const std::string& i_fruPath,
     const types::WriteVpdParams& i_paramsToWriteData) const noexcept
@@ -567,25 +651,9 @@ int BackupAndRestore::updateKeywordOnPrimaryOrBackupPath(
     bool l_inputPathIsSourcePath = false;
     bool l_inputPathIsDestinationPath = false;
 
-    if (m_backupAndRestoreCfgJsonObj.contains("source") &&
-        m_backupAndRestoreCfgJsonObj["source"].value("hardwarePath", "") ==
-            i_fruPath &&
-        m_backupAndRestoreCfgJsonObj.contains("destination") &&
-        !m_backupAndRestoreCfgJsonObj["destination"]
-             .value("hardwarePath", "")
-             .empty())
-    {
-        l_inputPathIsSourcePath = true;
-    }
-    else if (m_backupAndRestoreCfgJsonObj.contains("destination") &&
-             m_backupAndRestoreCfgJsonObj["destination"].value(
-                 "hardwarePath", "") == i_fruPath &&
-             m_backupAndRestoreCfgJsonObj.contains("source") &&
-             !m_backupAndRestoreCfgJsonObj["source"]
-                  .value("hardwarePath", "")
-                  .empty())
+    if (!getBackupCounterpartPath(i_fruPath, l_inputPathIsSourcePath).empty())
     {
-        l_inputPathIsDestinationPath = true;
+        l_inputPathIsDestinationPath = !l_inputPathIsSourcePath;
     }
     else
     {
@@ -667,4 +735,93 @@ int BackupAndRestore::updateKeywordOnPrimaryOrBackupPath(
     return constants::SUCCESS;
 }
 
+int BackupAndRestore::updateKeywordsOnPrimaryOrBackupPath(
+    const std::string& i_fruPath,
+    const std::vector<types::IpzData>& i_keywordsToUpdate) const noexcept
+{
+    if (i_fruPath.empty())
+    {
+        m_logger->logMessage("Given FRU path is empty.");
+        return constants::FAILURE;
+    }
+
+    bool l_inputPathIsSourcePath = false;
+    const std::string l_counterpartPath =
+        getBackupCounterpartPath(i_fruPath, l_inputPathIsSourcePath);
+
+    if (l_counterpartPath.empty() ||
+        !m_backupAndRestoreCfgJsonObj["backupMap"].is_array())
+    {
+        return constants::SUCCESS;
+    }
+
+    // Keywords mapped to their record and keyword on the counterpart path.
+    std::vector<types::IpzData> l_counterpartKeywords;
+
+    for (const auto& [l_inpRecordName, l_inpKeywordName, l_inpKeywordValue] :
+         i_keywordsToUpdate)
+    {
+        if (l_inpRecordName.empty() || l_inpKeywordName.empty() ||
+            l_inpKeywordValue.empty())
+        {
+            m_logger->logMessage("Invalid input received");
+            return constants::FAILURE;
+        }
+
+        for (const auto& l_aRecordKwInfo :
+             m_backupAndRestoreCfgJsonObj["backupMap"])
+        {
+            std::string l_srcRecordName{}, l_srcKeywordName{},
+                l_dstRecordName{}, l_dstKeywordName{};
+            types::BinaryVector l_defaultBinaryValue;
+
+            if (!extractAndValidateIpzRecordDetails(
+                    l_aRecordKwInfo,
+                    std::tie(l_srcRecordName, l_srcKeywordName, l_dstRecordName,
+                             l_dstKeywordName, l_defaultBinaryValue),
+                    std::nullopt, std::nullopt))
+            {
+                continue;
+            }
+
+            if (l_inputPathIsSourcePath &&
+                (l_srcRecordName == l_inpRecordName) &&
+                (l_srcKeywordName == l_inpKeywordName))
+            {
+                l_counterpartKeywords.emplace_back(
+                    l_dstRecordName, l_dstKeywordName, l_inpKeywordValue);
+                break;
+            }
+            else if (!l_inputPathIsSourcePath &&
+                     (l_dstRecordName == l_inpRecordName) &&
+                     (l_dstKeywordName == l_inpKeywordName))
+            {
+                l_counterpartKeywords.emplace_back(
+                    l_srcRecordName, l_srcKeywordName, l_inpKeywordValue);
+                break;
+            }
+        }
+    }
+
+    if (l_counterpartKeywords.empty())
+    {
+        // None of the keywords is part of backup & restore JSON.
+        return constants::SUCCESS;
+    }
+
+    try
+    {
+        Parser l_parserObj(l_counterpartPath, m_sysCfgJsonObj);
+        return l_parserObj.updateVpdKeywords(l_counterpartKeywords);
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage("Failed to update keywords on path [" +
+                             l_counterpartPath +
+                             "], error: " + std::string(l_ex.what()));
+    }
+
+    return constants::FAILURE;
+}
+
 } // namespace vpd
@@ -99,7 +99,7 @@ IbmBiosHandler::IbmBiosHandler(const std::shared_ptr<Manager>& i_manager) :
             "Failed to get config JSON. Error: {}",
             commonUtility::getErrCodeMsg(l_chassisJsonResult.error())));
     }
-    nlohmann::json l_sysCfgJsonObj = l_chassisJsonResult.value().get();
+    const nlohmann::json& l_sysCfgJsonObj = l_chassisJsonResult.value().get();
 
     if (l_sysCfgJsonObj.empty())
     {
@@ -0,0 +1,197 @@
+#include "collection_thread_pool.hpp"
+
+#include "constants.hpp"
+#include "logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <stdexcept>
+
+namespace vpd
+{
+CollectionThreadPool::CollectionThreadPool(size_t i_threadCount)
+{
+    i_threadCount = std::max<size_t>(1, i_threadCount);
+
+    m_queues.reserve(i_threadCount);
+    for (size_t l_index = 0; l_index < i_threadCount; ++l_index)
+    {
+        m_queues.emplace_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(i_threadCount);
+    try
+    {
+        for (size_t l_index = 0; l_index < i_threadCount; ++l_index)
+        {
+            m_workers.emplace_back(
+                [this, l_index]() { workerLoop(l_index); });
+        }
+    }
+    catch (...)
+    {
+        // Join the workers which got created, before bailing out.
+        {
+            std::lock_guard<std::mutex> l_lock(m_idleMutex);
+            m_stop = true;
+        }
+        m_idleCv.notify_all();
+
+        for (auto& l_worker : m_workers)
+        {
+            l_worker.join();
+        }
+        throw;
+    }
+}
+
+CollectionThreadPool::~CollectionThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> l_lock(m_idleMutex);
+        m_stop = true;
+    }
+    m_idleCv.notify_all();
+
+    for (auto& l_worker : m_workers)
+    {
+        if (l_worker.joinable())
+        {
+            l_worker.join();
+        }
+    }
+}
+
+void CollectionThreadPool::submit(std::function<void()> i_task)
+{
+    if (!i_task)
+    {
+        throw std::runtime_error("Empty task can't be submitted to the pool.");
+    }
+
+    const size_t l_queueIndex =
+        m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+    {
+        std::lock_guard<std::mutex> l_lock(m_idleMutex);
+        if (m_stop)
+        {
+            throw std::runtime_error("Thread pool is stopping.");
+        }
+
+        std::lock_guard<std::mutex> l_queueLock(
+            m_queues[l_queueIndex]->m_mutex);
+
+        // Counted before the push under queue's lock, so a worker popping the
+        // task right away never takes the count below zero.
+        ++m_queuedTasks;
+        try
+        {
+            m_queues[l_queueIndex]->m_tasks.emplace_back(std::move(i_task));
+        }
+        catch (...)
+        {
+            --m_queuedTasks;
+            throw;
+        }
+    }
+    m_idleCv.notify_one();
+}
+
+bool CollectionThreadPool::popTask(const size_t i_workerIndex,
+                                   std::function<void()>& o_task,
+                                   bool& o_isQueueSkipped) noexcept
+{
+    o_isQueueSkipped = false;
+
+    // Own queue first, most recently queued task.
+    {
+        WorkQueue& l_ownQueue = *m_queues[i_workerIndex];
+        std::lock_guard<std::mutex> l_lock(l_ownQueue.m_mutex);
+        if (!l_ownQueue.m_tasks.empty())
+        {
+            o_task = std::move(l_ownQueue.m_tasks.back());
+            l_ownQueue.m_tasks.pop_back();
+            --m_queuedTasks;
+            return true;
+        }
+    }
+
+    // Steal oldest task from other queues.
+    for (size_t l_offset = 1; l_offset < m_queues.size(); ++l_offset)
+    {
+        WorkQueue& l_victimQueue =
+            *m_queues[(i_workerIndex + l_offset) % m_queues.size()];
+
+        std::unique_lock<std::mutex> l_lock(l_victimQueue.m_mutex,
+                                            std::try_to_lock);
+        if (!l_lock.owns_lock())
+        {
+            o_isQueueSkipped = true;
+            continue;
+        }
+
+        if (l_victimQueue.m_tasks.empty())
+        {
+            continue;
+        }
+
+        o_task = std::move(l_victimQueue.m_tasks.front());
+        l_victimQueue.m_tasks.pop_front();
+        --m_queuedTasks;
+        m_stolenTasks.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+void CollectionThreadPool::workerLoop(const size_t i_workerIndex) noexcept
+{
+    while (true)
+    {
+        std::function<void()> l_task;
+        bool l_isQueueSkipped = false;
+
+        if (popTask(i_workerIndex, l_task, l_isQueueSkipped))
+        {
+            try
+            {
+                l_task();
+            }
+            catch (const std::exception& l_ex)
+            {
+                Logger::getLoggerInstance()->logMessage(std::format(
+                    "Task in collection thread pool failed, error: {}",
+                    l_ex.what()));
+            }
+            m_completedTasks.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> l_lock(m_idleMutex);
+
+        if (l_isQueueSkipped)
+        {
+            // Skipped queue may hold the queued tasks, look again after a
+            // short back off instead of spinning on its lock. A submit ends
+            // the back off early.
+            m_idleCv.wait_for(
+                l_lock,
+                std::chrono::microseconds(constants::STEAL_BACKOFF_TIME_US));
+        }
+        else
+        {
+            m_idleCv.wait(l_lock, [this]() {
+                return m_stop || m_queuedTasks.load() > 0;
+            });
+        }
+
+        if (m_stop && m_queuedTasks.load() == 0)
+        {
+            return;
+        }
+    }
+}
+} // namespace vpd
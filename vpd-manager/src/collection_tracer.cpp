@@ -0,0 +1,258 @@
+#include "config.h"
+
+#include "collection_tracer.hpp"
+
+#include "constants.hpp"
+#include "error_codes.hpp"
+#include "logger.hpp"
+
+#include <unistd.h>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <string_view>
+
+namespace vpd
+{
+const std::shared_ptr<CollectionTracer>& CollectionTracer::getTracerInstance()
+{
+    static std::shared_ptr<CollectionTracer> l_tracerInstance(
+        new CollectionTracer());
+    return l_tracerInstance;
+}
+
+CollectionTracer::CollectionTracer()
+{
+    bool l_isRequested = (VPD_COLLECTION_TRACE != 0);
+
+    // Environment takes precedence over the build time default.
+    if (const char* l_traceEnv = std::getenv("VPD_COLLECTION_TRACE");
+        l_traceEnv != nullptr)
+    {
+        l_isRequested = (std::string_view(l_traceEnv) == "1");
+    }
+
+    m_isRequested.store(l_isRequested, std::memory_order_relaxed);
+}
+
+void CollectionTracer::startSession() noexcept
+{
+    // Threads rewrite their spans once the new session starts, wait for any
+    // dump reading them.
+    std::lock_guard<std::mutex> l_lock(m_buffersMutex);
+
+    m_sessionStartTicks.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed);
+
+    // Threads reset their buffer on seeing the new session.
+    m_session.fetch_add(1, std::memory_order_acq_rel);
+    m_isEnabled.store(true, std::memory_order_release);
+}
+
+void CollectionTracer::stopSession() noexcept
+{
+    m_isEnabled.store(false, std::memory_order_release);
+}
+
+CollectionTracer::ThreadBuffer* CollectionTracer::getThreadBuffer() noexcept
+{
+    // Buffer is shared with m_buffers, so it stays valid after thread exit.
+    thread_local ThreadBuffer* l_threadBuffer = nullptr;
+
+    if (l_threadBuffer == nullptr)
+    {
+        try
+        {
+            auto l_buffer = std::make_shared<ThreadBuffer>();
+            l_buffer->m_threadId = gettid();
+            l_buffer->m_spans.resize(constants::MAX_TRACE_SPANS_PER_THREAD);
+
+            std::lock_guard<std::mutex> l_lock(m_buffersMutex);
+            m_buffers.emplace_back(l_buffer);
+            l_threadBuffer = l_buffer.get();
+        }
+        catch (const std::exception& l_ex)
+        {
+            Logger::getLoggerInstance()->logMessage(
+                "Failed to create collection trace buffer, error: " +
+                std::string(l_ex.what()));
+            return nullptr;
+        }
+    }
+
+    return l_threadBuffer;
+}
+
+void CollectionTracer::recordSpan(
+    const char* i_phase, std::string_view i_fruPath,
+    const std::chrono::steady_clock::time_point i_startTime,
+    const std::chrono::steady_clock::time_point i_endTime) noexcept
+{
+    if (!m_isEnabled.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    ThreadBuffer* l_buffer = getThreadBuffer();
+    if (l_buffer == nullptr)
+    {
+        return;
+    }
+
+    const uint64_t l_session = m_session.load(std::memory_order_acquire);
+    if (l_buffer->m_session.load(std::memory_order_relaxed) != l_session)
+    {
+        l_buffer->m_count.store(0, std::memory_order_relaxed);
+        l_buffer->m_droppedCount.store(0, std::memory_order_relaxed);
+        l_buffer->m_session.store(l_session, std::memory_order_release);
+    }
+
+    const size_t l_index = l_buffer->m_count.load(std::memory_order_relaxed);
+    if (l_index >= l_buffer->m_spans.size())
+    {
+        l_buffer->m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point l_sessionStartTime{
+        std::chrono::steady_clock::duration{
+            m_sessionStartTicks.load(std::memory_order_relaxed)}};
+
+    Span& l_span = l_buffer->m_spans[l_index];
+    try
+    {
+        l_span.m_fruPath.assign(i_fruPath);
+    }
+    catch (const std::exception&)
+    {
+        l_span.m_fruPath.clear();
+    }
+    l_span.m_phase = i_phase;
+    l_span.m_startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           i_startTime - l_sessionStartTime)
+                           .count();
+    l_span.m_durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              i_endTime - i_startTime)
+                              .count();
+
+    l_buffer->m_count.store(l_index + 1, std::memory_order_release);
+}
+
+size_t CollectionTracer::dumpChromeTrace(const std::string& i_filePath,
+                                         uint16_t& o_errCode) const noexcept
+{
+    o_errCode = 0;
+    size_t l_spanCount = 0;
+
+    try
+    {
+        const pid_t l_processId = getpid();
+        size_t l_droppedCount = 0;
+
+        nlohmann::json l_events = nlohmann::json::array();
+
+        // Spans are copied under the lock, which keeps a new session from
+        // starting and threads from rewriting them meanwhile.
+        std::unique_lock<std::mutex> l_lock(m_buffersMutex);
+        const uint64_t l_session = m_session.load(std::memory_order_acquire);
+
+        for (const auto& l_buffer : m_buffers)
+        {
+            if (l_buffer->m_session.load(std::memory_order_acquire) !=
+                l_session)
+            {
+                continue;
+            }
+
+            const size_t l_count =
+                l_buffer->m_count.load(std::memory_order_acquire);
+            l_droppedCount +=
+                l_buffer->m_droppedCount.load(std::memory_order_relaxed);
+
+            for (size_t l_index = 0; l_index < l_count; ++l_index)
+            {
+                const Span& l_span = l_buffer->m_spans[l_index];
+
+                // Chrome trace event format expects time in microseconds.
+                l_events.push_back(
+                    {{"name", l_span.m_phase},
+                     {"cat", "vpd"},
+                     {"ph", "X"},
+                     {"ts", static_cast<double>(l_span.m_startNs) / 1000.0},
+                     {"dur", static_cast<double>(l_span.m_durationNs) / 1000.0},
+                     {"pid", l_processId},
+                     {"tid", l_buffer->m_threadId},
+                     {"args", {{"fru", l_span.m_fruPath}}}});
+            }
+            l_spanCount += l_count;
+        }
+        l_lock.unlock();
+
+        const nlohmann::json l_trace = {
+            {"traceEvents", std::move(l_events)},
+            {"displayTimeUnit", "ms"},
+            {"otherData", {{"droppedSpans", l_droppedCount}}}};
+
+        std::ofstream l_traceFile(i_filePath, std::ios::out | std::ios::trunc);
+        if (!l_traceFile)
+        {
+            o_errCode = error_code::FILE_ACCESS_ERROR;
+            return 0;
+        }
+
+        l_traceFile << l_trace;
+        if (!l_traceFile)
+        {
+            o_errCode = error_code::FILE_SYSTEM_ERROR;
+            return 0;
+        }
+
+        if (l_droppedCount > 0)
+        {
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "Collection trace dropped {} spans, buffers were full.",
+                l_droppedCount));
+        }
+    }
+    catch (const std::exception&)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+        return 0;
+    }
+
+    return l_spanCount;
+}
+
+std::vector<int64_t> CollectionTracer::getSpanDurations(
+    std::string_view i_phase) const
+{
+    std::vector<int64_t> l_durations;
+
+    std::lock_guard<std::mutex> l_lock(m_buffersMutex);
+    const uint64_t l_session = m_session.load(std::memory_order_acquire);
+    for (const auto& l_buffer : m_buffers)
+    {
+        if (l_buffer->m_session.load(std::memory_order_acquire) != l_session)
+        {
+            continue;
+        }
+
+        const size_t l_count =
+            l_buffer->m_count.load(std::memory_order_acquire);
+        for (size_t l_index = 0; l_index < l_count; ++l_index)
+        {
+            const Span& l_span = l_buffer->m_spans[l_index];
+            if (l_span.m_phase != nullptr && i_phase == l_span.m_phase)
+            {
+                l_durations.push_back(l_span.m_durationNs);
+            }
+        }
+    }
+
+    return l_durations;
+}
+} // namespace vpd
@@ -0,0 +1,634 @@
+#include "config_index.hpp"
+
+#include "constants.hpp"
+#include "error_codes.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <filesystem>
+#include <limits>
+#include <utility>
+#include <unordered_map>
+
+namespace vpd
+{
+namespace
+{
+// Boolean tags of base FRU held as flags.
+constexpr std::array<std::pair<const char*, ConfigIndexFlag>, 7>
+    booleanTagFlags{{{"isSystemVpd", IS_SYSTEM_VPD},
+                     {"replaceableAtStandby", REPLACEABLE_AT_STANDBY},
+                     {"replaceableAtRuntime", REPLACEABLE_AT_RUNTIME},
+                     {"powerOffOnly", POWER_OFF_ONLY},
+                     {"essentialFru", ESSENTIAL_FRU},
+                     {"handlePresence", HANDLE_PRESENCE},
+                     {"monitorPresence", MONITOR_PRESENCE}}};
+
+// Action tags of base FRU, presence of which is held as flags.
+constexpr std::array<std::pair<const char*, ConfigIndexFlag>, 3>
+    actionTagFlags{{{"preAction", HAS_PRE_ACTION},
+                    {"postAction", HAS_POST_ACTION},
+                    {"postFailAction", HAS_POST_FAIL_ACTION}}};
+
+/**
+ * @brief API to read a boolean tag of FRU JSON.
+ *
+ * @param[in] i_fruJson - FRU JSON.
+ * @param[in] i_tag - Tag to read.
+ *
+ * @return Value of the tag, false if absent or not a boolean.
+ */
+bool isTagSet(const nlohmann::json& i_fruJson, const char* i_tag)
+{
+    const auto l_tagItr = i_fruJson.find(i_tag);
+    return l_tagItr != i_fruJson.end() && l_tagItr->is_boolean() &&
+           l_tagItr->get<bool>();
+}
+
+/**
+ * @brief API to read a string tag of FRU JSON.
+ *
+ * @param[in] i_fruJson - FRU JSON.
+ * @param[in] i_tag - Tag to read.
+ *
+ * @return Value of the tag, empty if absent or not a string.
+ */
+std::string getStringTag(const nlohmann::json& i_fruJson, const char* i_tag)
+{
+    const auto l_tagItr = i_fruJson.find(i_tag);
+    return (l_tagItr != i_fruJson.end() && l_tagItr->is_string())
+               ? l_tagItr->get<std::string>()
+               : std::string{};
+}
+
+/**
+ * @brief API to read unexpanded location code of FRU JSON.
+ *
+ * @param[in] i_fruJson - FRU JSON.
+ *
+ * @return Location code, empty if absent.
+ */
+std::string getLocationCode(const nlohmann::json& i_fruJson)
+{
+    const auto l_extraInterfacesItr = i_fruJson.find("extraInterfaces");
+    if (l_extraInterfacesItr == i_fruJson.end() ||
+        !l_extraInterfacesItr->is_object())
+    {
+        return std::string{};
+    }
+
+    const auto l_locationInfItr =
+        l_extraInterfacesItr->find(constants::locationCodeInf);
+    if (l_locationInfItr == l_extraInterfacesItr->end() ||
+        !l_locationInfItr->is_object())
+    {
+        return std::string{};
+    }
+
+    return getStringTag(*l_locationInfItr, "LocationCode");
+}
+
+/**
+ * @brief API to append a trivially copyable object to an image.
+ *
+ * @param[in,out] io_image - Image.
+ * @param[in] i_object - Object to append.
+ */
+template <typename T>
+void appendToImage(std::vector<std::byte>& io_image, const T& i_object)
+{
+    const auto* l_bytes = reinterpret_cast<const std::byte*>(&i_object);
+    io_image.insert(io_image.end(), l_bytes, l_bytes + sizeof(T));
+}
+} // namespace
+
+ConfigIndex::~ConfigIndex()
+{
+    reset();
+}
+
+void ConfigIndex::reset() noexcept
+{
+    if (m_mappedAddress != nullptr)
+    {
+        munmap(m_mappedAddress, m_mappedSize);
+        m_mappedAddress = nullptr;
+        m_mappedSize = 0;
+    }
+
+    m_ownedImage.clear();
+    m_image = std::span<const std::byte>{};
+}
+
+uint64_t ConfigIndex::getSourceHash(std::string_view i_jsonText) noexcept
+{
+    constexpr uint64_t l_fnvOffsetBasis = 0xcbf29ce484222325ULL;
+    constexpr uint64_t l_fnvPrime = 0x100000001b3ULL;
+
+    uint64_t l_hash = l_fnvOffsetBasis;
+    for (const char l_char : i_jsonText)
+    {
+        l_hash ^= static_cast<uint8_t>(l_char);
+        l_hash *= l_fnvPrime;
+    }
+    return l_hash;
+}
+
+std::string ConfigIndex::getIndexPath(const std::string& i_jsonPath) noexcept
+{
+    try
+    {
+        std::error_code l_ec;
+        std::filesystem::path l_jsonPath =
+            std::filesystem::canonical(i_jsonPath, l_ec);
+        if (l_ec)
+        {
+            return std::string{};
+        }
+
+        return l_jsonPath.replace_extension(FILE_EXTENSION).string();
+    }
+    catch (const std::exception&)
+    {
+        return std::string{};
+    }
+}
+
+std::vector<std::byte> ConfigIndex::compile(
+    const nlohmann::json& i_sysCfgJson, const uint64_t i_sourceHash,
+    std::vector<std::string>& o_skippedEepromPaths,
+    uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    o_skippedEepromPaths.clear();
+
+    try
+    {
+        const auto l_frusItr = i_sysCfgJson.find("frus");
+        if (l_frusItr == i_sysCfgJson.end() || !l_frusItr->is_object())
+        {
+            o_errCode = error_code::INVALID_JSON;
+            return {};
+        }
+
+        std::string l_stringTable;
+        std::unordered_map<std::string, StringRef> l_internedStrings;
+
+        // Same string, e.g. service name, is stored once.
+        const auto l_intern = [&l_stringTable,
+                               &l_internedStrings](const std::string& i_value) {
+            if (const auto l_itr = l_internedStrings.find(i_value);
+                l_itr != l_internedStrings.end())
+            {
+                return l_itr->second;
+            }
+
+            const StringRef l_stringRef{
+                static_cast<uint32_t>(l_stringTable.size()),
+                static_cast<uint32_t>(i_value.size())};
+            l_stringTable.append(i_value);
+            l_internedStrings.emplace(i_value, l_stringRef);
+            return l_stringRef;
+        };
+
+        // FRU entries along with their EEPROM path, to sort them.
+        std::vector<std::pair<std::string, FruEntry>> l_fruEntries;
+
+        for (const auto& [l_eepromPath, l_fruArray] : l_frusItr->items())
+        {
+            // Malformed FRU is skipped, as when the JSON is read directly.
+            if (!l_fruArray.is_array() || l_fruArray.empty() ||
+                !l_fruArray.at(0).is_object())
+            {
+                o_skippedEepromPaths.push_back(l_eepromPath);
+                continue;
+            }
+
+            const nlohmann::json& l_baseFru = l_fruArray.at(0);
+
+            const auto l_offsetItr = l_baseFru.find("offset");
+            const bool l_isOffsetPresent = (l_offsetItr != l_baseFru.end());
+            const int64_t l_vpdOffset =
+                (l_isOffsetPresent && l_offsetItr->is_number_integer())
+                    ? l_offsetItr->get<int64_t>()
+                    : 0;
+
+            if ((l_isOffsetPresent && !l_offsetItr->is_number_integer()) ||
+                l_vpdOffset < 0 ||
+                l_vpdOffset > std::numeric_limits<uint32_t>::max())
+            {
+                o_skippedEepromPaths.push_back(l_eepromPath);
+                continue;
+            }
+
+            uint32_t l_flags = 0;
+            for (const auto& [l_tag, l_flag] : booleanTagFlags)
+            {
+                if (isTagSet(l_baseFru, l_tag))
+                {
+                    l_flags |= l_flag;
+                }
+            }
+            for (const auto& [l_tag, l_flag] : actionTagFlags)
+            {
+                if (l_baseFru.contains(l_tag))
+                {
+                    l_flags |= l_flag;
+                }
+            }
+
+            FruEntry l_fruEntry{};
+            l_fruEntry.m_eepromPath = l_intern(l_eepromPath);
+            l_fruEntry.m_inventoryPath =
+                l_intern(getStringTag(l_baseFru, "inventoryPath"));
+            l_fruEntry.m_redundantEeprom =
+                l_intern(getStringTag(l_baseFru, "redundantEeprom"));
+            l_fruEntry.m_serviceName =
+                l_intern(getStringTag(l_baseFru, "serviceName"));
+            l_fruEntry.m_locationCode = l_intern(getLocationCode(l_baseFru));
+            l_fruEntry.m_vpdOffset = static_cast<uint32_t>(l_vpdOffset);
+            l_fruEntry.m_flags = l_flags;
+
+            l_fruEntries.emplace_back(l_eepromPath, l_fruEntry);
+        }
+
+        std::ranges::sort(l_fruEntries, {}, [](const auto& i_entry) {
+            return std::string_view(i_entry.first);
+        });
+
+        // Tables of FRU entry indexes sorted by the respective path.
+        const auto l_getPath = [&l_stringTable](const StringRef& i_stringRef) {
+            return std::string_view(l_stringTable)
+                .substr(i_stringRef.m_offset, i_stringRef.m_length);
+        };
+
+        std::vector<uint32_t> l_inventoryTable;
+        std::vector<uint32_t> l_redundantTable;
+        for (uint32_t l_index = 0; l_index < l_fruEntries.size(); ++l_index)
+        {
+            const FruEntry& l_fruEntry = l_fruEntries[l_index].second;
+            if (l_fruEntry.m_inventoryPath.m_length > 0)
+            {
+                l_inventoryTable.push_back(l_index);
+            }
+            if (l_fruEntry.m_redundantEeprom.m_length > 0)
+            {
+                l_redundantTable.push_back(l_index);
+            }
+        }
+
+        // Stable, so that a shared path resolves to the lowest EEPROM path.
+        std::ranges::stable_sort(
+            l_inventoryTable, {}, [&](const uint32_t i_index) {
+                return l_getPath(l_fruEntries[i_index].second.m_inventoryPath);
+            });
+        std::ranges::stable_sort(
+            l_redundantTable, {}, [&](const uint32_t i_index) {
+                return l_getPath(
+                    l_fruEntries[i_index].second.m_redundantEeprom);
+            });
+
+        Header l_header{};
+        l_header.m_magic = MAGIC;
+        l_header.m_version = VERSION;
+        l_header.m_sourceHash = i_sourceHash;
+        l_header.m_fruCount = static_cast<uint32_t>(l_fruEntries.size());
+        l_header.m_inventoryCount =
+            static_cast<uint32_t>(l_inventoryTable.size());
+        l_header.m_redundantCount =
+            static_cast<uint32_t>(l_redundantTable.size());
+        l_header.m_fruTableOffset = sizeof(Header);
+        l_header.m_inventoryTableOffset =
+            l_header.m_fruTableOffset + l_header.m_fruCount * sizeof(FruEntry);
+        l_header.m_redundantTableOffset =
+            l_header.m_inventoryTableOffset +
+            l_header.m_inventoryCount * sizeof(uint32_t);
+        l_header.m_stringTableOffset =
+            l_header.m_redundantTableOffset +
+            l_header.m_redundantCount * sizeof(uint32_t);
+        l_header.m_stringTableSize = static_cast<uint32_t>(l_stringTable.size());
+        l_header.m_imageSize =
+            l_header.m_stringTableOffset + l_header.m_stringTableSize;
+
+        std::vector<std::byte> l_image;
+        l_image.reserve(l_header.m_imageSize);
+
+        appendToImage(l_image, l_header);
+        for (const auto& l_fruEntry : l_fruEntries)
+        {
+            appendToImage(l_image, l_fruEntry.second);
+        }
+        for (const uint32_t l_index : l_inventoryTable)
+        {
+            appendToImage(l_image, l_index);
+        }
+        for (const uint32_t l_index : l_redundantTable)
+        {
+            appendToImage(l_image, l_index);
+        }
+
+        const auto* l_strings =
+            reinterpret_cast<const std::byte*>(l_stringTable.data());
+        l_image.insert(l_image.end(), l_strings,
+                       l_strings + l_stringTable.size());
+
+        return l_image;
+    }
+    catch (const std::exception&)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+        return {};
+    }
+}
+
+bool ConfigIndex::isValidImage(std::span<const std::byte> i_image,
+                               const uint64_t i_sourceHash) noexcept
+{
+    if (i_image.size() < sizeof(Header) ||
+        reinterpret_cast<uintptr_t>(i_image.data()) % alignof(Header) != 0)
+    {
+        return false;
+    }
+
+    const Header& l_header = *reinterpret_cast<const Header*>(i_image.data());
+
+    if (l_header.m_magic != MAGIC || l_header.m_version != VERSION ||
+        l_header.m_sourceHash != i_sourceHash ||
+        l_header.m_imageSize != i_image.size())
+    {
+        return false;
+    }
+
+    // Tables are laid out back to back, check the layout and the bounds.
+    const uint64_t l_fruTableEnd =
+        uint64_t{l_header.m_fruTableOffset} +
+        uint64_t{l_header.m_fruCount} * sizeof(FruEntry);
+    const uint64_t l_inventoryTableEnd =
+        uint64_t{l_header.m_inventoryTableOffset} +
+        uint64_t{l_header.m_inventoryCount} * sizeof(uint32_t);
+    const uint64_t l_redundantTableEnd =
+        uint64_t{l_header.m_redundantTableOffset} +
+        uint64_t{l_header.m_redundantCount} * sizeof(uint32_t);
+    const uint64_t l_stringTableEnd = uint64_t{l_header.m_stringTableOffset} +
+                                      uint64_t{l_header.m_stringTableSize};
+
+    if (l_header.m_fruTableOffset != sizeof(Header) ||
+        l_header.m_inventoryTableOffset != l_fruTableEnd ||
+        l_header.m_redundantTableOffset != l_inventoryTableEnd ||
+        l_header.m_stringTableOffset != l_redundantTableEnd ||
+        l_stringTableEnd != l_header.m_imageSize ||
+        l_header.m_inventoryCount > l_header.m_fruCount ||
+        l_header.m_redundantCount > l_header.m_fruCount)
+    {
+        return false;
+    }
+
+    // Validate references once, so that lookups need no checks.
+    const auto* l_fruEntries = reinterpret_cast<const FruEntry*>(
+        i_image.data() + l_header.m_fruTableOffset);
+
+    const auto l_isValidString = [&l_header](const StringRef& i_stringRef) {
+        return uint64_t{i_stringRef.m_offset} + i_stringRef.m_length <=
+               l_header.m_stringTableSize;
+    };
+
+    for (uint32_t l_index = 0; l_index < l_header.m_fruCount; ++l_index)
+    {
+        const FruEntry& l_fruEntry = l_fruEntries[l_index];
+        if (!l_isValidString(l_fruEntry.m_eepromPath) ||
+            !l_isValidString(l_fruEntry.m_inventoryPath) ||
+            !l_isValidString(l_fruEntry.m_redundantEeprom) ||
+            !l_isValidString(l_fruEntry.m_serviceName) ||
+            !l_isValidString(l_fruEntry.m_locationCode))
+        {
+            return false;
+        }
+    }
+
+    const auto l_isValidTable = [&i_image, &l_header](const uint32_t i_offset,
+                                                      const uint32_t i_count) {
+        const auto* l_table =
+            reinterpret_cast<const uint32_t*>(i_image.data() + i_offset);
+        return std::all_of(l_table, l_table + i_count,
+                           [&l_header](const uint32_t i_index) {
+                               return i_index < l_header.m_fruCount;
+                           });
+    };
+
+    return l_isValidTable(l_header.m_inventoryTableOffset,
+                          l_header.m_inventoryCount) &&
+           l_isValidTable(l_header.m_redundantTableOffset,
+                          l_header.m_redundantCount);
+}
+
+bool ConfigIndex::load(const std::string& i_indexPath,
+                       const uint64_t i_sourceHash,
+                       uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    reset();
+
+    const int l_fd = open(i_indexPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (l_fd < 0)
+    {
+        o_errCode = (errno == ENOENT) ? error_code::FILE_NOT_FOUND
+                                      : error_code::FILE_ACCESS_ERROR;
+        return false;
+    }
+
+    struct stat l_fileStat{};
+    if (fstat(l_fd, &l_fileStat) < 0 || l_fileStat.st_size <= 0)
+    {
+        close(l_fd);
+        o_errCode = error_code::INVALID_CONFIG_INDEX;
+        return false;
+    }
+
+    const size_t l_fileSize = static_cast<size_t>(l_fileStat.st_size);
+    void* l_address =
+        mmap(nullptr, l_fileSize, PROT_READ, MAP_PRIVATE, l_fd, 0);
+
+    // Mapping stays valid after the descriptor is closed.
+    close(l_fd);
+
+    if (l_address == MAP_FAILED)
+    {
+        o_errCode = error_code::FILE_ACCESS_ERROR;
+        return false;
+    }
+
+    const std::span<const std::byte> l_image(
+        static_cast<const std::byte*>(l_address), l_fileSize);
+
+    if (!isValidImage(l_image, i_sourceHash))
+    {
+        munmap(l_address, l_fileSize);
+        o_errCode = error_code::INVALID_CONFIG_INDEX;
+        return false;
+    }
+
+    m_mappedAddress = l_address;
+    m_mappedSize = l_fileSize;
+    m_image = l_image;
+    return true;
+}
+
+bool ConfigIndex::assign(std::vector<std::byte>&& i_image,
+                         const uint64_t i_sourceHash,
+                         uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    reset();
+
+    if (!isValidImage(i_image, i_sourceHash))
+    {
+        o_errCode = error_code::INVALID_CONFIG_INDEX;
+        return false;
+    }
+
+    m_ownedImage = std::move(i_image);
+    m_image = m_ownedImage;
+    return true;
+}
+
+size_t ConfigIndex::getFruCount() const noexcept
+{
+    return isValid() ? getHeader().m_fruCount : 0;
+}
+
+std::span<const ConfigIndex::FruEntry> ConfigIndex::getFruTable() const noexcept
+{
+    const Header& l_header = getHeader();
+    return std::span<const FruEntry>(
+        reinterpret_cast<const FruEntry*>(m_image.data() +
+                                          l_header.m_fruTableOffset),
+        l_header.m_fruCount);
+}
+
+std::span<const uint32_t> ConfigIndex::getIndexTable(
+    const uint32_t i_offset, const uint32_t i_count) const noexcept
+{
+    return std::span<const uint32_t>(
+        reinterpret_cast<const uint32_t*>(m_image.data() + i_offset), i_count);
+}
+
+std::string_view ConfigIndex::getString(
+    const StringRef& i_stringRef) const noexcept
+{
+    return std::string_view(
+        reinterpret_cast<const char*>(m_image.data() +
+                                      getHeader().m_stringTableOffset +
+                                      i_stringRef.m_offset),
+        i_stringRef.m_length);
+}
+
+ConfigIndexRecord ConfigIndex::getRecord(
+    const FruEntry& i_fruEntry) const noexcept
+{
+    return ConfigIndexRecord{getString(i_fruEntry.m_eepromPath),
+                             getString(i_fruEntry.m_inventoryPath),
+                             getString(i_fruEntry.m_redundantEeprom),
+                             getString(i_fruEntry.m_serviceName),
+                             getString(i_fruEntry.m_locationCode),
+                             i_fruEntry.m_vpdOffset, i_fruEntry.m_flags};
+}
+
+std::optional<ConfigIndexRecord> ConfigIndex::findByEepromPath(
+    std::string_view i_eepromPath) const noexcept
+{
+    if (!isValid() || i_eepromPath.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto l_fruTable = getFruTable();
+    const auto l_fruItr = std::ranges::lower_bound(
+        l_fruTable, i_eepromPath, {}, [this](const FruEntry& i_fruEntry) {
+            return getString(i_fruEntry.m_eepromPath);
+        });
+
+    if (l_fruItr == l_fruTable.end() ||
+        getString(l_fruItr->m_eepromPath) != i_eepromPath)
+    {
+        return std::nullopt;
+    }
+
+    return getRecord(*l_fruItr);
+}
+
+std::optional<ConfigIndexRecord> ConfigIndex::findInTable(
+    std::span<const uint32_t> i_table, std::string_view i_path,
+    StringRef FruEntry::* i_pathMember) const noexcept
+{
+    if (i_path.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto l_fruTable = getFruTable();
+    const auto l_getPath = [this, &l_fruTable,
+                            i_pathMember](const uint32_t i_index) {
+        return getString(l_fruTable[i_index].*i_pathMember);
+    };
+
+    const auto l_indexItr =
+        std::ranges::lower_bound(i_table, i_path, {}, l_getPath);
+
+    if (l_indexItr == i_table.end() || l_getPath(*l_indexItr) != i_path)
+    {
+        return std::nullopt;
+    }
+
+    return getRecord(l_fruTable[*l_indexItr]);
+}
+
+std::optional<ConfigIndexRecord> ConfigIndex::findByInventoryPath(
+    std::string_view i_inventoryPath) const noexcept
+{
+    if (!isValid())
+    {
+        return std::nullopt;
+    }
+
+    const Header& l_header = getHeader();
+    return findInTable(getIndexTable(l_header.m_inventoryTableOffset,
+                                     l_header.m_inventoryCount),
+                       i_inventoryPath, &FruEntry::m_inventoryPath);
+}
+
+std::optional<ConfigIndexRecord> ConfigIndex::findByRedundantEeprom(
+    std::string_view i_redundantEeprom) const noexcept
+{
+    if (!isValid())
+    {
+        return std::nullopt;
+    }
+
+    const Header& l_header = getHeader();
+    return findInTable(getIndexTable(l_header.m_redundantTableOffset,
+                                     l_header.m_redundantCount),
+                       i_redundantEeprom, &FruEntry::m_redundantEeprom);
+}
+
+std::optional<ConfigIndexRecord> ConfigIndex::findFru(
+    std::string_view i_vpdPath) const noexcept
+{
+    if (auto l_record = findByEepromPath(i_vpdPath))
+    {
+        return l_record;
+    }
+
+    if (auto l_record = findByRedundantEeprom(i_vpdPath))
+    {
+        return l_record;
+    }
+
+    return findByInventoryPath(i_vpdPath);
+}
+} // namespace vpd
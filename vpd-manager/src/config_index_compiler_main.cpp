@@ -0,0 +1,87 @@
+#include "config_index.hpp"
+#include "error_codes.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ * @brief This file implements the build time config index compiler.
+ *
+ * It receives path of a system config JSON and path of the index to generate.
+ * The generated index records hash of the JSON text, vpd-manager uses it only
+ * along with the same JSON.
+ *
+ * Usage: vpd-config-index-compiler <system config JSON> <output index>
+ */
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " <system config JSON> <output index>" << std::endl;
+        return -1;
+    }
+
+    const std::string l_jsonPath{argv[1]};
+    const std::string l_indexPath{argv[2]};
+
+    std::ifstream l_jsonFile(l_jsonPath, std::ios::binary);
+    if (!l_jsonFile)
+    {
+        std::cerr << "Failed to open " << l_jsonPath << std::endl;
+        return -1;
+    }
+
+    const std::string l_jsonText{std::istreambuf_iterator<char>(l_jsonFile),
+                                 std::istreambuf_iterator<char>()};
+
+    const nlohmann::json l_sysCfgJson =
+        nlohmann::json::parse(l_jsonText, nullptr, false);
+    if (l_sysCfgJson.is_discarded())
+    {
+        std::cerr << "Failed to parse " << l_jsonPath << std::endl;
+        return -1;
+    }
+
+    uint16_t l_errCode = 0;
+    std::vector<std::string> l_skippedEepromPaths;
+    const auto l_image = vpd::ConfigIndex::compile(
+        l_sysCfgJson, vpd::ConfigIndex::getSourceHash(l_jsonText),
+        l_skippedEepromPaths, l_errCode);
+
+    for (const auto& l_eepromPath : l_skippedEepromPaths)
+    {
+        std::cerr << "Warning: invalid entry of FRU " << l_eepromPath
+                  << " in " << l_jsonPath << ", skipped from index."
+                  << std::endl;
+    }
+
+    if (l_errCode)
+    {
+        const auto l_errMsgItr = vpd::errorCodeMap.find(l_errCode);
+        std::cerr << "Failed to compile index of " << l_jsonPath << ", error: "
+                  << ((l_errMsgItr != vpd::errorCodeMap.end())
+                          ? l_errMsgItr->second
+                          : std::to_string(l_errCode))
+                  << std::endl;
+        return -1;
+    }
+
+    std::ofstream l_indexFile(l_indexPath, std::ios::binary | std::ios::trunc);
+    l_indexFile.write(reinterpret_cast<const char*>(l_image.data()),
+                      static_cast<std::streamsize>(l_image.size()));
+
+    if (!l_indexFile)
+    {
+        std::cerr << "Failed to write " << l_indexPath << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
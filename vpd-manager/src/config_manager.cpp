@@ -8,6 +8,7 @@
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <iterator>
 
 namespace vpd
 {
@@ -70,8 +71,10 @@ std::shared_ptr<ConfigManager> ConfigManager::initialize(
 void ConfigManager::loadJson(const std::string& i_sysConfigJsonPath)
 {
     uint16_t l_errCode{constants::VALUE_0};
+    uint64_t l_sourceHash{0};
 
-    m_systemConfigJson = getParsedJson(i_sysConfigJsonPath, l_errCode);
+    m_systemConfigJson =
+        getParsedJson(i_sysConfigJsonPath, l_sourceHash, l_errCode);
 
     if (l_errCode != constants::VALUE_0)
     {
@@ -83,12 +86,52 @@ void ConfigManager::loadJson(const std::string& i_sysConfigJsonPath)
     // Validate the system configuration JSON
     JsonValidator::validateConfigJson(m_systemConfigJson);
 
+    // Index is needed by path lookups, hence loaded ahead of building maps.
+    loadConfigIndex(i_sysConfigJsonPath, l_sourceHash);
+
     buildConfigMaps();
 
     // Validate the chassis-specific JSONs
     validateChassisSpecificJsons();
 }
 
+void ConfigManager::loadConfigIndex(const std::string& i_sysConfigJsonPath,
+                                    const uint64_t i_sourceHash)
+{
+    uint16_t l_errCode{constants::VALUE_0};
+
+    const std::string l_indexPath =
+        ConfigIndex::getIndexPath(i_sysConfigJsonPath);
+    if (!l_indexPath.empty() &&
+        m_configIndex.load(l_indexPath, i_sourceHash, l_errCode))
+    {
+        return;
+    }
+
+    m_logger->logMessage(std::format(
+        "Config index [{}] not usable, error: {}. Compiling it from JSON.",
+        l_indexPath, commonUtility::getErrCodeMsg(l_errCode)));
+
+    std::vector<std::string> l_skippedEepromPaths;
+    auto l_image = ConfigIndex::compile(m_systemConfigJson, i_sourceHash,
+                                        l_skippedEepromPaths, l_errCode);
+
+    for (const auto& l_eepromPath : l_skippedEepromPaths)
+    {
+        m_logger->logMessage(std::format(
+            "Invalid JSON entry of FRU {}, skipped from config index.",
+            l_eepromPath));
+    }
+
+    if (l_errCode != constants::VALUE_0 ||
+        !m_configIndex.assign(std::move(l_image), i_sourceHash, l_errCode))
+    {
+        throw JsonException{std::format(
+            "Failed to compile config index from JSON {}. Error: {}",
+            i_sysConfigJsonPath, commonUtility::getErrCodeMsg(l_errCode))};
+    }
+}
+
 std::expected<std::reference_wrapper<const nlohmann::json>, error_code>
     ConfigManager::getJsonObj(
         const std::optional<std::string>& i_vpdPath) const noexcept
@@ -119,6 +162,20 @@ std::expected<std::reference_wrapper<const nlohmann::json>, error_code>
     {
         l_chassisId = l_itr->second;
     }
+    else if (const auto l_fruRecord =
+                 m_configIndex.findByRedundantEeprom(*i_vpdPath);
+             l_fruRecord.has_value())
+    {
+        // Redundant EEPROM belongs to the chassis of its primary EEPROM.
+        const auto l_primaryItr = m_eepromToChassisIdMap.find(
+            std::string(l_fruRecord->m_eepromPath));
+        if (l_primaryItr == m_eepromToChassisIdMap.end())
+        {
+            return std::cref(m_systemConfigJson);
+        }
+
+        l_chassisId = l_primaryItr->second;
+    }
     else
     {
         // see if the given EEPROM path is in the system configuration JSON
@@ -140,6 +197,36 @@ std::expected<std::reference_wrapper<const nlohmann::json>, error_code>
     return std::unexpected(error_code::PATH_NOT_FOUND_IN_JSON);
 }
 
+std::expected<ConfigIndexRecord, error_code> ConfigManager::findFru(
+    const std::string& i_vpdPath) const noexcept
+{
+    if (auto l_fruRecord = m_configIndex.findFru(i_vpdPath))
+    {
+        return *l_fruRecord;
+    }
+
+    return std::unexpected(error_code::FRU_PATH_NOT_FOUND);
+}
+
+std::expected<types::JsonSnapshot, error_code> ConfigManager::getJsonSnapshot(
+    const std::optional<std::string>& i_vpdPath) const noexcept
+{
+    const auto l_jsonResult = getJsonObj(i_vpdPath);
+    if (!l_jsonResult.has_value())
+    {
+        return std::unexpected(l_jsonResult.error());
+    }
+
+    const auto l_instance = weak_from_this().lock();
+    if (!l_instance)
+    {
+        return std::unexpected(error_code::CONFIG_MANAGER_UNINITIALIZED);
+    }
+
+    // Share ownership of this instance, JSON itself is not copied.
+    return types::JsonSnapshot(l_instance, &l_jsonResult.value().get());
+}
+
 std::string ConfigManager::getChassisId(
     const std::string& i_inventoryObjPath) const noexcept
 {
@@ -341,9 +428,11 @@ std::expected<types::ListOfPaths, error_code> ConfigManager::getInventoryPaths(
 }
 
 nlohmann::json ConfigManager::getParsedJson(const std::string& i_jsonPath,
+                                            uint64_t& o_sourceHash,
                                             uint16_t& o_errCode) noexcept
 {
     o_errCode = 0;
+    o_sourceHash = 0;
 
     if (i_jsonPath.empty())
     {
@@ -363,7 +452,7 @@ nlohmann::json ConfigManager::getParsedJson(const std::string& i_jsonPath,
         return nlohmann::json{};
     }
 
-    std::ifstream l_jsonFile(i_jsonPath);
+    std::ifstream l_jsonFile(i_jsonPath, std::ios::binary);
     if (!l_jsonFile)
     {
         o_errCode = error_code::FILE_ACCESS_ERROR;
@@ -372,7 +461,12 @@ nlohmann::json ConfigManager::getParsedJson(const std::string& i_jsonPath,
 
     try
     {
-        return nlohmann::json::parse(l_jsonFile);
+        // Text is read once, for both the hash and the parse.
+        const std::string l_jsonText{std::istreambuf_iterator<char>(l_jsonFile),
+                                     std::istreambuf_iterator<char>()};
+        o_sourceHash = ConfigIndex::getSourceHash(l_jsonText);
+
+        return nlohmann::json::parse(l_jsonText);
     }
     catch (const std::exception&)
     {
@@ -753,6 +847,13 @@ bool ConfigManager::isInventoryPathInJson(
         return false;
     }
 
+    // Inventory path of a base FRU is found in the index, that of a sub FRU
+    // needs the JSON walk.
+    if (m_configIndex.findByInventoryPath(i_invPath).has_value())
+    {
+        return true;
+    }
+
     try
     {
         for (const auto& l_fruEntry : m_systemConfigJson["frus"].items())
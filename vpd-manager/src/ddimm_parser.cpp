@@ -92,7 +92,7 @@ uint8_t DdimmVpdParser::getDdr5DiePerPackage(uint8_t i_ByteValue)
 }
 
 size_t DdimmVpdParser::getDdr5BasedDdimmSize(
-    types::BinaryVector::const_iterator i_iterator)
+    types::BinaryView::iterator i_iterator)
 {
     size_t l_dimmSize = 0;
 
@@ -228,7 +228,7 @@ size_t DdimmVpdParser::getDdr5BasedDdimmSize(
 }
 
 size_t DdimmVpdParser::getDdr4BasedDdimmSize(
-    types::BinaryVector::const_iterator i_iterator)
+    types::BinaryView::iterator i_iterator)
 {
     size_t l_dimmSize = 0;
     try
@@ -334,7 +334,7 @@ size_t DdimmVpdParser::getDdr4BasedDdimmSize(
 }
 
 size_t DdimmVpdParser::getDdimmSize(
-    types::BinaryVector::const_iterator i_iterator)
+    types::BinaryView::iterator i_iterator)
 {
     size_t l_dimmSize = 0;
     if (i_iterator[constants::SPD_BYTE_2] == constants::SPD_DRAM_TYPE_DDR5)
@@ -355,7 +355,7 @@ size_t DdimmVpdParser::getDdimmSize(
 }
 
 void DdimmVpdParser::readKeywords(
-    types::BinaryVector::const_iterator i_iterator)
+    types::BinaryView::iterator i_iterator)
 {
     // collect DDIMM size value
     auto l_dimmSize = getDdimmSize(i_iterator);
@@ -379,7 +379,7 @@ void DdimmVpdParser::readKeywords(
     types::BinaryVector l_ccin(i_iterator, i_iterator + constants::CCIN_LEN);
 
     types::BinaryVector l_mfgId(DRAM_MANUFACTURER_ID_LENGTH);
-    std::copy_n((m_vpdVector.cbegin() + DRAM_MANUFACTURER_ID_OFFSET),
+    std::copy_n((m_vpdVector.begin() + DRAM_MANUFACTURER_ID_OFFSET),
                 DRAM_MANUFACTURER_ID_LENGTH, l_mfgId.begin());
 
     m_parsedVpdMap.emplace("FN", l_partNumber);
@@ -394,7 +394,7 @@ types::VPDMapVariant DdimmVpdParser::parse()
     try
     {
         // Read the data and return the map
-        auto l_iterator = m_vpdVector.cbegin();
+        auto l_iterator = m_vpdVector.begin();
         readKeywords(l_iterator);
         return m_parsedVpdMap;
     }
@@ -0,0 +1,330 @@
+#include "eeprom_fingerprint_store.hpp"
+
+#include "constants.hpp"
+#include "error_codes.hpp"
+#include "logger.hpp"
+#include "parser_factory.hpp"
+#include "vpd_image.hpp"
+
+#include <utility/common_utility.hpp>
+#include <utility/json_utility.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <typeinfo>
+#include <utility>
+
+namespace vpd
+{
+EepromFingerprintStore::EepromFingerprintStore(
+    const std::string& i_storeFilePath) : m_storeFilePath(i_storeFilePath)
+{}
+
+std::shared_ptr<EepromFingerprintStore>
+    EepromFingerprintStore::getStoreInstance()
+{
+    static std::shared_ptr<EepromFingerprintStore> l_storeInstance =
+        std::make_shared<EepromFingerprintStore>(
+            constants::eepromFingerprintFile);
+    return l_storeInstance;
+}
+
+uint64_t EepromFingerprintStore::getHash(types::BinaryView i_data) noexcept
+{
+    constexpr uint64_t l_fnvOffsetBasis = 0xcbf29ce484222325;
+    constexpr uint64_t l_fnvPrime = 0x100000001b3;
+
+    uint64_t l_hash = l_fnvOffsetBasis;
+    for (const auto l_byte : i_data)
+    {
+        l_hash = (l_hash ^ l_byte) * l_fnvPrime;
+    }
+    return l_hash;
+}
+
+std::optional<EepromFingerprintStore::Fingerprint>
+    EepromFingerprintStore::computeFingerprint(
+        const std::string& i_vpdFilePath,
+        const nlohmann::json& i_sysCfgJsonObj, uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    try
+    {
+        if (i_vpdFilePath.empty() || !i_sysCfgJsonObj.contains("frus") ||
+            !i_sysCfgJsonObj["frus"].contains(i_vpdFilePath))
+        {
+            o_errCode = error_code::INVALID_INPUT_PARAMETER;
+            return std::nullopt;
+        }
+
+        const auto& l_fruConfig = i_sysCfgJsonObj["frus"][i_vpdFilePath];
+        const size_t l_vpdStartOffset = l_fruConfig.at(0).value("offset", 0);
+
+        VpdImage l_vpdImage;
+        l_vpdImage.load(i_vpdFilePath, l_vpdStartOffset, o_errCode);
+        if (o_errCode)
+        {
+            return std::nullopt;
+        }
+
+        const auto l_parser = ParserFactory::getParser(
+            l_vpdImage.getView(), i_vpdFilePath, l_vpdStartOffset);
+        const auto& l_parserRef = *l_parser;
+
+        const std::string l_fruConfigString = l_fruConfig.dump();
+
+        return Fingerprint{
+            getHash(l_vpdImage.getView()), typeid(l_parserRef).name(),
+            getHash(types::BinaryView(
+                reinterpret_cast<const uint8_t*>(l_fruConfigString.data()),
+                l_fruConfigString.size()))};
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to compute fingerprint of [" + i_vpdFilePath +
+            "], error: " + std::string(l_ex.what()));
+    }
+    return std::nullopt;
+}
+
+bool EepromFingerprintStore::isUnchanged(
+    const std::string& i_vpdFilePath, const Fingerprint& i_fingerprint) noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    loadIfRequired();
+
+    const auto l_itr = m_fingerprints.find(i_vpdFilePath);
+    return l_itr != m_fingerprints.end() && l_itr->second == i_fingerprint;
+}
+
+void EepromFingerprintStore::update(const std::string& i_vpdFilePath,
+                                    const Fingerprint& i_fingerprint) noexcept
+{
+    try
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        loadIfRequired();
+
+        m_pendingFingerprints.erase(i_vpdFilePath);
+        m_fingerprints.insert_or_assign(i_vpdFilePath, i_fingerprint);
+        m_isDirty = true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        // EEPROM just gets processed again on next recollection.
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to store fingerprint of [" + i_vpdFilePath +
+            "], error: " + std::string(l_ex.what()));
+    }
+}
+
+void EepromFingerprintStore::setPending(
+    const std::string& i_vpdFilePath, const Fingerprint& i_fingerprint) noexcept
+{
+    try
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        loadIfRequired();
+
+        if (m_fingerprints.erase(i_vpdFilePath) != 0)
+        {
+            m_isDirty = true;
+        }
+        m_pendingFingerprints.insert_or_assign(i_vpdFilePath, i_fingerprint);
+    }
+    catch (const std::exception& l_ex)
+    {
+        // EEPROM just gets processed again on next recollection.
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to store pending fingerprint of [" + i_vpdFilePath +
+            "], error: " + std::string(l_ex.what()));
+    }
+}
+
+void EepromFingerprintStore::confirmPending(
+    const std::unordered_set<std::string>& i_failedVpdFilePaths) noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    loadIfRequired();
+
+    try
+    {
+        for (auto& [l_vpdFilePath, l_fingerprint] : m_pendingFingerprints)
+        {
+            if (!i_failedVpdFilePaths.contains(l_vpdFilePath))
+            {
+                m_fingerprints.insert_or_assign(l_vpdFilePath,
+                                                std::move(l_fingerprint));
+                m_isDirty = true;
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to confirm pending fingerprints, error: " +
+            std::string(l_ex.what()));
+    }
+    m_pendingFingerprints.clear();
+
+    uint16_t l_errCode = 0;
+    if (m_isDirty && !persist(l_errCode))
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to persist EEPROM fingerprints, error: " +
+            commonUtility::getErrCodeMsg(l_errCode));
+    }
+}
+
+void EepromFingerprintStore::invalidate(
+    const std::string& i_vpdFilePath) noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    loadIfRequired();
+
+    m_pendingFingerprints.erase(i_vpdFilePath);
+    if (m_fingerprints.erase(i_vpdFilePath) == 0)
+    {
+        return;
+    }
+
+    m_isDirty = true;
+
+    uint16_t l_errCode = 0;
+    if (!persist(l_errCode))
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to persist EEPROM fingerprints, error: " +
+            commonUtility::getErrCodeMsg(l_errCode));
+    }
+}
+
+void EepromFingerprintStore::invalidateAll() noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+
+    // Whatever is persisted has to go as well.
+    m_isLoaded = true;
+    m_fingerprints.clear();
+    m_pendingFingerprints.clear();
+    m_isDirty = true;
+
+    uint16_t l_errCode = 0;
+    if (!persist(l_errCode))
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to persist EEPROM fingerprints, error: " +
+            commonUtility::getErrCodeMsg(l_errCode));
+    }
+}
+
+bool EepromFingerprintStore::save(uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    return !m_isDirty || persist(o_errCode);
+}
+
+void EepromFingerprintStore::loadIfRequired() noexcept
+{
+    if (m_isLoaded)
+    {
+        return;
+    }
+    m_isLoaded = true;
+
+    std::error_code l_ec;
+    if (!std::filesystem::exists(m_storeFilePath, l_ec))
+    {
+        return;
+    }
+
+    uint16_t l_errCode = 0;
+    const auto l_storeJson =
+        jsonUtility::getParsedJson(m_storeFilePath, l_errCode);
+
+    if (l_errCode)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to load EEPROM fingerprints from [" + m_storeFilePath +
+            "], error: " + commonUtility::getErrCodeMsg(l_errCode));
+        return;
+    }
+
+    try
+    {
+        const auto l_fingerprints =
+            l_storeJson.value("fingerprints", nlohmann::json::object());
+
+        for (const auto& [l_vpdFilePath, l_fingerprint] :
+             l_fingerprints.items())
+        {
+            m_fingerprints.insert_or_assign(
+                l_vpdFilePath,
+                Fingerprint{l_fingerprint.at("contentHash").get<uint64_t>(),
+                            l_fingerprint.at("parserType").get<std::string>(),
+                            l_fingerprint.at("configHash").get<uint64_t>()});
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        // Partially loaded fingerprints can't be trusted.
+        m_fingerprints.clear();
+        Logger::getLoggerInstance()->logMessage(
+            "Invalid EEPROM fingerprints in [" + m_storeFilePath +
+            "], error: " + std::string(l_ex.what()));
+    }
+}
+
+bool EepromFingerprintStore::persist(uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    try
+    {
+        nlohmann::json l_fingerprints = nlohmann::json::object();
+        for (const auto& [l_vpdFilePath, l_fingerprint] : m_fingerprints)
+        {
+            l_fingerprints[l_vpdFilePath] = {
+                {"contentHash", l_fingerprint.m_contentHash},
+                {"parserType", l_fingerprint.m_parserType},
+                {"configHash", l_fingerprint.m_configHash}};
+        }
+
+        const std::filesystem::path l_storeFilePath(m_storeFilePath);
+        std::filesystem::create_directories(l_storeFilePath.parent_path());
+
+        // Written aside and renamed, a crash midway leaves the old file.
+        const std::string l_tempFilePath = m_storeFilePath + ".tmp";
+        {
+            std::ofstream l_storeFile(l_tempFilePath,
+                                      std::ios::out | std::ios::trunc);
+            if (!l_storeFile)
+            {
+                o_errCode = error_code::FILE_ACCESS_ERROR;
+                return false;
+            }
+
+            l_storeFile << nlohmann::json{{"fingerprints", l_fingerprints}};
+            if (!l_storeFile)
+            {
+                o_errCode = error_code::FILE_SYSTEM_ERROR;
+                return false;
+            }
+        }
+
+        std::filesystem::rename(l_tempFilePath, l_storeFilePath);
+        m_isDirty = false;
+        return true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::FILE_SYSTEM_ERROR;
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to persist EEPROM fingerprints to [" + m_storeFilePath +
+            "], error: " + std::string(l_ex.what()));
+    }
+    return false;
+}
+} // namespace vpd
@@ -0,0 +1,194 @@
+#include "gpio_edge_monitor.hpp"
+
+#include "logger.hpp"
+
+#include <sys/epoll.h>
+
+#include <array>
+#include <cerrno>
+#include <format>
+#include <stdexcept>
+#include <system_error>
+
+namespace vpd
+{
+namespace
+{
+/**
+ * @brief API to create an epoll instance.
+ *
+ * @return Epoll descriptor.
+ *
+ * @throw std::system_error
+ */
+int createEpollFd()
+{
+    const int l_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (l_epollFd < 0)
+    {
+        throw std::system_error(errno, std::generic_category(),
+                                "Failed to create epoll instance");
+    }
+    return l_epollFd;
+}
+} // namespace
+
+GpioEdgeMonitor::GpioEdgeMonitor(
+    const std::shared_ptr<boost::asio::io_context>& i_ioContext,
+    const std::chrono::milliseconds i_debounceTime) :
+    m_ioContext(i_ioContext), m_debounceTime(i_debounceTime),
+    m_epollDescriptor(*i_ioContext, createEpollFd())
+{
+    waitForEvents();
+}
+
+void GpioEdgeMonitor::addWatch(const int i_eventFd,
+                               std::function<void()> i_drainEvents,
+                               std::function<void()> i_onSettled)
+{
+    if (i_eventFd < 0 || !i_drainEvents || !i_onSettled)
+    {
+        throw std::invalid_argument("Invalid input to add watch.");
+    }
+
+    if (m_watches.contains(i_eventFd))
+    {
+        throw std::invalid_argument(
+            std::format("Descriptor {} is already watched.", i_eventFd));
+    }
+
+    epoll_event l_event{};
+    l_event.events = EPOLLIN | EPOLLPRI;
+    l_event.data.fd = i_eventFd;
+
+    if (epoll_ctl(m_epollDescriptor.native_handle(), EPOLL_CTL_ADD, i_eventFd,
+                  &l_event) < 0)
+    {
+        throw std::system_error(
+            errno, std::generic_category(),
+            std::format("Failed to add descriptor {} to epoll", i_eventFd));
+    }
+
+    m_watches.emplace(
+        i_eventFd,
+        Watch{std::move(i_drainEvents), std::move(i_onSettled),
+              std::make_unique<boost::asio::steady_timer>(*m_ioContext)});
+}
+
+void GpioEdgeMonitor::removeWatch(const int i_eventFd) noexcept
+{
+    const auto l_watchItr = m_watches.find(i_eventFd);
+    if (l_watchItr == m_watches.end())
+    {
+        return;
+    }
+
+    epoll_ctl(m_epollDescriptor.native_handle(), EPOLL_CTL_DEL, i_eventFd,
+              nullptr);
+
+    // Destroying the timer aborts a pending settle callback.
+    m_watches.erase(l_watchItr);
+}
+
+void GpioEdgeMonitor::waitForEvents()
+{
+    m_epollDescriptor.async_wait(
+        boost::asio::posix::stream_descriptor::wait_read,
+        [this](const boost::system::error_code& i_errorCode) {
+            handleEvents(i_errorCode);
+        });
+}
+
+void GpioEdgeMonitor::handleEvents(const boost::system::error_code& i_errorCode)
+{
+    if (i_errorCode == boost::asio::error::operation_aborted)
+    {
+        return;
+    }
+
+    if (i_errorCode)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Wait on GPIO edge events failed, error: " + i_errorCode.message());
+        return;
+    }
+
+    std::array<epoll_event, 16> l_events{};
+    const int l_readyCount = epoll_wait(m_epollDescriptor.native_handle(),
+                                        l_events.data(), l_events.size(), 0);
+
+    for (int l_index = 0; l_index < l_readyCount; ++l_index)
+    {
+        const int l_eventFd = l_events[l_index].data.fd;
+
+        auto l_watchItr = m_watches.find(l_eventFd);
+        if (l_watchItr == m_watches.end())
+        {
+            continue;
+        }
+
+        try
+        {
+            // Callback may remove the watch, hence call it through a copy.
+            const auto l_drainEvents = l_watchItr->second.m_drainEvents;
+            l_drainEvents();
+        }
+        catch (const std::exception& l_ex)
+        {
+            // Unread events keep the descriptor readable, stop watching it
+            // instead of spinning on it.
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "Failed to read edge events of descriptor {}, removing it "
+                "from watch. Error: {}",
+                l_eventFd, l_ex.what()));
+            removeWatch(l_eventFd);
+            continue;
+        }
+
+        l_watchItr = m_watches.find(l_eventFd);
+        if (l_watchItr == m_watches.end())
+        {
+            continue;
+        }
+
+        // Every edge restarts the debounce window.
+        l_watchItr->second.m_debounceTimer->expires_after(m_debounceTime);
+        l_watchItr->second.m_debounceTimer->async_wait(
+            [this, l_eventFd](const boost::system::error_code& i_timerError) {
+                handleDebounceExpiry(i_timerError, l_eventFd);
+            });
+    }
+
+    waitForEvents();
+}
+
+void GpioEdgeMonitor::handleDebounceExpiry(
+    const boost::system::error_code& i_errorCode, const int i_eventFd)
+{
+    if (i_errorCode)
+    {
+        // Restarted by a later edge, or watch removed.
+        return;
+    }
+
+    const auto l_watchItr = m_watches.find(i_eventFd);
+    if (l_watchItr == m_watches.end())
+    {
+        return;
+    }
+
+    // Callback may remove the watch, hence call it through a copy.
+    const auto l_onSettled = l_watchItr->second.m_onSettled;
+
+    try
+    {
+        l_onSettled();
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Settle callback of descriptor {} failed, error: {}", i_eventFd,
+            l_ex.what()));
+    }
+}
+} // namespace vpd
@@ -2,6 +2,7 @@
 
 #include "constants.hpp"
 #include "error_codes.hpp"
+#include "exceptions.hpp"
 #include "logger.hpp"
 #include "types.hpp"
 #include "utility/dbus_utility.hpp"
@@ -23,7 +24,7 @@ void GpioEventHandler::handleChangeInGpioPin(const bool& i_isFruPresent)
         if (i_isFruPresent)
         {
             auto [l_isPresent, l_collectionStatus] =
-                Worker{}.collectFruVpd(m_fruPath, m_configJson, l_errCode);
+                Worker{}.collectFruVpd(m_fruPath, *m_configJson, l_errCode);
 
             if (l_errCode)
             {
@@ -45,7 +46,7 @@ void GpioEventHandler::handleChangeInGpioPin(const bool& i_isFruPresent)
                     commonUtility::getErrCodeMsg(l_errCode));
             }
 
-            Worker{}.deleteFruVpd(m_configJson, l_invPath);
+            Worker{}.deleteFruVpd(*m_configJson, l_invPath);
         }
     }
     catch (std::exception& l_ex)
@@ -78,13 +79,13 @@ void GpioEventHandler::handleTimerExpiry(
 
     if (l_errCode && l_errCode != error_code::DEVICE_NOT_PRESENT)
     {
+        // Presence is unknown, don't mistake it for removal.
         Logger::getLoggerInstance()->logMessage(
             "processGpioPresenceTag returned false for FRU [" + m_fruPath +
             "] Due to error. Reason: " +
             commonUtility::getErrCodeMsg(l_errCode));
     }
-
-    if (m_prevPresencePinValue != l_currentPresencePinValue)
+    else if (m_prevPresencePinValue != l_currentPresencePinValue)
     {
         m_prevPresencePinValue = l_currentPresencePinValue;
         handleChangeInGpioPin(l_currentPresencePinValue);
@@ -97,31 +98,192 @@ void GpioEventHandler::handleTimerExpiry(
                     boost::asio::placeholders::error, i_timerObj));
 }
 
+bool GpioEventHandler::requestPresenceEvents() noexcept
+{
+    if (!m_edgeMonitor || m_presencePinName.empty())
+    {
+        return false;
+    }
+
+    try
+    {
+        m_presenceLine = gpiod::find_line(m_presencePinName);
+        if (!m_presenceLine)
+        {
+            throw GpioException("Couldn't find the GPIO line.");
+        }
+
+        m_presenceLine.request({"Monitor the presence line",
+                                gpiod::line_request::EVENT_BOTH_EDGES, 0});
+
+        m_edgeMonitor->addWatch(
+            m_presenceLine.event_get_fd(),
+            [this]() {
+                // Edge type doesn't matter, line is read once edges settle.
+                while (m_presenceLine.event_wait(std::chrono::nanoseconds(0)))
+                {
+                    m_presenceLine.event_read();
+                }
+            },
+            [this]() { handlePresenceEdge(); });
+
+        return true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Edge events can't be monitored on presence line [{}] of FRU [{}], "
+            "error: {}",
+            m_presencePinName, m_fruPath, l_ex.what()));
+
+        releasePresenceEvents();
+        return false;
+    }
+}
+
+void GpioEventHandler::releasePresenceEvents() noexcept
+{
+    try
+    {
+        if (m_presenceLine && m_presenceLine.is_requested())
+        {
+            if (m_edgeMonitor)
+            {
+                m_edgeMonitor->removeWatch(m_presenceLine.event_get_fd());
+            }
+            m_presenceLine.release();
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Failed to release presence line [{}], error: {}",
+            m_presencePinName, l_ex.what()));
+    }
+    m_presenceLine.reset();
+}
+
+void GpioEventHandler::handlePresenceEdge()
+{
+    const bool l_isFruPresent =
+        (m_presenceLine.get_value() == m_presencePinValue);
+
+    // Edges bounced back to the last known state.
+    if (l_isFruPresent == m_prevPresencePinValue)
+    {
+        return;
+    }
+    m_prevPresencePinValue = l_isFruPresent;
+
+    // Pre actions of VPD collection and deletion request the presence line
+    // themselves, hence release it meanwhile.
+    releasePresenceEvents();
+    handleChangeInGpioPin(l_isFruPresent);
+
+    if (!requestPresenceEvents())
+    {
+        startPolling();
+        return;
+    }
+
+    // Check for a change while the line was released.
+    boost::asio::post(*m_ioContext, [this]() {
+        try
+        {
+            if (m_presenceLine)
+            {
+                handlePresenceEdge();
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "Failed to check presence of FRU [{}], error: {}", m_fruPath,
+                l_ex.what()));
+        }
+    });
+}
+
+void GpioEventHandler::startPolling()
+{
+    if (m_isPolling)
+    {
+        return;
+    }
+    m_isPolling = true;
+
+    static std::vector<std::shared_ptr<boost::asio::steady_timer>> l_timers;
+
+    auto l_timerObj = make_shared<boost::asio::steady_timer>(
+        *m_ioContext, std::chrono::seconds(constants::VALUE_5));
+
+    l_timerObj->async_wait(
+        boost::bind(&GpioEventHandler::handleTimerExpiry, this,
+                    boost::asio::placeholders::error, l_timerObj));
+
+    l_timers.push_back(l_timerObj);
+
+    Logger::getLoggerInstance()->logMessage(
+        "Polling presence line of FRU [" + m_fruPath + "]");
+}
+
 void GpioEventHandler::setEventHandlerForGpioPresence(
     const std::shared_ptr<boost::asio::io_context>& i_ioContext)
 {
+    if (!i_ioContext)
+    {
+        throw std::invalid_argument("IO context is null.");
+    }
+
     uint16_t l_errCode = 0;
     m_prevPresencePinValue = jsonUtility::processGpioPresenceTag(
         m_fruPath, "pollingRequired", "hotPlugging", l_errCode);
 
     if (l_errCode && l_errCode != error_code::DEVICE_NOT_PRESENT)
     {
+        // Error may be transient, polling catches up with the presence once
+        // the line can be read.
         Logger::getLoggerInstance()->logMessage(
             "processGpioPresenceTag returned false for FRU [" + m_fruPath +
-            "] Due to error. Reason: " +
+            "] Due to error, presence is polled. Reason: " +
             commonUtility::getErrCodeMsg(l_errCode));
+        startPolling();
+        return;
     }
 
-    static std::vector<std::shared_ptr<boost::asio::steady_timer>> l_timers;
+    // Read the presence pin details once, edge handling doesn't refer JSON.
+    const nlohmann::json& l_fruJson =
+        m_configJson->at("frus").at(m_fruPath).at(0);
+    const nlohmann::json l_gpioPresence =
+        l_fruJson.contains("pollingRequired")
+            ? l_fruJson.at("pollingRequired")
+                  .value("hotPlugging", nlohmann::json::object())
+                  .value("gpioPresence", nlohmann::json::object())
+            : nlohmann::json::object();
 
-    auto l_timerObj = make_shared<boost::asio::steady_timer>(
-        *i_ioContext, std::chrono::seconds(constants::VALUE_5));
+    if (l_gpioPresence.contains("pin") && l_gpioPresence.contains("value"))
+    {
+        m_presencePinName = l_gpioPresence.at("pin").get<std::string>();
+        m_presencePinValue = l_gpioPresence.at("value").get<int>();
+    }
 
-    l_timerObj->async_wait(
-        boost::bind(&GpioEventHandler::handleTimerExpiry, this,
-                    boost::asio::placeholders::error, l_timerObj));
+    if (!requestPresenceEvents())
+    {
+        startPolling();
+        return;
+    }
 
-    l_timers.push_back(l_timerObj);
+    // Catch a change between the initial read and the request.
+    try
+    {
+        handlePresenceEdge();
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Failed to check presence of FRU [{}], error: {}", m_fruPath,
+            l_ex.what()));
+    }
 }
 
 void GpioMonitor::initHandlerForGpio(
@@ -146,11 +308,28 @@ void GpioMonitor::initHandlerForGpio(
         return;
     }
 
+    if (!l_gpioPollingRequiredFrusList.empty())
+    {
+        try
+        {
+            m_edgeMonitor = std::make_shared<GpioEdgeMonitor>(
+                i_ioContext,
+                std::chrono::milliseconds(constants::GPIO_DEBOUNCE_TIME_MS));
+        }
+        catch (const std::exception& l_ex)
+        {
+            // Handlers fall back to polling.
+            Logger::getLoggerInstance()->logMessage(
+                "Failed to create GPIO edge monitor, error: " +
+                std::string(l_ex.what()));
+        }
+    }
+
     for (const auto& l_fruPath : l_gpioPollingRequiredFrusList)
     {
         std::shared_ptr<GpioEventHandler> l_gpioEventHandlerObj =
             std::make_shared<GpioEventHandler>(l_fruPath, i_configManager,
-                                               i_ioContext);
+                                               i_ioContext, m_edgeMonitor);
 
         m_gpioEventHandlerObjects.push_back(l_gpioEventHandlerObj);
     }
@@ -0,0 +1,192 @@
+#include "hot_plug_queue.hpp"
+
+#include "logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+namespace vpd
+{
+HotPlugQueue::HotPlugQueue(Handler i_handler, const size_t i_threadCount,
+                           const std::chrono::milliseconds i_coalesceTime,
+                           const size_t i_maxPendingFrus) :
+    m_handler(std::move(i_handler)), m_coalesceTime(i_coalesceTime),
+    m_maxPendingFrus(std::max<size_t>(1, i_maxPendingFrus))
+{
+    if (!m_handler)
+    {
+        throw std::invalid_argument("Hot plug queue needs a handler.");
+    }
+
+    const size_t l_threadCount = std::max<size_t>(1, i_threadCount);
+    m_threads.reserve(l_threadCount);
+    try
+    {
+        for (size_t l_index = 0; l_index < l_threadCount; ++l_index)
+        {
+            m_threads.emplace_back([this]() { serve(); });
+        }
+    }
+    catch (...)
+    {
+        // Join the threads which got created, before bailing out.
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            m_isStopping = true;
+        }
+        m_cv.notify_all();
+
+        for (auto& l_thread : m_threads)
+        {
+            l_thread.join();
+        }
+        throw;
+    }
+}
+
+HotPlugQueue::~HotPlugQueue()
+{
+    size_t l_droppedCount = 0;
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        m_isStopping = true;
+        l_droppedCount = m_pendingChanges.size();
+    }
+    m_cv.notify_all();
+
+    for (auto& l_thread : m_threads)
+    {
+        if (l_thread.joinable())
+        {
+            l_thread.join();
+        }
+    }
+
+    if (l_droppedCount != 0)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Hot plug queue stopped, dropped {} pending presence changes",
+            l_droppedCount));
+    }
+}
+
+bool HotPlugQueue::post(const std::string& i_inventoryPath,
+                        const bool i_isPresent) noexcept
+{
+    try
+    {
+        const auto l_dueTime =
+            std::chrono::steady_clock::now() + m_coalesceTime;
+
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        if (m_isStopping)
+        {
+            return false;
+        }
+
+        if (auto l_itr = m_pendingChanges.find(i_inventoryPath);
+            l_itr != m_pendingChanges.end())
+        {
+            l_itr->second = PendingChange{i_isPresent, l_dueTime};
+            m_coalescedCount.fetch_add(1, std::memory_order_relaxed);
+
+            // No thread needs waking up for a later due time.
+            return true;
+        }
+
+        if (m_pendingChanges.size() >= m_maxPendingFrus)
+        {
+            return false;
+        }
+
+        m_pendingChanges.emplace(i_inventoryPath,
+                                 PendingChange{i_isPresent, l_dueTime});
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    m_cv.notify_one();
+    return true;
+}
+
+size_t HotPlugQueue::getPendingCount() const noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    return m_pendingChanges.size();
+}
+
+void HotPlugQueue::serve() noexcept
+{
+    std::unique_lock<std::mutex> l_lock(m_mutex);
+    while (!m_isStopping)
+    {
+        // Earliest due change of a FRU which isn't being handled.
+        auto l_nextItr = m_pendingChanges.end();
+        for (auto l_itr = m_pendingChanges.begin();
+             l_itr != m_pendingChanges.end(); ++l_itr)
+        {
+            if (!m_inFlightPaths.contains(l_itr->first) &&
+                (l_nextItr == m_pendingChanges.end() ||
+                 l_itr->second.m_dueTime < l_nextItr->second.m_dueTime))
+            {
+                l_nextItr = l_itr;
+            }
+        }
+
+        if (l_nextItr == m_pendingChanges.end())
+        {
+            m_cv.wait(l_lock);
+            continue;
+        }
+
+        if (const auto l_dueTime = l_nextItr->second.m_dueTime;
+            l_dueTime > std::chrono::steady_clock::now())
+        {
+            // Change may get replaced or an earlier one posted meanwhile,
+            // hence the due time is copied and the pick is redone.
+            m_cv.wait_until(l_lock, l_dueTime);
+            continue;
+        }
+
+        std::string l_inventoryPath;
+        bool l_isPresent = false;
+        try
+        {
+            l_inventoryPath = l_nextItr->first;
+            l_isPresent = l_nextItr->second.m_isPresent;
+            m_inFlightPaths.insert(l_inventoryPath);
+            m_pendingChanges.erase(l_nextItr);
+        }
+        catch (const std::exception& l_ex)
+        {
+            // Change stays pending and is retried on next wake up.
+            Logger::getLoggerInstance()->logMessage(
+                "Failed to pick presence change, error: " +
+                std::string(l_ex.what()));
+            m_cv.wait_for(l_lock, m_coalesceTime);
+            continue;
+        }
+
+        l_lock.unlock();
+        try
+        {
+            m_handler(l_inventoryPath, l_isPresent);
+        }
+        catch (const std::exception& l_ex)
+        {
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "Presence change of {} failed, error: {}", l_inventoryPath,
+                l_ex.what()));
+        }
+        l_lock.lock();
+
+        m_inFlightPaths.erase(l_inventoryPath);
+
+        // A change of the same FRU may be waiting for this one.
+        m_cv.notify_all();
+    }
+}
+} // namespace vpd
@@ -0,0 +1,339 @@
+#include "i2c_bus_scheduler.hpp"
+
+#include "logger.hpp"
+#include "utility/common_utility.hpp"
+#include "utility/vpd_specific_utility.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <stdexcept>
+
+namespace vpd
+{
+namespace
+{
+// Key of the group holding tasks of non I2C devices.
+constexpr auto nonI2cBusKey = "non-i2c";
+} // namespace
+
+I2cBusScheduler::I2cBusScheduler(CollectionThreadPool& i_threadPool,
+                                 const size_t i_maxReadersPerBus,
+                                 const nlohmann::json& i_muxes) :
+    m_threadPool(i_threadPool),
+    m_maxReadersPerBus(std::max<size_t>(1, i_maxReadersPerBus)),
+    m_statisticsStartTime(std::chrono::steady_clock::now())
+{
+    setMuxes(i_muxes);
+}
+
+void I2cBusScheduler::setMuxes(const nlohmann::json& i_muxes)
+{
+    m_muxHoldIdlePaths.clear();
+    m_muxEnableFlags.clear();
+
+    if (!i_muxes.is_array())
+    {
+        return;
+    }
+
+    for (const auto& l_mux : i_muxes)
+    {
+        const std::string l_holdIdlePath = l_mux.value("holdidlepath", "");
+        if (l_holdIdlePath.empty())
+        {
+            continue;
+        }
+
+        // Hold idle path is under the mux device, i.e. .../<bus>-<addr>/...
+        m_muxHoldIdlePaths.emplace(
+            std::filesystem::path(l_holdIdlePath).parent_path().filename(),
+            l_holdIdlePath);
+        m_muxEnableFlags.try_emplace(l_holdIdlePath);
+    }
+}
+
+int I2cBusScheduler::getI2cBusFromPath(const std::string& i_eepromPath) noexcept
+{
+    const std::filesystem::path l_eepromPath(i_eepromPath);
+
+    // Device directory is named <bus>-<4 digit hex address>.
+    for (const auto& l_component : l_eepromPath)
+    {
+        const std::string l_name = l_component.string();
+        const auto l_separatorPos = l_name.find('-');
+
+        if (l_separatorPos == std::string::npos || l_separatorPos == 0 ||
+            l_name.size() - l_separatorPos - 1 != 4)
+        {
+            continue;
+        }
+
+        const bool l_isBusNumeric = std::all_of(
+            l_name.begin(), l_name.begin() + l_separatorPos,
+            [](unsigned char l_char) { return std::isdigit(l_char); });
+        const bool l_isAddressHex = std::all_of(
+            l_name.begin() + l_separatorPos + 1, l_name.end(),
+            [](unsigned char l_char) { return std::isxdigit(l_char); });
+
+        if (l_isBusNumeric && l_isAddressHex && l_separatorPos < 6)
+        {
+            return std::stoi(l_name.substr(0, l_separatorPos));
+        }
+    }
+
+    return -1;
+}
+
+I2cBusScheduler::BusInfo I2cBusScheduler::getBusInfo(
+    const std::string& i_eepromPath) const
+{
+    const int l_bus = getI2cBusFromPath(i_eepromPath);
+    if (l_bus < 0)
+    {
+        return BusInfo{nonI2cBusKey, std::string{}};
+    }
+
+    BusInfo l_busInfo{std::format("i2c-{}", l_bus), std::string{}};
+
+    // Adapter of a mux channel sits under the mux device, which in turn sits
+    // under the adapter of the physical bus, e.g.
+    // /sys/devices/.../i2c-4/4-0070/i2c-100
+    std::error_code l_ec;
+    const auto l_adapterPath = std::filesystem::canonical(
+        std::filesystem::path("/sys/bus/i2c/devices") / l_busInfo.m_busKey,
+        l_ec);
+
+    if (l_ec)
+    {
+        return l_busInfo;
+    }
+
+    bool l_isRootAdapterFound = false;
+    for (const auto& l_component : l_adapterPath)
+    {
+        const std::string l_name = l_component.string();
+
+        if (!l_isRootAdapterFound && l_name.starts_with("i2c-") &&
+            l_name.size() > 4 &&
+            std::all_of(l_name.begin() + 4, l_name.end(),
+                        [](unsigned char l_char) {
+                            return std::isdigit(l_char);
+                        }))
+        {
+            l_busInfo.m_busKey = l_name;
+            l_isRootAdapterFound = true;
+            continue;
+        }
+
+        if (l_busInfo.m_muxHoldIdlePath.empty())
+        {
+            if (const auto l_muxItr = m_muxHoldIdlePaths.find(l_name);
+                l_muxItr != m_muxHoldIdlePaths.end())
+            {
+                l_busInfo.m_muxHoldIdlePath = l_muxItr->second;
+            }
+        }
+    }
+
+    return l_busInfo;
+}
+
+void I2cBusScheduler::submit(const std::string& i_eepromPath,
+                             std::function<void()> i_task)
+{
+    if (!i_task)
+    {
+        throw std::runtime_error("Empty task can't be scheduled.");
+    }
+
+    // Resolve outside the lock, it involves sysfs access.
+    BusInfo l_busInfo = getBusInfo(i_eepromPath);
+
+    std::unique_lock<std::mutex> l_lock(m_mutex);
+
+    BusState& l_busState = m_busStates[l_busInfo.m_busKey];
+    auto& l_tasks = l_busInfo.m_muxHoldIdlePath.empty()
+                        ? l_busState.m_directTasks
+                        : l_busState.m_gatedTasks;
+    l_tasks.emplace_back(
+        PendingTask{std::move(i_task), std::move(l_busInfo.m_muxHoldIdlePath)});
+
+    dispatch(l_busInfo.m_busKey, l_lock);
+}
+
+void I2cBusScheduler::dispatch(const std::string& i_busKey,
+                               std::unique_lock<std::mutex>& io_lock) noexcept
+{
+    BusState& l_busState = m_busStates[i_busKey];
+    const size_t l_maxReaders = (i_busKey == nonI2cBusKey)
+                                    ? std::numeric_limits<size_t>::max()
+                                    : m_maxReadersPerBus;
+
+    while (l_busState.m_activeReaders < l_maxReaders &&
+           (!l_busState.m_directTasks.empty() ||
+            !l_busState.m_gatedTasks.empty()))
+    {
+        auto& l_tasks = !l_busState.m_directTasks.empty()
+                            ? l_busState.m_directTasks
+                            : l_busState.m_gatedTasks;
+
+        PendingTask l_pendingTask = std::move(l_tasks.front());
+        l_tasks.pop_front();
+
+        ++l_busState.m_activeReaders;
+        l_busState.m_peakReaders =
+            std::max(l_busState.m_peakReaders, l_busState.m_activeReaders);
+
+        try
+        {
+            m_threadPool.submit([this, i_busKey, l_pendingTask]() {
+                runTask(i_busKey, l_pendingTask);
+
+                std::unique_lock<std::mutex> l_lock(m_mutex);
+                dispatch(i_busKey, l_lock);
+            });
+        }
+        catch (const std::exception& l_ex)
+        {
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "Failed to submit task of bus [{}] to thread pool, running it "
+                "inline. Error: {}",
+                i_busKey, l_ex.what()));
+
+            // Pool didn't take the task, run it here.
+            io_lock.unlock();
+            runTask(i_busKey, l_pendingTask);
+            io_lock.lock();
+        }
+    }
+}
+
+void I2cBusScheduler::runTask(const std::string& i_busKey,
+                              const PendingTask& i_pendingTask) noexcept
+{
+    const auto l_startTime = std::chrono::steady_clock::now();
+
+    if (!i_pendingTask.m_muxHoldIdlePath.empty())
+    {
+        enableMux(i_pendingTask.m_muxHoldIdlePath);
+    }
+
+    try
+    {
+        i_pendingTask.m_task();
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Task of bus [{}] failed, error: {}", i_busKey, l_ex.what()));
+    }
+
+    const auto l_elapsedTime = std::chrono::steady_clock::now() - l_startTime;
+
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    BusState& l_busState = m_busStates[i_busKey];
+    --l_busState.m_activeReaders;
+    ++l_busState.m_completedTasks;
+    l_busState.m_busyTime += l_elapsedTime;
+}
+
+void I2cBusScheduler::enableMux(const std::string& i_holdIdlePath) noexcept
+{
+    const auto l_flagItr = m_muxEnableFlags.find(i_holdIdlePath);
+    if (l_flagItr == m_muxEnableFlags.end())
+    {
+        return;
+    }
+
+    try
+    {
+        // Tasks behind the mux wait till the first of them enables it. A
+        // failed attempt is retried by the next task.
+        std::call_once(l_flagItr->second, [&i_holdIdlePath]() {
+            uint16_t l_errCode = 0;
+            if (vpdSpecificUtility::enableMux(i_holdIdlePath, l_errCode))
+            {
+                Logger::getLoggerInstance()->logMessage(
+                    "Enabled mux before collecting FRUs behind it, hold idle "
+                    "path: " +
+                    i_holdIdlePath);
+            }
+
+            if (l_errCode)
+            {
+                throw std::runtime_error(
+                    commonUtility::getErrCodeMsg(l_errCode));
+            }
+        });
+    }
+    catch (const std::exception& l_ex)
+    {
+        // Proceed with the collection, EEPROM read fails if mux is disabled.
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Failed to enable mux [{}], error: {}", i_holdIdlePath,
+            l_ex.what()));
+    }
+}
+
+void I2cBusScheduler::resetStatistics() noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+
+    for (auto& [l_busKey, l_busState] : m_busStates)
+    {
+        l_busState.m_peakReaders = l_busState.m_activeReaders;
+        l_busState.m_completedTasks = 0;
+        l_busState.m_busyTime = std::chrono::steady_clock::duration{};
+    }
+    m_statisticsStartTime = std::chrono::steady_clock::now();
+}
+
+size_t I2cBusScheduler::getPeakReaderCount(
+    const std::string& i_eepromPath) const
+{
+    const BusInfo l_busInfo = getBusInfo(i_eepromPath);
+
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    const auto l_busStateItr = m_busStates.find(l_busInfo.m_busKey);
+    return (l_busStateItr != m_busStates.end())
+               ? l_busStateItr->second.m_peakReaders
+               : 0;
+}
+
+std::string I2cBusScheduler::getBusUtilisationString() const
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+
+    const double l_elapsedSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      m_statisticsStartTime)
+            .count();
+
+    std::string l_utilisation = std::format(
+        "I2C bus utilisation over {:.2f} seconds, max readers per bus {}:",
+        l_elapsedSeconds, m_maxReadersPerBus);
+
+    for (const auto& [l_busKey, l_busState] : m_busStates)
+    {
+        if (l_busState.m_completedTasks == 0)
+        {
+            continue;
+        }
+
+        const double l_busySeconds =
+            std::chrono::duration<double>(l_busState.m_busyTime).count();
+
+        l_utilisation += std::format(
+            " [{}: tasks {}, busy {:.2f}s, average readers {:.2f}, peak "
+            "readers {}]",
+            l_busKey, l_busState.m_completedTasks, l_busySeconds,
+            (l_elapsedSeconds > 0) ? (l_busySeconds / l_elapsedSeconds) : 0.0,
+            l_busState.m_peakReaders);
+    }
+
+    return l_utilisation;
+}
+} // namespace vpd
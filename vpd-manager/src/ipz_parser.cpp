@@ -8,9 +8,15 @@
 #include "exceptions.hpp"
 #include "utility/event_logger_utility.hpp"
 #include "utility/vpd_specific_utility.hpp"
+#include "vpd_image.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <iterator>
+#include <map>
 #include <ranges>
 #include <typeindex>
 
@@ -50,10 +56,11 @@ enum Length
 /**
  * @brief API to read 2 bytes LE data.
  *
- * @param[in] iterator - iterator to VPD vector.
+ * @param[in] iterator - iterator to VPD data.
  * @return read bytes.
  */
-static uint16_t readUInt16LE(types::BinaryVector::const_iterator iterator)
+template <typename Iterator>
+static uint16_t readUInt16LE(Iterator iterator)
 {
     uint16_t lowByte = *iterator;
     uint16_t highByte = *(iterator + 1);
@@ -61,17 +68,44 @@ static uint16_t readUInt16LE(types::BinaryVector::const_iterator iterator)
     return lowByte;
 }
 
+/**
+ * @brief API to check ECC of a region of VPD.
+ *
+ * Only the data region is copied to a local buffer before the check, so that
+ * a 1 bit correction doesn't modify the VPD, which may be a read-only mapping
+ * of the EEPROM.
+ *
+ * @param[in] i_vpdVector - VPD data.
+ * @param[in] i_dataOffset - Offset of the data to be checked.
+ * @param[in] i_dataLength - Length of the data to be checked.
+ * @param[in] i_eccOffset - Offset of the data's ECC.
+ * @param[in] i_eccLength - Length of the data's ECC.
+ *
+ * @return Status of ECC check, as returned by vpdecc_check_data.
+ */
+static int checkDataEcc(types::BinaryView i_vpdVector, size_t i_dataOffset,
+                        size_t i_dataLength, size_t i_eccOffset,
+                        size_t i_eccLength)
+{
+    if ((i_dataOffset + i_dataLength > i_vpdVector.size()) ||
+        (i_eccOffset + i_eccLength > i_vpdVector.size()))
+    {
+        return VPD_ECC_NOT_ENOUGH_BUFFER;
+    }
+
+    types::BinaryVector l_data(
+        std::next(i_vpdVector.begin(), i_dataOffset),
+        std::next(i_vpdVector.begin(), i_dataOffset + i_dataLength));
+
+    return vpdecc_check_data(l_data.data(), i_dataLength,
+                             &i_vpdVector[i_eccOffset], i_eccLength);
+}
+
 bool IpzVpdParser::vhdrEccCheck()
 {
-    // To avoid 1 bit flip correction from corrupting the main buffer.
-    const types::BinaryVector tempVector = m_vpdVector;
-    auto vpdPtr = tempVector.cbegin();
-
-    auto l_status = vpdecc_check_data(
-        const_cast<uint8_t*>(&vpdPtr[Offset::VHDR_RECORD]),
-        Length::VHDR_RECORD_LENGTH,
-        const_cast<uint8_t*>(&vpdPtr[Offset::VHDR_ECC]),
-        Length::VHDR_ECC_LENGTH);
+    auto l_status = checkDataEcc(m_vpdVector, Offset::VHDR_RECORD,
+                                 Length::VHDR_RECORD_LENGTH, Offset::VHDR_ECC,
+                                 Length::VHDR_ECC_LENGTH);
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
         Logger::getLoggerInstance()->logMessage(
@@ -92,7 +126,7 @@ bool IpzVpdParser::vhdrEccCheck()
 
 bool IpzVpdParser::vtocEccCheck()
 {
-    auto vpdPtr = m_vpdVector.cbegin();
+    auto vpdPtr = m_vpdVector.begin();
 
     std::advance(vpdPtr, Offset::VTOC_PTR);
 
@@ -111,15 +145,8 @@ bool IpzVpdParser::vtocEccCheck()
     std::advance(vpdPtr, sizeof(types::ECCOffset));
     auto vtocECCLength = readUInt16LE(vpdPtr);
 
-    // To avoid 1 bit flip correction from corrupting the main buffer.
-    const types::BinaryVector tempVector = m_vpdVector;
-    // Reset pointer to start of the vpd,
-    // so that Offset will point to correct address
-    vpdPtr = tempVector.cbegin();
-
-    auto l_status = vpdecc_check_data(
-        const_cast<uint8_t*>(&vpdPtr[vtocOffset]), vtocLength,
-        const_cast<uint8_t*>(&vpdPtr[vtocECCOffset]), vtocECCLength);
+    auto l_status = checkDataEcc(m_vpdVector, vtocOffset, vtocLength,
+                                 vtocECCOffset, vtocECCLength);
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
         Logger::getLoggerInstance()->logMessage(
@@ -138,7 +165,7 @@ bool IpzVpdParser::vtocEccCheck()
     return true;
 }
 
-bool IpzVpdParser::recordEccCheck(types::BinaryVector::const_iterator iterator)
+bool IpzVpdParser::recordEccCheck(types::BinaryView::iterator iterator)
 {
     auto recordOffset = readUInt16LE(iterator);
 
@@ -161,13 +188,8 @@ bool IpzVpdParser::recordEccCheck(types::BinaryVector::const_iterator iterator)
         throw(EccException("Invalid ECC length or offset."));
     }
 
-    // To avoid 1 bit flip correction from corrupting the main buffer.
-    const types::BinaryVector tempVector = m_vpdVector;
-    auto vpdPtr = tempVector.cbegin();
-
-    auto l_status = vpdecc_check_data(
-        const_cast<uint8_t*>(&vpdPtr[recordOffset]), recordLength,
-        const_cast<uint8_t*>(&vpdPtr[eccOffset]), eccLength);
+    auto l_status = checkDataEcc(m_vpdVector, recordOffset, recordLength,
+                                 eccOffset, eccLength);
 
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
@@ -187,7 +209,7 @@ bool IpzVpdParser::recordEccCheck(types::BinaryVector::const_iterator iterator)
     return true;
 }
 
-void IpzVpdParser::checkHeader(types::BinaryVector::const_iterator itrToVPD)
+void IpzVpdParser::checkHeader(types::BinaryView::iterator itrToVPD)
 {
     if (m_vpdVector.empty() || (Length::RECORD_MIN > m_vpdVector.size()))
     {
@@ -209,7 +231,7 @@ void IpzVpdParser::checkHeader(types::BinaryVector::const_iterator itrToVPD)
     }
 }
 
-auto IpzVpdParser::readTOC(types::BinaryVector::const_iterator& itrToVPD)
+auto IpzVpdParser::readTOC(types::BinaryView::iterator& itrToVPD)
 {
     // The offset to VTOC could be 1 or 2 bytes long
     uint16_t vtocOffset =
@@ -251,7 +273,7 @@ auto IpzVpdParser::readTOC(types::BinaryVector::const_iterator& itrToVPD)
 }
 
 std::pair<types::RecordOffsetList, types::InvalidRecordList>
-    IpzVpdParser::readPT(types::BinaryVector::const_iterator& itrToPT,
+    IpzVpdParser::readPT(types::BinaryView::iterator& itrToPT,
                          auto ptLength)
 {
     types::RecordOffsetList recordOffsets;
@@ -299,7 +321,7 @@ std::pair<types::RecordOffsetList, types::InvalidRecordList>
 }
 
 types::IPZVpdMap::mapped_type IpzVpdParser::readKeywords(
-    types::BinaryVector::const_iterator& itrToKwds)
+    types::BinaryView::iterator& itrToKwds)
 {
     types::IPZVpdMap::mapped_type kwdValueMap{};
     while (true)
@@ -361,7 +383,7 @@ void IpzVpdParser::processRecord(auto recordOffset)
         Length::KW_NAME + sizeof(types::KwSize);
 
     // Get record name
-    auto itrToVPDStart = m_vpdVector.cbegin();
+    auto itrToVPDStart = m_vpdVector.begin();
     std::advance(itrToVPDStart, recordNameOffset);
 
     std::string recordName(itrToVPDStart, itrToVPDStart + Length::RECORD_NAME);
@@ -381,9 +403,15 @@ void IpzVpdParser::processRecord(auto recordOffset)
 
 types::VPDMapVariant IpzVpdParser::parse()
 {
+    if (m_isParsed)
+    {
+        throw(DataException("VPD of " + m_vpdFilePath +
+                            " is already parsed by this parser instance"));
+    }
+
     try
     {
-        auto itrToVPD = m_vpdVector.cbegin();
+        auto itrToVPD = m_vpdVector.begin();
 
         // Check vaidity of VHDR record
         checkHeader(itrToVPD);
@@ -407,7 +435,13 @@ types::VPDMapVariant IpzVpdParser::parse()
                 "]");
         }
 
-        return m_parsedVPDMap;
+        // Hand over the parsed map instead of a deep copy. Records read
+        // later through getRecord are decoded again.
+        types::IPZVpdMap l_parsedVpdMap = std::move(m_parsedVPDMap);
+        m_parsedVPDMap.clear();
+        m_isParsed = true;
+
+        return l_parsedVpdMap;
     }
     catch (const std::exception& e)
     {
@@ -416,32 +450,260 @@ types::VPDMapVariant IpzVpdParser::parse()
     }
 }
 
+void IpzVpdParser::readRecordEntries(
+    size_t i_recordOffset,
+    std::vector<IpzVpdView::KeywordEntry>& io_entries) const
+{
+    const auto l_vpdData = reinterpret_cast<const char*>(m_vpdVector.data());
+
+    auto l_checkBounds = [this](size_t i_offset, size_t i_length) {
+        if (i_offset + i_length > m_vpdVector.size())
+        {
+            throw(DataException("Keyword exceeds VPD size"));
+        }
+    };
+
+    // Start from RT keyword, which holds the record name.
+    size_t l_offset =
+        i_recordOffset + sizeof(types::RecordId) + sizeof(types::RecordSize);
+
+    const size_t l_recordNameOffset =
+        l_offset + Length::KW_NAME + sizeof(types::KwSize);
+    l_checkBounds(l_recordNameOffset, Length::RECORD_NAME);
+
+    const std::string_view l_recordName(l_vpdData + l_recordNameOffset,
+                                        Length::RECORD_NAME);
+
+    while (true)
+    {
+        l_checkBounds(l_offset, Length::KW_NAME);
+        const std::string_view l_keywordName(l_vpdData + l_offset,
+                                             Length::KW_NAME);
+        if (constants::LAST_KW == l_keywordName)
+        {
+            break;
+        }
+
+        // Jump past keyword name
+        l_offset += Length::KW_NAME;
+
+        size_t l_kwdDataLength = 0;
+        if (constants::POUND_KW == l_keywordName.front())
+        {
+            l_checkBounds(l_offset, sizeof(types::PoundKwSize));
+            l_kwdDataLength =
+                readUInt16LE(std::next(m_vpdVector.begin(), l_offset));
+            l_offset += sizeof(types::PoundKwSize);
+        }
+        else
+        {
+            l_checkBounds(l_offset, sizeof(types::KwSize));
+            l_kwdDataLength = m_vpdVector[l_offset];
+            l_offset += sizeof(types::KwSize);
+        }
+
+        l_checkBounds(l_offset, l_kwdDataLength);
+        io_entries.push_back(IpzVpdView::KeywordEntry{
+            l_recordName, l_keywordName, l_offset, l_kwdDataLength});
+
+        // Jump past keyword data
+        l_offset += l_kwdDataLength;
+    }
+}
+
+IpzVpdView IpzVpdParser::parseToView()
+{
+    try
+    {
+        auto l_itrToVPD = m_vpdVector.begin();
+
+        // Check vaidity of VHDR record
+        checkHeader(l_itrToVPD);
+
+        // Read the table of contents
+        auto l_ptLen = readTOC(l_itrToVPD);
+
+        // Read the table of contents record, to get offsets to other records.
+        auto l_result = readPT(l_itrToVPD, l_ptLen);
+
+        std::vector<IpzVpdView::KeywordEntry> l_entries;
+        for (const auto& l_recordOffset : l_result.first)
+        {
+            readRecordEntries(l_recordOffset, l_entries);
+        }
+
+        if (!processInvalidRecords(l_result.second))
+        {
+            Logger::getLoggerInstance()->logMessage(
+                "Failed to process invalid records for [" + m_vpdFilePath +
+                "]");
+        }
+
+        return IpzVpdView(m_vpdVector, std::move(l_entries));
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(l_ex.what());
+        throw;
+    }
+}
+
+void IpzVpdParser::buildRecordIndex()
+{
+    if (m_isRecordIndexBuilt)
+    {
+        return;
+    }
+
+    auto l_itrToPT = m_vpdVector.begin();
+
+    // Check vaidity of VHDR record
+    checkHeader(l_itrToPT);
+
+    // Validate VTOC and move to PT keyword's data.
+    const auto l_ptLen = readTOC(l_itrToPT);
+
+    if (std::distance(l_itrToPT, m_vpdVector.end()) < l_ptLen)
+    {
+        throw(DataException("VTOC PT keyword exceeds VPD size"));
+    }
+
+    const auto l_ptEnd = std::next(l_itrToPT, l_ptLen);
+
+    while (std::distance(l_itrToPT, l_ptEnd) >= Length::SKIP_A_RECORD_IN_PT)
+    {
+        std::string l_recordName(l_itrToPT, l_itrToPT + Length::RECORD_NAME);
+
+        // Skip record name and record type
+        std::advance(l_itrToPT, Length::RECORD_NAME + Length::RECORD_TYPE);
+
+        const auto l_recordOffset = readUInt16LE(l_itrToPT);
+        const auto l_recordLength =
+            readUInt16LE(l_itrToPT + Length::RECORD_OFFSET);
+        const auto l_eccOffset = readUInt16LE(
+            l_itrToPT + Length::RECORD_OFFSET + Length::RECORD_LENGTH);
+        const auto l_eccLength =
+            readUInt16LE(l_itrToPT + Length::RECORD_OFFSET +
+                         Length::RECORD_LENGTH + Length::RECORD_ECC_OFFSET);
+
+        // First entry of a record wins, same as parse().
+        m_recordIndex.emplace(
+            std::move(l_recordName),
+            std::make_tuple(l_recordOffset, l_recordLength, l_eccOffset,
+                            l_eccLength));
+
+        // Jump record offset, record length, ECC offset and ECC length
+        std::advance(l_itrToPT,
+                     sizeof(types::RecordOffset) + sizeof(types::RecordLength) +
+                         sizeof(types::ECCOffset) + sizeof(types::ECCLength));
+    }
+
+    m_isRecordIndexBuilt = true;
+}
+
+const types::IPZKwdValueMap& IpzVpdParser::getRecord(
+    const types::Record& i_recordName)
+{
+    if (auto l_recordItr = m_parsedVPDMap.find(i_recordName);
+        l_recordItr != m_parsedVPDMap.end())
+    {
+        return l_recordItr->second;
+    }
+
+    buildRecordIndex();
+
+    const auto l_indexItr = m_recordIndex.find(i_recordName);
+    if (l_indexItr == m_recordIndex.end())
+    {
+        throw std::runtime_error("Record not found in VTOC PT keyword.");
+    }
+
+    const auto& [l_recordOffset, l_recordLength, l_eccOffset, l_eccLength] =
+        l_indexItr->second;
+
+    if (l_recordOffset == 0 || l_recordLength == 0)
+    {
+        throw(DataException("Invalid record offset or length"));
+    }
+
+    if (l_eccOffset == 0 || l_eccLength == 0)
+    {
+        throw(EccException("Invalid ECC length or offset."));
+    }
+
+    const auto l_status = checkDataEcc(m_vpdVector, l_recordOffset,
+                                       l_recordLength, l_eccOffset,
+                                       l_eccLength);
+
+    if (l_status == VPD_ECC_CORRECTABLE_DATA)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            std::string("One bit correction for record performed"),
+            PlaceHolder::PEL,
+            types::PelInfoTuple{types::ErrorType::EccCheckFailed,
+                                types::SeverityType::Informational, 0,
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt, std::nullopt});
+    }
+    else if (l_status != VPD_ECC_OK)
+    {
+        throw(EccException("ERROR: ECC check failed for record " +
+                           i_recordName));
+    }
+
+    processRecord(l_recordOffset);
+
+    // Record name at the offset may not match the name in VTOC.
+    const auto l_recordItr = m_parsedVPDMap.find(i_recordName);
+    if (l_recordItr == m_parsedVPDMap.end())
+    {
+        throw(DataException("Record " + i_recordName +
+                            " not found at offset given in VTOC"));
+    }
+
+    return l_recordItr->second;
+}
+
+std::string IpzVpdParser::getKeywordValue(const types::Record& i_recordName,
+                                          const types::Keyword& i_keywordName)
+{
+    const auto& l_keywordValueMap = getRecord(i_recordName);
+
+    const auto l_keywordItr = l_keywordValueMap.find(i_keywordName);
+    if (l_keywordItr == l_keywordValueMap.end())
+    {
+        throw std::runtime_error("Given keyword not found.");
+    }
+
+    return l_keywordItr->second;
+}
+
 types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
     const types::Record& i_recordName, const types::Keyword& i_keywordName,
     const types::RecordOffset& i_recordDataOffset)
 {
-    auto l_iterator = m_vpdVector.cbegin();
+    auto l_iterator = m_vpdVector.begin();
 
     // Go to the record name in the given record's offset
     std::ranges::advance(l_iterator,
                          i_recordDataOffset + Length::JUMP_TO_RECORD_NAME,
-                         m_vpdVector.cend());
+                         m_vpdVector.end());
 
     // Check if the record is present in the given record's offset
     if (i_recordName !=
         std::string(l_iterator,
                     std::ranges::next(l_iterator, Length::RECORD_NAME,
-                                      m_vpdVector.cend())))
+                                      m_vpdVector.end())))
     {
         throw std::runtime_error(
             "Given record is not present in the offset provided");
     }
 
-    std::ranges::advance(l_iterator, Length::RECORD_NAME, m_vpdVector.cend());
+    std::ranges::advance(l_iterator, Length::RECORD_NAME, m_vpdVector.end());
 
     std::string l_kwName = std::string(
         l_iterator,
-        std::ranges::next(l_iterator, Length::KW_NAME, m_vpdVector.cend()));
+        std::ranges::next(l_iterator, Length::KW_NAME, m_vpdVector.end()));
 
     // Iterate through the keywords until the last keyword PF is found.
     while (l_kwName != constants::LAST_KW)
@@ -449,7 +711,7 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
         // First character required for #D keyword check
         char l_kwNameStart = *l_iterator;
 
-        std::ranges::advance(l_iterator, Length::KW_NAME, m_vpdVector.cend());
+        std::ranges::advance(l_iterator, Length::KW_NAME, m_vpdVector.end());
 
         // Get the keyword's data length
         auto l_kwdDataLength = 0;
@@ -458,13 +720,13 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
         {
             l_kwdDataLength = readUInt16LE(l_iterator);
             std::ranges::advance(l_iterator, sizeof(types::PoundKwSize),
-                                 m_vpdVector.cend());
+                                 m_vpdVector.end());
         }
         else
         {
             l_kwdDataLength = *l_iterator;
             std::ranges::advance(l_iterator, sizeof(types::KwSize),
-                                 m_vpdVector.cend());
+                                 m_vpdVector.end());
         }
 
         if (l_kwName == i_keywordName)
@@ -472,16 +734,16 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
             // Return keyword's value to the caller
             return types::BinaryVector(
                 l_iterator, std::ranges::next(l_iterator, l_kwdDataLength,
-                                              m_vpdVector.cend()));
+                                              m_vpdVector.end()));
         }
 
         // next keyword search
-        std::ranges::advance(l_iterator, l_kwdDataLength, m_vpdVector.cend());
+        std::ranges::advance(l_iterator, l_kwdDataLength, m_vpdVector.end());
 
         // next keyword name
         l_kwName = std::string(
             l_iterator,
-            std::ranges::next(l_iterator, Length::KW_NAME, m_vpdVector.cend()));
+            std::ranges::next(l_iterator, Length::KW_NAME, m_vpdVector.end()));
     }
 
     // Keyword not found
@@ -556,70 +818,37 @@ types::DbusVariantType IpzVpdParser::readKeywordFromHardware(
         throw types::DbusInvalidArgument();
     }
 
-    // Read keyword's value from vector
-    auto l_itrToVPD = m_vpdVector.cbegin();
-
+    // Disable providing a way to read keywords from VHDR for the time being.
     if (l_record == "VHDR")
     {
-// Disable providing a way to read keywords from VHDR for the time being.
-#if 0
-        std::ranges::advance(l_itrToVPD, Offset::VHDR_RECORD,
-                             m_vpdVector.cend());
-
-        return types::DbusVariantType{getKeywordValueFromRecord(
-            l_record, l_keyword, Offset::VHDR_RECORD)};
-#endif
-
         Logger::getLoggerInstance()->logMessage(
             "Read cannot be performed on VHDR record.");
         throw types::DbusInvalidArgument();
     }
 
-    // Get VTOC offset
-    std::ranges::advance(l_itrToVPD, Offset::VTOC_PTR, m_vpdVector.cend());
-    auto l_vtocOffset = readUInt16LE(l_itrToVPD);
-
+    // Disable providing a way to read keywords from VTOC for the time being.
     if (l_record == "VTOC")
     {
-        // Disable providing a way to read keywords from VTOC for the time
-        // being.
-#if 0
-        return types::DbusVariantType{
-            getKeywordValueFromRecord(l_record, l_keyword, l_vtocOffset)};
-#endif
-
         Logger::getLoggerInstance()->logMessage(
             "Read cannot be performed on VTOC record.");
         throw types::DbusInvalidArgument();
     }
 
-    // Get record offset from VTOC's PT keyword value.
-    auto l_recordData = getRecordDetailsFromVTOC(l_record, l_vtocOffset);
-    const auto l_recordOffset = std::get<0>(l_recordData);
+    // Only the record holding the keyword gets decoded.
+    const auto l_keywordValue = getKeywordValue(l_record, l_keyword);
 
-    if (l_recordOffset == 0)
-    {
-        throw std::runtime_error("Record not found in VTOC PT keyword.");
-    }
-
-    // Get the given keyword's value
     return types::DbusVariantType{
-        getKeywordValueFromRecord(l_record, l_keyword, l_recordOffset)};
+        types::BinaryVector(l_keywordValue.begin(), l_keywordValue.end())};
 }
 
-void IpzVpdParser::updateRecordECC(
-    const auto& i_recordDataOffset, const auto& i_recordDataLength,
-    const auto& i_recordECCOffset, size_t i_recordECCLength,
-    types::BinaryVector& io_vpdVector)
+void IpzVpdParser::updateRecordECC(const types::BinaryVector& i_recordData,
+                                   types::BinaryVector& io_recordECC)
 {
-    auto l_recordDataBegin =
-        std::next(io_vpdVector.begin(), i_recordDataOffset);
-
-    auto l_recordECCBegin = std::next(io_vpdVector.begin(), i_recordECCOffset);
+    size_t l_recordECCLength = io_recordECC.size();
 
     auto l_eccStatus = vpdecc_create_ecc(
-        const_cast<uint8_t*>(&l_recordDataBegin[0]), i_recordDataLength,
-        const_cast<uint8_t*>(&l_recordECCBegin[0]), &i_recordECCLength);
+        const_cast<uint8_t*>(i_recordData.data()), i_recordData.size(),
+        io_recordECC.data(), &l_recordECCLength);
 
     if (l_eccStatus != VPD_ECC_OK)
     {
@@ -627,44 +856,36 @@ void IpzVpdParser::updateRecordECC(
             "ECC update failed with error " + std::to_string(l_eccStatus)));
     }
 
-    auto l_recordECCEnd = std::next(l_recordECCBegin, i_recordECCLength);
-
-    m_vpdFileStream.seekp(m_vpdStartOffset + i_recordECCOffset, std::ios::beg);
-
-    std::copy(l_recordECCBegin, l_recordECCEnd,
-              std::ostreambuf_iterator<char>(m_vpdFileStream));
+    io_recordECC.resize(l_recordECCLength);
 }
 
 int IpzVpdParser::setKeywordValueInRecord(
     const types::Record& i_recordName, const types::Keyword& i_keywordName,
     const types::BinaryVector& i_keywordData,
-    const types::RecordOffset& i_recordDataOffset,
-    types::BinaryVector& io_vpdVector)
+    types::BinaryVector& io_recordData, size_t& o_kwdDataOffset)
 {
-    auto l_iterator = io_vpdVector.begin();
+    auto l_iterator = io_recordData.begin();
 
-    // Go to the record name in the given record's offset
-    std::ranges::advance(l_iterator,
-                         i_recordDataOffset + Length::JUMP_TO_RECORD_NAME,
-                         io_vpdVector.end());
+    // Go to the record name
+    std::ranges::advance(l_iterator, Length::JUMP_TO_RECORD_NAME,
+                         io_recordData.end());
 
     const std::string l_recordFound(
         l_iterator,
-        std::ranges::next(l_iterator, Length::RECORD_NAME, io_vpdVector.end()));
+        std::ranges::next(l_iterator, Length::RECORD_NAME, io_recordData.end()));
 
     // Check if the record is present in the given record's offset
     if (i_recordName != l_recordFound)
     {
-        throw(DataException("Given record found at the offset " +
-                            std::to_string(i_recordDataOffset) + " is : " +
+        throw(DataException("Given record found at the record's offset is : " +
                             l_recordFound + " and not " + i_recordName));
     }
 
-    std::ranges::advance(l_iterator, Length::RECORD_NAME, io_vpdVector.end());
+    std::ranges::advance(l_iterator, Length::RECORD_NAME, io_recordData.end());
 
     std::string l_kwName = std::string(
         l_iterator,
-        std::ranges::next(l_iterator, Length::KW_NAME, io_vpdVector.end()));
+        std::ranges::next(l_iterator, Length::KW_NAME, io_recordData.end()));
 
     // Iterate through the keywords until the last keyword PF is found.
     while (l_kwName != constants::LAST_KW)
@@ -672,7 +893,7 @@ int IpzVpdParser::setKeywordValueInRecord(
         // First character required for #D keyword check
         char l_kwNameStart = *l_iterator;
 
-        std::ranges::advance(l_iterator, Length::KW_NAME, io_vpdVector.end());
+        std::ranges::advance(l_iterator, Length::KW_NAME, io_recordData.end());
 
         // Find the keyword's data length
         size_t l_kwdDataLength = 0;
@@ -681,17 +902,24 @@ int IpzVpdParser::setKeywordValueInRecord(
         {
             l_kwdDataLength = readUInt16LE(l_iterator);
             std::ranges::advance(l_iterator, sizeof(types::PoundKwSize),
-                                 io_vpdVector.end());
+                                 io_recordData.end());
         }
         else
         {
             l_kwdDataLength = *l_iterator;
             std::ranges::advance(l_iterator, sizeof(types::KwSize),
-                                 io_vpdVector.end());
+                                 io_recordData.end());
         }
 
         if (l_kwName == i_keywordName)
         {
+            if (std::distance(l_iterator, io_recordData.end()) <
+                static_cast<std::ptrdiff_t>(l_kwdDataLength))
+            {
+                throw(DataException("Keyword " + i_keywordName +
+                                    " exceeds record " + i_recordName));
+            }
+
             // Before writing the keyword's value, get the maximum size that can
             // be updated.
             const auto l_lengthToUpdate =
@@ -699,33 +927,26 @@ int IpzVpdParser::setKeywordValueInRecord(
                     ? i_keywordData.size()
                     : l_kwdDataLength;
 
-            // Set the keyword's value on vector. This is required to update the
+            // Set the keyword's value in record. This is required to update the
             // record's ECC based on the new value set.
             const auto i_keywordDataEnd = std::ranges::next(
                 i_keywordData.cbegin(), l_lengthToUpdate, i_keywordData.cend());
 
             std::copy(i_keywordData.cbegin(), i_keywordDataEnd, l_iterator);
 
-            // Set the keyword's value on hardware
-            const auto l_kwdDataOffset =
-                std::distance(io_vpdVector.begin(), l_iterator);
-            m_vpdFileStream.seekp(m_vpdStartOffset + l_kwdDataOffset,
-                                  std::ios::beg);
-
-            std::copy(i_keywordData.cbegin(), i_keywordDataEnd,
-                      std::ostreambuf_iterator<char>(m_vpdFileStream));
+            o_kwdDataOffset = std::distance(io_recordData.begin(), l_iterator);
 
             // return no of bytes set
             return l_lengthToUpdate;
         }
 
         // next keyword search
-        std::ranges::advance(l_iterator, l_kwdDataLength, io_vpdVector.end());
+        std::ranges::advance(l_iterator, l_kwdDataLength, io_recordData.end());
 
         // next keyword name
         l_kwName = std::string(
             l_iterator,
-            std::ranges::next(l_iterator, Length::KW_NAME, io_vpdVector.end()));
+            std::ranges::next(l_iterator, Length::KW_NAME, io_recordData.end()));
     }
 
     // Keyword not found
@@ -733,31 +954,55 @@ int IpzVpdParser::setKeywordValueInRecord(
         "Keyword " + i_keywordName + " not found in record " + i_recordName));
 }
 
+void IpzVpdParser::writeRangesOnHardware(
+    const std::vector<std::pair<size_t, types::BinaryView>>& i_dirtyRanges)
+{
+    uint16_t l_errCode = 0;
+    VpdImage::writeRanges(m_vpdFilePath, m_vpdStartOffset, i_dirtyRanges,
+                          l_errCode);
+
+    if (l_errCode)
+    {
+        throw(DataException(std::format(
+            "Failed to write {} range(s) of VPD on hardware path {}, error: {}",
+            i_dirtyRanges.size(), m_vpdFilePath,
+            commonUtility::getErrCodeMsg(l_errCode))));
+    }
+}
+
 int IpzVpdParser::writeKeywordOnHardware(
     const types::WriteVpdParams i_paramsToWriteData)
 {
-    int l_sizeWritten = -1;
+    // Extract record, keyword and value from i_paramsToWriteData
+    if (const types::IpzData* l_ipzData =
+            std::get_if<types::IpzData>(&i_paramsToWriteData))
+    {
+        return writeKeywordsOnHardware({*l_ipzData});
+    }
 
-    try
+    Logger::getLoggerInstance()->logMessage(
+        "Input parameter type provided isn't compatible with the given FRU's VPD type.");
+    throw types::DbusInvalidArgument();
+}
+
+std::map<types::Record, IpzVpdParser::RecordUpdate>
+    IpzVpdParser::getRecordUpdates(
+        const std::vector<types::IpzData>& i_keywordsToWrite)
+{
+    if (i_keywordsToWrite.empty())
     {
-        types::Record l_recordName;
-        types::Keyword l_keywordName;
-        types::BinaryVector l_keywordData;
+        Logger::getLoggerInstance()->logMessage(
+            "Write operation not allowed as no keyword is given.");
+        throw types::DbusInvalidArgument();
+    }
 
-        // Extract record, keyword and value from i_paramsToWriteData
-        if (const types::IpzData* l_ipzData =
-                std::get_if<types::IpzData>(&i_paramsToWriteData))
-        {
-            l_recordName = std::get<0>(*l_ipzData);
-            l_keywordName = std::get<1>(*l_ipzData);
-            l_keywordData = std::get<2>(*l_ipzData);
-        }
-        else
-        {
-            Logger::getLoggerInstance()->logMessage(
-                "Input parameter type provided isn't compatible with the given FRU's VPD type.");
-            throw types::DbusInvalidArgument();
-        }
+    // Group keywords on record, so that every record is updated only once.
+    std::map<types::Record, std::vector<const types::IpzData*>>
+        l_keywordsPerRecord;
+
+    for (const auto& l_ipzData : i_keywordsToWrite)
+    {
+        const auto& [l_recordName, l_keywordName, l_keywordData] = l_ipzData;
 
         if (l_recordName == "VHDR" || l_recordName == "VTOC")
         {
@@ -774,53 +1019,136 @@ int IpzVpdParser::writeKeywordOnHardware(
             throw types::DbusInvalidArgument();
         }
 
-        auto l_vpdBegin = m_vpdVector.begin();
+        l_keywordsPerRecord[l_recordName].push_back(&l_ipzData);
+    }
+
+    auto l_vpdBegin = m_vpdVector.begin();
+
+    // Get VTOC offset
+    std::ranges::advance(l_vpdBegin, Offset::VTOC_PTR, m_vpdVector.end());
+    auto l_vtocOffset = readUInt16LE(l_vpdBegin);
 
-        // Get VTOC offset
-        std::ranges::advance(l_vpdBegin, Offset::VTOC_PTR, m_vpdVector.end());
-        auto l_vtocOffset = readUInt16LE(l_vpdBegin);
+    std::map<types::Record, RecordUpdate> l_recordUpdates;
 
+    for (const auto& [l_recordName, l_keywords] : l_keywordsPerRecord)
+    {
         // Get the details of user given record from VTOC
         const types::RecordData& l_inputRecordDetails =
             getRecordDetailsFromVTOC(l_recordName, l_vtocOffset);
 
-        const auto& l_inputRecordOffset = std::get<0>(l_inputRecordDetails);
+        const auto& [l_recordOffset, l_recordLength, l_eccOffset,
+                     l_eccLength] = l_inputRecordDetails;
 
-        if (l_inputRecordOffset == 0)
+        if (l_recordOffset == 0)
         {
             throw(DataException("Record not found in VTOC PT keyword."));
         }
 
-        // Create a local copy of m_vpdVector to perform keyword update and ecc
-        // update on filestream.
-        types::BinaryVector l_vpdVector = m_vpdVector;
+        if ((size_t{l_recordOffset} + l_recordLength > m_vpdVector.size()) ||
+            (size_t{l_eccOffset} + l_eccLength > m_vpdVector.size()))
+        {
+            throw(DataException("Record " + l_recordName +
+                                " or its ECC exceeds VPD size"));
+        }
 
-        // write keyword's value on hardware
-        l_sizeWritten =
-            setKeywordValueInRecord(l_recordName, l_keywordName, l_keywordData,
-                                    l_inputRecordOffset, l_vpdVector);
+        RecordUpdate& l_recordUpdate = l_recordUpdates[l_recordName];
+        l_recordUpdate.m_recordDetails = l_inputRecordDetails;
 
-        if (l_sizeWritten <= 0)
+        // Copy of just the record, to set keywords' value and compute ECC on.
+        types::BinaryVector& l_recordData = l_recordUpdate.m_recordData;
+        l_recordData.assign(
+            std::next(m_vpdVector.begin(), l_recordOffset),
+            std::next(m_vpdVector.begin(), l_recordOffset + l_recordLength));
+
+        // Offset and length of updated keywords' value in record.
+        std::vector<std::pair<size_t, size_t>> l_updatedRanges;
+
+        for (const auto* l_ipzData : l_keywords)
         {
-            throw(DataException("Unable to set value on " + l_recordName + ":" +
-                                l_keywordName));
+            const auto& l_keywordName = std::get<1>(*l_ipzData);
+
+            size_t l_kwdDataOffset = 0;
+            const auto l_kwdSizeWritten = setKeywordValueInRecord(
+                l_recordName, l_keywordName, std::get<2>(*l_ipzData),
+                l_recordData, l_kwdDataOffset);
+
+            if (l_kwdSizeWritten <= 0)
+            {
+                throw(DataException("Unable to set value on " + l_recordName +
+                                    ":" + l_keywordName));
+            }
+
+            l_updatedRanges.emplace_back(l_kwdDataOffset, l_kwdSizeWritten);
+            l_recordUpdate.m_sizeSet += l_kwdSizeWritten;
         }
 
-        // Update the record's ECC
-        updateRecordECC(l_inputRecordOffset, std::get<1>(l_inputRecordDetails),
-                        std::get<2>(l_inputRecordDetails),
-                        std::get<3>(l_inputRecordDetails), l_vpdVector);
+        // Merge adjacent or overlapping keywords into one write.
+        std::ranges::sort(l_updatedRanges);
 
-        Logger::getLoggerInstance()->logMessage(std::format(
-            "{} bytes updated successfully on hardware path {} for {}:{}",
-            std::to_string(l_sizeWritten), m_vpdFilePath, l_recordName,
-            l_keywordName));
+        auto l_rangeItr = l_updatedRanges.begin();
+        while (l_rangeItr != l_updatedRanges.end())
+        {
+            const size_t l_rangeBegin = l_rangeItr->first;
+            size_t l_rangeEnd = l_rangeItr->first + l_rangeItr->second;
+
+            while (++l_rangeItr != l_updatedRanges.end() &&
+                   l_rangeItr->first <= l_rangeEnd)
+            {
+                l_rangeEnd = std::max(l_rangeEnd,
+                                      l_rangeItr->first + l_rangeItr->second);
+            }
+
+            l_recordUpdate.m_keywordRanges.emplace_back(
+                l_recordOffset + l_rangeBegin,
+                types::BinaryVector(
+                    std::next(l_recordData.begin(), l_rangeBegin),
+                    std::next(l_recordData.begin(), l_rangeEnd)));
+        }
     }
-    catch (const std::exception& l_exception)
+
+    return l_recordUpdates;
+}
+
+int IpzVpdParser::writeKeywordsOnHardware(
+    const std::vector<types::IpzData>& i_keywordsToWrite)
+{
+    auto l_recordUpdates = getRecordUpdates(i_keywordsToWrite);
+
+    // Final data of ranges to be written, with their offset in VPD.
+    std::vector<std::pair<size_t, types::BinaryVector>> l_dirtyData;
+    int l_sizeWritten = 0;
+
+    for (auto& [l_recordName, l_recordUpdate] : l_recordUpdates)
     {
-        throw;
+        const auto& [l_recordOffset, l_recordLength, l_eccOffset,
+                     l_eccLength] = l_recordUpdate.m_recordDetails;
+
+        std::ranges::move(l_recordUpdate.m_keywordRanges,
+                          std::back_inserter(l_dirtyData));
+
+        // Update the record's ECC, once for all its keywords.
+        types::BinaryVector l_recordECC(l_eccLength);
+        updateRecordECC(l_recordUpdate.m_recordData, l_recordECC);
+
+        l_dirtyData.emplace_back(l_eccOffset, std::move(l_recordECC));
+        l_sizeWritten += l_recordUpdate.m_sizeSet;
+    }
+
+    // Only keywords' value and records' ECC change on hardware.
+    std::vector<std::pair<size_t, types::BinaryView>> l_dirtyRanges;
+    l_dirtyRanges.reserve(l_dirtyData.size());
+    for (const auto& [l_offset, l_data] : l_dirtyData)
+    {
+        l_dirtyRanges.emplace_back(l_offset, types::BinaryView(l_data));
     }
 
+    writeRangesOnHardware(l_dirtyRanges);
+
+    Logger::getLoggerInstance()->logMessage(std::format(
+        "{} bytes of {} keyword(s) in {} record(s) updated successfully on hardware path {}",
+        l_sizeWritten, i_keywordsToWrite.size(), l_recordUpdates.size(),
+        m_vpdFilePath));
+
     return l_sizeWritten;
 }
 
@@ -883,36 +1211,34 @@ bool IpzVpdParser::processInvalidRecords(
     return l_rc;
 }
 
-std::vector<std::string> IpzVpdParser::getMissingDataFromMap(
-    const types::IpzVpdMapVariant& i_mapToCompareWith,
-    const types::IpzVpdMapVariant& i_mapToCompare) const
+bool IpzVpdParser::isRecordIdentical(
+    const IpzVpdParser& i_otherParser,
+    const types::Record& i_recordName) const noexcept
 {
-    std::vector<std::string> l_missingData;
+    const auto l_itr = m_recordIndex.find(i_recordName);
+    const auto l_otherItr = i_otherParser.m_recordIndex.find(i_recordName);
 
-    std::visit(
-        [&l_missingData](const auto& l_mapToCompareWith,
-                         const auto& l_mapToCompare) {
-            using T1 = std::decay_t<decltype(l_mapToCompareWith)>;
-            using T2 = std::decay_t<decltype(l_mapToCompare)>;
+    if (l_itr == m_recordIndex.end() ||
+        l_otherItr == i_otherParser.m_recordIndex.end())
+    {
+        return false;
+    }
 
-            if constexpr (!(std::is_same_v<T1, std::monostate> ||
-                            std::is_same_v<T2, std::monostate>) &&
-                          std::is_same_v<T1, T2>)
-            {
-                std::ranges::for_each(
-                    l_mapToCompareWith | std::views::keys |
-                        std::views::filter(
-                            [&l_mapToCompare](const auto& l_key) {
-                                return !l_mapToCompare.contains(l_key);
-                            }),
-                    [&l_missingData](const auto& l_key) {
-                        l_missingData.push_back(l_key);
-                    });
-            }
-        },
-        i_mapToCompareWith, i_mapToCompare);
+    const size_t l_offset = std::get<0>(l_itr->second);
+    const size_t l_length = std::get<1>(l_itr->second);
+    const size_t l_otherOffset = std::get<0>(l_otherItr->second);
+    const size_t l_otherLength = std::get<1>(l_otherItr->second);
+
+    if (l_length != l_otherLength ||
+        l_offset + l_length > m_vpdVector.size() ||
+        l_otherOffset + l_otherLength > i_otherParser.m_vpdVector.size())
+    {
+        return false;
+    }
 
-    return l_missingData;
+    return std::memcmp(m_vpdVector.data() + l_offset,
+                       i_otherParser.m_vpdVector.data() + l_otherOffset,
+                       l_length) == 0;
 }
 
 bool IpzVpdParser::compareData(
@@ -920,61 +1246,133 @@ bool IpzVpdParser::compareData(
 {
     try
     {
-        if (!i_redundantParser)
+        const auto l_redundantParser =
+            std::dynamic_pointer_cast<IpzVpdParser>(i_redundantParser);
+
+        if (!l_redundantParser)
         {
             throw std::runtime_error(
                 "Invalid redundant parser instance received.");
         }
 
-        const auto l_primaryIpzVpdMap =
-            std::get<types::IPZVpdMap>(this->parse());
-        const auto l_redundantIpzVpdMap =
-            std::get<types::IPZVpdMap>(i_redundantParser.get()->parse());
+        // VPDs are independent of each other, parse the redundant one
+        // alongside.
+        auto l_redundantViewFuture =
+            std::async(std::launch::async, [&l_redundantParser]() {
+                auto l_view = l_redundantParser->parseToView();
+                l_redundantParser->buildRecordIndex();
+                return l_view;
+            });
+
+        const auto l_primaryView = parseToView();
+        buildRecordIndex();
 
+        const auto l_redundantView = l_redundantViewFuture.get();
+
+        std::vector<std::string> l_missingRecordsInPrimary;
         std::vector<std::string> l_missingRecordsInRedundant;
-        types::RecordKeywordsMap l_missingKeywordsInRedundant;
         types::RecordKeywordsMap l_missingKeywordsInPrimary;
+        types::RecordKeywordsMap l_missingKeywordsInRedundant;
         types::RecordKeywordsMap l_mismatchedVpd;
 
-        std::vector<std::string> l_missingRecordsInPrimary =
-            getMissingDataFromMap(l_redundantIpzVpdMap, l_primaryIpzVpdMap);
-
-        for (const auto& [l_recordName, l_keywordValueMap] : l_primaryIpzVpdMap)
+        using EntryItr = std::vector<IpzVpdView::KeywordEntry>::const_iterator;
+
+        // Entries are sorted on record and then keyword, duplicates of a
+        // keyword follow the one found first in the image.
+        auto l_nextRecord = [](EntryItr i_itr, EntryItr i_end) {
+            const auto l_record = i_itr->m_record;
+            return std::find_if(i_itr, i_end, [&l_record](const auto& l_entry) {
+                return l_entry.m_record != l_record;
+            });
+        };
+
+        auto l_nextKeyword = [](EntryItr i_itr, EntryItr i_end) {
+            const auto l_keyword = i_itr->m_keyword;
+            return std::find_if(
+                i_itr, i_end, [&l_keyword](const auto& l_entry) {
+                    return l_entry.m_keyword != l_keyword;
+                });
+        };
+
+        const auto& l_primaryEntries = l_primaryView.getEntries();
+        const auto& l_redundantEntries = l_redundantView.getEntries();
+
+        auto l_primaryItr = l_primaryEntries.cbegin();
+        auto l_redundantItr = l_redundantEntries.cbegin();
+
+        while (l_primaryItr != l_primaryEntries.cend() ||
+               l_redundantItr != l_redundantEntries.cend())
         {
-            auto l_itrToRedundantRecord =
-                l_redundantIpzVpdMap.find(l_recordName);
-
-            if (l_itrToRedundantRecord == l_redundantIpzVpdMap.end())
+            if (l_redundantItr == l_redundantEntries.cend() ||
+                (l_primaryItr != l_primaryEntries.cend() &&
+                 l_primaryItr->m_record < l_redundantItr->m_record))
             {
-                l_missingRecordsInRedundant.push_back(l_recordName);
+                l_missingRecordsInRedundant.emplace_back(
+                    l_primaryItr->m_record);
+                l_primaryItr =
+                    l_nextRecord(l_primaryItr, l_primaryEntries.cend());
                 continue;
             }
 
-            const auto l_missingKeywords = getMissingDataFromMap(
-                l_itrToRedundantRecord->second, l_keywordValueMap);
-
-            if (!l_missingKeywords.empty())
+            if (l_primaryItr == l_primaryEntries.cend() ||
+                l_redundantItr->m_record < l_primaryItr->m_record)
             {
-                l_missingKeywordsInPrimary[l_recordName] = l_missingKeywords;
+                l_missingRecordsInPrimary.emplace_back(
+                    l_redundantItr->m_record);
+                l_redundantItr =
+                    l_nextRecord(l_redundantItr, l_redundantEntries.cend());
+                continue;
             }
 
-            for (const auto& [l_keywordName, l_keywordValue] :
-                 l_keywordValueMap)
-            {
-                uint16_t l_errCode = 0;
-                const auto l_redundantKwdValue = vpdSpecificUtility::getKwVal(
-                    l_itrToRedundantRecord->second, l_keywordName, l_errCode);
+            const types::Record l_recordName(l_primaryItr->m_record);
+            const auto l_primaryRecordEnd =
+                l_nextRecord(l_primaryItr, l_primaryEntries.cend());
+            const auto l_redundantRecordEnd =
+                l_nextRecord(l_redundantItr, l_redundantEntries.cend());
 
-                if (l_errCode == error_code::KEYWORD_NOT_FOUND)
-                {
-                    l_missingKeywordsInRedundant[l_recordName].push_back(
-                        l_keywordName);
-                }
-                else if (l_redundantKwdValue != l_keywordValue)
+            // Keywords need a diff only if the record's bytes differ.
+            if (!isRecordIdentical(*l_redundantParser, l_recordName))
+            {
+                while (l_primaryItr != l_primaryRecordEnd ||
+                       l_redundantItr != l_redundantRecordEnd)
                 {
-                    l_mismatchedVpd[l_recordName].push_back(l_keywordName);
+                    if (l_redundantItr == l_redundantRecordEnd ||
+                        (l_primaryItr != l_primaryRecordEnd &&
+                         l_primaryItr->m_keyword < l_redundantItr->m_keyword))
+                    {
+                        l_missingKeywordsInRedundant[l_recordName].emplace_back(
+                            l_primaryItr->m_keyword);
+                        l_primaryItr =
+                            l_nextKeyword(l_primaryItr, l_primaryRecordEnd);
+                        continue;
+                    }
+
+                    if (l_primaryItr == l_primaryRecordEnd ||
+                        l_redundantItr->m_keyword < l_primaryItr->m_keyword)
+                    {
+                        l_missingKeywordsInPrimary[l_recordName].emplace_back(
+                            l_redundantItr->m_keyword);
+                        l_redundantItr =
+                            l_nextKeyword(l_redundantItr, l_redundantRecordEnd);
+                        continue;
+                    }
+
+                    if (l_primaryView.getValue(*l_primaryItr) !=
+                        l_redundantView.getValue(*l_redundantItr))
+                    {
+                        l_mismatchedVpd[l_recordName].emplace_back(
+                            l_primaryItr->m_keyword);
+                    }
+
+                    l_primaryItr =
+                        l_nextKeyword(l_primaryItr, l_primaryRecordEnd);
+                    l_redundantItr =
+                        l_nextKeyword(l_redundantItr, l_redundantRecordEnd);
                 }
             }
+
+            l_primaryItr = l_primaryRecordEnd;
+            l_redundantItr = l_redundantRecordEnd;
         }
 
         if (const auto& l_message = getDataInPrintableFormat(
@@ -0,0 +1,81 @@
+#include "ipz_vpd_view.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+namespace vpd
+{
+namespace
+{
+/**
+ * @brief Comparator to order keyword entries on record and keyword name.
+ */
+struct EntryLess
+{
+    bool operator()(const IpzVpdView::KeywordEntry& i_lhs,
+                    const IpzVpdView::KeywordEntry& i_rhs) const noexcept
+    {
+        return std::tie(i_lhs.m_record, i_lhs.m_keyword) <
+               std::tie(i_rhs.m_record, i_rhs.m_keyword);
+    }
+};
+} // namespace
+
+IpzVpdView::IpzVpdView(types::BinaryView i_vpdVector,
+                       std::vector<KeywordEntry>&& i_entries) :
+    m_vpdVector(i_vpdVector), m_entries(std::move(i_entries))
+{
+    // Stable sort keeps the first occurrence of a duplicate ahead.
+    std::stable_sort(m_entries.begin(), m_entries.end(), EntryLess{});
+}
+
+std::optional<std::string_view> IpzVpdView::getKeywordValue(
+    std::string_view i_record, std::string_view i_keyword) const noexcept
+{
+    const KeywordEntry l_key{i_record, i_keyword, 0, 0};
+    const auto l_itr = std::lower_bound(m_entries.begin(), m_entries.end(),
+                                        l_key, EntryLess{});
+
+    if (l_itr == m_entries.end() || l_itr->m_record != i_record ||
+        l_itr->m_keyword != i_keyword)
+    {
+        return std::nullopt;
+    }
+
+    return getValue(*l_itr);
+}
+
+bool IpzVpdView::hasRecord(std::string_view i_record) const noexcept
+{
+    const auto l_itr = std::lower_bound(
+        m_entries.begin(), m_entries.end(), i_record,
+        [](const KeywordEntry& i_entry, std::string_view i_recordName) {
+            return i_entry.m_record < i_recordName;
+        });
+
+    return (l_itr != m_entries.end() && l_itr->m_record == i_record);
+}
+
+types::IPZVpdMap IpzVpdView::toIpzVpdMap() const
+{
+    types::IPZVpdMap l_ipzVpdMap;
+
+    auto l_recordItr = l_ipzVpdMap.end();
+    for (const auto& l_entry : m_entries)
+    {
+        if (l_recordItr == l_ipzVpdMap.end() ||
+            l_recordItr->first != l_entry.m_record)
+        {
+            l_recordItr =
+                l_ipzVpdMap.emplace(std::string(l_entry.m_record),
+                                    types::IPZKwdValueMap{})
+                    .first;
+        }
+
+        l_recordItr->second.emplace(std::string(l_entry.m_keyword),
+                                    std::string(getValue(l_entry)));
+    }
+
+    return l_ipzVpdMap;
+}
+} // namespace vpd
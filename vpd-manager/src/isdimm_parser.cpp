@@ -63,7 +63,7 @@ const std::unordered_map<std::string, std::string> pnCCINMap = {
     {"78P6815", "32BB"}};
 
 auto JedecSpdParser::getDDR4DimmCapacity(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     size_t l_tmp = 0, l_dimmSize = 0;
 
@@ -141,7 +141,7 @@ auto JedecSpdParser::getDDR4DimmCapacity(
 }
 
 std::string_view JedecSpdParser::getDDR4PartNumber(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     char l_tmpPN[constants::PART_NUM_LEN + 1] = {'\0'};
     sprintf(l_tmpPN, "%02X%02X%02X%X",
@@ -154,7 +154,7 @@ std::string_view JedecSpdParser::getDDR4PartNumber(
 }
 
 std::string JedecSpdParser::getDDR4SerialNumber(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     char l_tmpSN[constants::SERIAL_NUM_LEN + 1] = {'\0'};
     sprintf(l_tmpSN, "%02X%02X%02X%02X%02X%02X",
@@ -170,7 +170,7 @@ std::string JedecSpdParser::getDDR4SerialNumber(
 
 std::string_view JedecSpdParser::getDDR4FruNumber(
     const std::string& i_partNumber,
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     // check for 128GB ISRDIMM not implemented
     //(128GB 2RX4(8GX72) IS RDIMM 36*(16GBIT, 2H),1.2V 288PIN,1.2" ROHS) - NA
@@ -218,14 +218,14 @@ types::BinaryVector JedecSpdParser::getDDR4ManufacturerId()
         return l_mfgId;
     }
 
-    std::copy_n((m_memSpd.cbegin() +
+    std::copy_n((m_memSpd.begin() +
                  SPD_JEDEC_DDR4_DRAM_MANUFACTURER_ID_OFFSET),
                 SPD_JEDEC_DRAM_MANUFACTURER_ID_LENGTH, l_mfgId.begin());
     return l_mfgId;
 }
 
 auto JedecSpdParser::getDDR5DimmCapacity(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     // dummy implementation to be updated when required
     size_t dimmSize = 0;
@@ -234,7 +234,7 @@ auto JedecSpdParser::getDDR5DimmCapacity(
 }
 
 auto JedecSpdParser::getDDR5PartNumber(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     // dummy implementation to be updated when required
     std::string l_partNumber;
@@ -244,7 +244,7 @@ auto JedecSpdParser::getDDR5PartNumber(
 }
 
 auto JedecSpdParser::getDDR5SerialNumber(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     // dummy implementation to be updated when required
     std::string l_serialNumber;
@@ -288,7 +288,7 @@ auto JedecSpdParser::getDDR5CCIN(const std::string& i_partNumber)
 }
 
 types::JedecSpdMap JedecSpdParser::readKeywords(
-    types::BinaryVector::const_iterator& i_iterator)
+    types::BinaryView::iterator& i_iterator)
 {
     types::JedecSpdMap l_keywordValueMap{};
     size_t dimmSize = getDDR4DimmCapacity(i_iterator);
@@ -329,7 +329,7 @@ types::JedecSpdMap JedecSpdParser::readKeywords(
 types::VPDMapVariant JedecSpdParser::parse()
 {
     // Read the data and return the map
-    auto l_iterator = m_memSpd.cbegin();
+    auto l_iterator = m_memSpd.begin();
     auto l_spdDataMap = readKeywords(l_iterator);
     return l_spdDataMap;
 }
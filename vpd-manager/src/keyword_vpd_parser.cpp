@@ -41,7 +41,7 @@ types::VPDMapVariant KeywordVpdParser::parse()
             throw(DataException("Invalid Keyword Vpd Start Tag"));
         }
     }
-    types::BinaryVector::const_iterator l_checkSumStart = m_vpdIterator;
+    types::BinaryView::iterator l_checkSumStart = m_vpdIterator;
     auto l_kwValMap = populateVpdMap();
 
     // Do these validations before returning parsed data.
@@ -51,7 +51,7 @@ types::VPDMapVariant KeywordVpdParser::parse()
         throw(DataException("Invalid Small resource type End"));
     }
 
-    types::BinaryVector::const_iterator l_checkSumEnd = m_vpdIterator;
+    types::BinaryView::iterator l_checkSumEnd = m_vpdIterator;
     validateChecksum(l_checkSumStart, l_checkSumEnd);
 
     checkNextBytesValidity(constants::TWO_BYTES);
@@ -188,7 +188,8 @@ int KeywordVpdParser::writeKeywordOnHardware(
     }
 
     // Create a mutable copy of the VPD vector for checksum calculation
-    types::BinaryVector l_vpdVector = m_keywordVpdVector;
+    types::BinaryVector l_vpdVector(m_keywordVpdVector.begin(),
+                                    m_keywordVpdVector.end());
 
     size_t l_bytesWritten =
         setKeywordValue(l_keywordName, l_keywordData, l_vpdVector);
@@ -368,8 +369,8 @@ types::KeywordVpdMap KeywordVpdParser::populateVpdMap()
 }
 
 void KeywordVpdParser::validateChecksum(
-    types::BinaryVector::const_iterator i_checkSumStart,
-    types::BinaryVector::const_iterator i_checkSumEnd)
+    types::BinaryView::iterator i_checkSumStart,
+    types::BinaryView::iterator i_checkSumEnd)
 {
     uint8_t l_checkSumCalculated = 0;
 
@@ -219,6 +219,31 @@ void Listener::registerPresenceChangeCallback() noexcept
             return;
         }
 
+        if (!m_hotPlugQueue && !l_listOfFrus.empty())
+        {
+            try
+            {
+                m_hotPlugQueue = std::make_unique<HotPlugQueue>(
+                    [this](const std::string& i_inventoryPath,
+                           const bool i_isPresent) {
+                        processPresenceChange(i_inventoryPath, i_isPresent);
+                    },
+                    constants::HOT_PLUG_THREADS,
+                    std::chrono::milliseconds(
+                        constants::HOT_PLUG_COALESCE_TIME_MS),
+                    // A change of every monitored FRU fits, so posting one
+                    // doesn't fail for want of space.
+                    l_listOfFrus.size());
+            }
+            catch (const std::exception& l_ex)
+            {
+                // Presence changes get processed on the event loop.
+                Logger::getLoggerInstance()->logMessage(
+                    "Failed to create hot plug queue, error: " +
+                    std::string(l_ex.what()));
+            }
+        }
+
         for (const auto& l_inventoryPath : l_listOfFrus)
         {
             std::shared_ptr<sdbusplus::match> l_fruPresenceMatch =
@@ -273,29 +298,22 @@ void Listener::presentPropertyChangeCallback(
 
         if (auto l_present = std::get_if<bool>(&(l_itr->second)))
         {
-            if (!m_configManager)
+            if (!m_hotPlugQueue)
             {
-                throw std::runtime_error(std::format(
-                    "Config manager object is null while performing FRU VPD collection/deletion for: {}, Present state : {}",
-                    l_objectPath, *l_present));
+                processPresenceChange(l_objectPath, *l_present);
+                return;
             }
 
-            const auto l_chassisJsonResult =
-                m_configManager->getJsonObj(l_objectPath);
-
-            if (!l_chassisJsonResult.has_value())
+            // Event loop only queues the change, FRU is read off the loop.
+            // Processing it here could overlap a queued change of the same
+            // FRU, hence it is dropped if the queue can't take it.
+            if (!m_hotPlugQueue->post(l_objectPath, *l_present))
             {
-                throw std::runtime_error(std::format(
-                    "Path {} not found in JSON, can't perform FRU VPD collection/deletion. Error: {}",
-                    l_objectPath,
-                    commonUtility::getErrCodeMsg(l_chassisJsonResult.error())));
+                Logger::getLoggerInstance()->logMessage(std::format(
+                    "Hot plug queue full or stopping, dropped presence change "
+                    "of {} to {}",
+                    l_objectPath, *l_present));
             }
-
-            *l_present
-                ? Worker{}.collectSingleFruVpd(
-                      l_chassisJsonResult.value().get(), l_objectPath)
-                : Worker{}.deleteFruVpd(l_chassisJsonResult.value().get(),
-                                        l_objectPath);
         }
         else
         {
@@ -316,6 +334,49 @@ void Listener::presentPropertyChangeCallback(
     }
 }
 
+void Listener::processPresenceChange(const std::string& i_inventoryPath,
+                                     const bool i_isPresent) const noexcept
+{
+    try
+    {
+        if (!m_configManager)
+        {
+            throw std::runtime_error(std::format(
+                "Config manager object is null while performing FRU VPD collection/deletion for: {}, Present state : {}",
+                i_inventoryPath, i_isPresent));
+        }
+
+        // Snapshot keeps the JSON valid across a reload while FRU is handled.
+        const auto l_chassisJsonResult =
+            m_configManager->getJsonSnapshot(i_inventoryPath);
+
+        if (!l_chassisJsonResult.has_value())
+        {
+            throw std::runtime_error(std::format(
+                "Path {} not found in JSON, can't perform FRU VPD collection/deletion. Error: {}",
+                i_inventoryPath,
+                commonUtility::getErrCodeMsg(l_chassisJsonResult.error())));
+        }
+
+        i_isPresent
+            ? Worker{}.collectSingleFruVpd(*l_chassisJsonResult.value(),
+                                           i_inventoryPath)
+            : Worker{}.deleteFruVpd(*l_chassisJsonResult.value(),
+                                    i_inventoryPath);
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            std::string("Process presence change failed, reason: ") +
+                std::string(l_ex.what()),
+            PlaceHolder::PEL,
+            types::PelInfoTuple{EventLogger::getErrorType(l_ex),
+                                types::SeverityType::Informational, 0,
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt, std::nullopt});
+    }
+}
+
 void Listener::registerCorrPropCallBack(
     const std::string& i_correlatedPropJsonFile) noexcept
 {
@@ -0,0 +1,193 @@
+#include "location_code_index.hpp"
+
+#include "constants.hpp"
+#include "logger.hpp"
+
+#include <format>
+#include <mutex>
+
+namespace vpd
+{
+std::string LocationCodeIndex::getAbsolutePath(
+    const std::string& i_inventoryPath)
+{
+    if (i_inventoryPath.starts_with(constants::pimPath))
+    {
+        return i_inventoryPath;
+    }
+
+    return constants::pimPath + i_inventoryPath;
+}
+
+void LocationCodeIndex::updateLocked(const std::string& i_inventoryPath,
+                                     const std::string& i_expandedLocationCode)
+{
+    const auto [l_itr, l_isInserted] =
+        m_invPathToLocCodeMap.try_emplace(i_inventoryPath,
+                                          i_expandedLocationCode);
+    if (!l_isInserted)
+    {
+        if (l_itr->second == i_expandedLocationCode)
+        {
+            return;
+        }
+
+        // Drop the object from its old location code.
+        if (auto l_oldItr = m_locCodeToInvPathsMap.find(l_itr->second);
+            l_oldItr != m_locCodeToInvPathsMap.end())
+        {
+            l_oldItr->second.erase(i_inventoryPath);
+            if (l_oldItr->second.empty())
+            {
+                m_locCodeToInvPathsMap.erase(l_oldItr);
+            }
+        }
+
+        l_itr->second = i_expandedLocationCode;
+    }
+
+    m_locCodeToInvPathsMap[i_expandedLocationCode].emplace(i_inventoryPath);
+}
+
+void LocationCodeIndex::removeLocked(const std::string& i_inventoryPath)
+{
+    const auto l_itr = m_invPathToLocCodeMap.find(i_inventoryPath);
+    if (l_itr == m_invPathToLocCodeMap.end())
+    {
+        return;
+    }
+
+    if (auto l_locCodeItr = m_locCodeToInvPathsMap.find(l_itr->second);
+        l_locCodeItr != m_locCodeToInvPathsMap.end())
+    {
+        l_locCodeItr->second.erase(i_inventoryPath);
+        if (l_locCodeItr->second.empty())
+        {
+            m_locCodeToInvPathsMap.erase(l_locCodeItr);
+        }
+    }
+
+    m_invPathToLocCodeMap.erase(l_itr);
+}
+
+void LocationCodeIndex::update(
+    const std::string& i_inventoryPath,
+    const std::string& i_expandedLocationCode) noexcept
+{
+    try
+    {
+        const std::string l_inventoryPath = getAbsolutePath(i_inventoryPath);
+
+        std::unique_lock l_lock(m_mutex);
+        updateLocked(l_inventoryPath, i_expandedLocationCode);
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Failed to index location code {} of {}, error: {}",
+            i_expandedLocationCode, i_inventoryPath, l_ex.what()));
+    }
+}
+
+void LocationCodeIndex::update(
+    const std::string& i_inventoryPath,
+    const types::InterfaceMap& i_interfaceMap) noexcept
+{
+    const auto l_interfaceItr = i_interfaceMap.find(constants::locationCodeInf);
+    if (l_interfaceItr == i_interfaceMap.end())
+    {
+        return;
+    }
+
+    const auto l_propertyItr = l_interfaceItr->second.find("LocationCode");
+    if (l_propertyItr == l_interfaceItr->second.end())
+    {
+        return;
+    }
+
+    if (const auto l_locationCode =
+            std::get_if<std::string>(&l_propertyItr->second))
+    {
+        update(i_inventoryPath, *l_locationCode);
+    }
+}
+
+void LocationCodeIndex::update(const types::ObjectMap& i_objectMap) noexcept
+{
+    for (const auto& [l_objectPath, l_interfaceMap] : i_objectMap)
+    {
+        update(l_objectPath.str, l_interfaceMap);
+    }
+}
+
+void LocationCodeIndex::remove(const std::string& i_inventoryPath) noexcept
+{
+    try
+    {
+        const std::string l_inventoryPath = getAbsolutePath(i_inventoryPath);
+
+        std::unique_lock l_lock(m_mutex);
+        removeLocked(l_inventoryPath);
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            std::format("Failed to drop {} from location code index, error: {}",
+                        i_inventoryPath, l_ex.what()));
+    }
+}
+
+types::ListOfPaths LocationCodeIndex::getInventoryPaths(
+    const std::string& i_expandedLocationCode) const noexcept
+{
+    types::ListOfPaths l_inventoryPaths;
+    try
+    {
+        std::shared_lock l_lock(m_mutex);
+
+        const auto l_itr = m_locCodeToInvPathsMap.find(i_expandedLocationCode);
+        if (l_itr != m_locCodeToInvPathsMap.end())
+        {
+            l_inventoryPaths.assign(l_itr->second.begin(),
+                                    l_itr->second.end());
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Failed to get inventory paths of location code {}, error: {}",
+            i_expandedLocationCode, l_ex.what()));
+    }
+
+    return l_inventoryPaths;
+}
+
+std::optional<std::string> LocationCodeIndex::getLocationCode(
+    const std::string& i_inventoryPath) const noexcept
+{
+    try
+    {
+        std::shared_lock l_lock(m_mutex);
+
+        const auto l_itr = m_invPathToLocCodeMap.find(i_inventoryPath);
+        if (l_itr != m_invPathToLocCodeMap.end())
+        {
+            return l_itr->second;
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            std::format("Failed to get location code of {}, error: {}",
+                        i_inventoryPath, l_ex.what()));
+    }
+
+    return std::nullopt;
+}
+
+size_t LocationCodeIndex::size() const noexcept
+{
+    std::shared_lock l_lock(m_mutex);
+    return m_invPathToLocCodeMap.size();
+}
+} // namespace vpd
@@ -0,0 +1,253 @@
+#include "log_ring_buffer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <thread>
+
+namespace vpd
+{
+LogRingBuffer::LogRingBuffer(const size_t i_slotCount,
+                             const LogOverflowPolicy i_overflowPolicy) :
+    m_overflowPolicy(i_overflowPolicy)
+{
+    // Ring has to hold at least the longest message.
+    const size_t l_slotCount =
+        std::bit_ceil(std::max(i_slotCount, MAX_SLOTS_PER_MESSAGE));
+
+    m_slots = std::make_unique<Slot[]>(l_slotCount);
+    m_mask = l_slotCount - 1;
+
+    for (size_t l_position = 0; l_position < l_slotCount; ++l_position)
+    {
+        m_slots[l_position].m_sequence.store(l_position,
+                                             std::memory_order_relaxed);
+    }
+}
+
+void LogRingBuffer::push(
+    std::string_view i_message,
+    const std::chrono::system_clock::time_point i_time) noexcept
+{
+    const size_t l_length =
+        std::min(i_message.size(), MAX_SLOTS_PER_MESSAGE * SLOT_PAYLOAD_SIZE);
+    const auto l_slotCount = static_cast<uint32_t>(std::max<size_t>(
+        1, (l_length + SLOT_PAYLOAD_SIZE - 1) / SLOT_PAYLOAD_SIZE));
+
+    uint64_t l_position = m_tail.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // Read before checking the slots, so that a release after the check
+        // is not missed by a blocked producer.
+        const uint32_t l_releaseCount =
+            m_releaseCount.load(std::memory_order_acquire);
+
+        bool l_isFull = false;
+        bool l_isStale = false;
+        for (uint32_t l_index = 0; l_index < l_slotCount; ++l_index)
+        {
+            const uint64_t l_sequence =
+                getSlot(l_position + l_index)
+                    .m_sequence.load(std::memory_order_acquire);
+            const auto l_diff =
+                static_cast<int64_t>(l_sequence - (l_position + l_index));
+
+            if (l_diff < 0)
+            {
+                // Slot still holds a message of previous round.
+                l_isFull = true;
+                break;
+            }
+
+            if (l_diff > 0)
+            {
+                // Slot is already claimed by another producer.
+                l_isStale = true;
+                break;
+            }
+        }
+
+        if (l_isStale)
+        {
+            l_position = m_tail.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!l_isFull)
+        {
+            if (m_tail.compare_exchange_weak(l_position,
+                                             l_position + l_slotCount,
+                                             std::memory_order_relaxed))
+            {
+                break;
+            }
+            continue;
+        }
+
+        if (m_overflowPolicy == LogOverflowPolicy::DROP_OLDEST)
+        {
+            if (!dropOldest())
+            {
+                // Oldest message is still being written.
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            // Wait returns at once if anything got released after the count
+            // was read, else the next release wakes it up.
+            m_hasBlockedProducers.store(true, std::memory_order_seq_cst);
+            m_releaseCount.wait(l_releaseCount, std::memory_order_seq_cst);
+        }
+
+        l_position = m_tail.load(std::memory_order_relaxed);
+    }
+
+    Slot& l_firstSlot = getSlot(l_position);
+    l_firstSlot.m_length = static_cast<uint32_t>(l_length);
+    l_firstSlot.m_time = i_time.time_since_epoch().count();
+    l_firstSlot.m_slotCount.store(l_slotCount, std::memory_order_relaxed);
+
+    size_t l_offset = 0;
+    for (uint32_t l_index = 0; l_index < l_slotCount; ++l_index)
+    {
+        Slot& l_slot = getSlot(l_position + l_index);
+
+        const size_t l_chunkSize =
+            std::min(l_length - l_offset, SLOT_PAYLOAD_SIZE);
+        std::memcpy(l_slot.m_payload, i_message.data() + l_offset,
+                    l_chunkSize);
+        l_offset += l_chunkSize;
+
+        l_slot.m_sequence.store(l_position + l_index + 1,
+                                std::memory_order_release);
+    }
+}
+
+bool LogRingBuffer::isMessageReady(const uint64_t i_position,
+                                   uint32_t& o_slotCount) noexcept
+{
+    if (getSlot(i_position).m_sequence.load(std::memory_order_acquire) !=
+        i_position + 1)
+    {
+        return false;
+    }
+
+    // Can be of a newer message if the slot got reused meanwhile, caller's
+    // CAS on head fails in that case.
+    o_slotCount = getSlot(i_position).m_slotCount.load(
+        std::memory_order_relaxed);
+    if (o_slotCount == 0 || o_slotCount > MAX_SLOTS_PER_MESSAGE)
+    {
+        return false;
+    }
+
+    for (uint32_t l_index = 1; l_index < o_slotCount; ++l_index)
+    {
+        if (getSlot(i_position + l_index)
+                .m_sequence.load(std::memory_order_acquire) !=
+            i_position + l_index + 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void LogRingBuffer::releaseSlots(const uint64_t i_position,
+                                 const uint32_t i_slotCount) noexcept
+{
+    for (uint32_t l_index = 0; l_index < i_slotCount; ++l_index)
+    {
+        getSlot(i_position + l_index)
+            .m_sequence.store(i_position + l_index + m_mask + 1,
+                              std::memory_order_release);
+    }
+
+    m_releaseCount.fetch_add(1, std::memory_order_seq_cst);
+
+    // Wake blocked producers once, not on every release while they are yet
+    // to run.
+    if (m_overflowPolicy == LogOverflowPolicy::BLOCK &&
+        m_hasBlockedProducers.exchange(false, std::memory_order_seq_cst))
+    {
+        m_releaseCount.notify_all();
+    }
+}
+
+bool LogRingBuffer::dropOldest() noexcept
+{
+    uint64_t l_head = m_head.load(std::memory_order_acquire);
+
+    uint32_t l_slotCount = 0;
+    if (!isMessageReady(l_head, l_slotCount))
+    {
+        return false;
+    }
+
+    // Consumer or another producer may claim the same message.
+    if (!m_head.compare_exchange_strong(l_head, l_head + l_slotCount,
+                                        std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    releaseSlots(l_head, l_slotCount);
+    m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool LogRingBuffer::pop(std::string& o_message,
+                        std::chrono::system_clock::time_point& o_time)
+{
+    // Reserve before claiming, so that claimed slots are always released.
+    o_message.reserve(MAX_SLOTS_PER_MESSAGE * SLOT_PAYLOAD_SIZE);
+
+    while (true)
+    {
+        uint64_t l_head = m_head.load(std::memory_order_acquire);
+        if (l_head == m_tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        uint32_t l_slotCount = 0;
+        if (!isMessageReady(l_head, l_slotCount))
+        {
+            if (m_head.load(std::memory_order_acquire) != l_head)
+            {
+                // Dropped by a producer meanwhile.
+                continue;
+            }
+
+            // Oldest message is still being written.
+            return false;
+        }
+
+        if (!m_head.compare_exchange_strong(l_head, l_head + l_slotCount,
+                                            std::memory_order_acq_rel))
+        {
+            continue;
+        }
+
+        const Slot& l_firstSlot = getSlot(l_head);
+        o_time = std::chrono::system_clock::time_point(
+            std::chrono::system_clock::duration(l_firstSlot.m_time));
+
+        o_message.clear();
+        size_t l_remaining = l_firstSlot.m_length;
+        for (uint32_t l_index = 0; l_index < l_slotCount; ++l_index)
+        {
+            const size_t l_chunkSize =
+                std::min(l_remaining, SLOT_PAYLOAD_SIZE);
+            o_message.append(getSlot(l_head + l_index).m_payload,
+                             l_chunkSize);
+            l_remaining -= l_chunkSize;
+        }
+
+        releaseSlots(l_head, l_slotCount);
+        return true;
+    }
+}
+} // namespace vpd
@@ -1,10 +1,20 @@
+#include "config.h"
+
 #include "logger.hpp"
 
+#include <unistd.h>
+
 #include <utility/event_logger_utility.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <format>
 #include <print>
 #include <regex>
 #include <sstream>
+#include <utility>
 
 namespace vpd
 {
@@ -15,9 +25,13 @@ void Logger::logMessage(std::string_view i_message,
                         std::optional<const types::PelInfoTuple> i_pelTuple,
                         const std::source_location& i_location) noexcept
 {
-    std::ostringstream l_log;
-    l_log << "FileName: " << i_location.file_name() << ","
-          << " Line: " << i_location.line() << " " << i_message;
+    // message is formatted only by the endpoints which need a string
+    const auto l_log = [&i_message, &i_location]() {
+        std::ostringstream l_logStream;
+        l_logStream << "FileName: " << i_location.file_name() << ","
+                    << " Line: " << i_location.line() << " " << i_message;
+        return l_logStream.str();
+    };
 
     try
     {
@@ -27,23 +41,37 @@ void Logger::logMessage(std::string_view i_message,
             if (m_collectionLogger.get() == nullptr)
             {
                 initiateVpdCollectionLogging();
+            }
 
-                if (m_collectionLogger.get() != nullptr)
-                {
-                    // Log it to a specific place.
-                    m_collectionLogger->logMessage(l_log.str());
-                }
-                else
-                {
-                    std::cout << l_log.str() << std::endl;
-                }
+            if (m_collectionLogger.get() == nullptr)
+            {
+                std::cout << l_log() << std::endl;
+            }
+            else if (m_isBinaryCollectionLog)
+            {
+                writeCollectionRecords(
+                    collectionLog::Event::TEXT,
+                    getStringIndex(i_location.file_name()), 0,
+                    i_location.line(), i_message);
             }
             else
             {
-                m_collectionLogger->logMessage(l_log.str());
+                // format on stack, so that logging collection messages from
+                // parallel collection threads doesn't allocate
+                std::array<char, LogRingBuffer::MAX_SLOTS_PER_MESSAGE *
+                                     LogRingBuffer::SLOT_PAYLOAD_SIZE>
+                    l_buffer;
+                const auto l_result = std::format_to_n(
+                    l_buffer.data(), l_buffer.size(), "FileName: {}, Line: {} {}",
+                    i_location.file_name(), i_location.line(), i_message);
+
+                m_collectionLogger->logMessage(std::string_view(
+                    l_buffer.data(),
+                    std::min(static_cast<size_t>(l_result.size),
+                             l_buffer.size())));
             }
 #else
-            std::cout << l_log.str() << std::endl;
+            std::cout << l_log() << std::endl;
 #endif
         }
         else if (i_placeHolder == PlaceHolder::PEL)
@@ -65,7 +93,7 @@ void Logger::logMessage(std::string_view i_message,
                 return;
             }
             std::cout << "Pel info tuple required to log PEL for message <" +
-                             l_log.str() + ">"
+                             l_log() + ">"
                       << std::endl;
         }
         else if (i_placeHolder == PlaceHolder::VPD_WRITE)
@@ -75,7 +103,7 @@ void Logger::logMessage(std::string_view i_message,
                 m_vpdWriteLogger.reset(
                     new SyncFileLogger("/var/lib/vpd/vpdWrite.log", 128));
             }
-            m_vpdWriteLogger->logMessage(l_log.str());
+            m_vpdWriteLogger->logMessage(l_log());
         }
         else if (i_placeHolder == PlaceHolder::ASYNC_PEL)
         {
@@ -98,7 +126,7 @@ void Logger::logMessage(std::string_view i_message,
 
             std::println(
                 "Pel info tuple required to log async PEL for message {}",
-                l_log.str());
+                l_log());
         }
         else if (i_placeHolder == PlaceHolder::ASYNC_PEL_WITH_INV_CALLOUT)
         {
@@ -134,7 +162,7 @@ void Logger::logMessage(std::string_view i_message,
 
             std::println(
                 "Pel info tuple required to log async PEL with inventory callouts for message {}",
-                l_log.str());
+                l_log());
         }
         else if (i_placeHolder == PlaceHolder::ASYNC_PEL_WITH_DEVICE_CALLOUT)
         {
@@ -169,7 +197,7 @@ void Logger::logMessage(std::string_view i_message,
 
             std::println(
                 "Pel info tuple required to log async PEL with device callouts for message {}",
-                l_log.str());
+                l_log());
         }
         else if (i_placeHolder == PlaceHolder::SYNC_PEL_WITH_DEVICE_CALLOUT)
         {
@@ -205,23 +233,189 @@ void Logger::logMessage(std::string_view i_message,
 
             std::println(
                 "Pel info tuple required to log sync PEL with device callouts for message {}",
-                l_log.str());
+                l_log());
         }
         else
         {
             // Default case, let it go to journal.
-            std::cout << l_log.str() << std::endl;
+            std::cout << l_log() << std::endl;
         }
     }
     catch (const std::exception& l_ex)
     {
-        std::cout << "Failed to log message:[" + l_log.str() +
+        std::cout << "Failed to log message:[" + l_log() +
                          "]. Error: " + std::string(l_ex.what())
                   << std::endl;
     }
 }
 
+void Logger::logEvent(const collectionLog::Event i_event,
+                      std::string_view i_fruPath, const int32_t i_errorCode,
+                      const uint32_t i_value, std::string_view i_payload,
+                      const std::source_location& i_location) noexcept
+{
+    try
+    {
+#ifdef ENABLE_FILE_LOGGING
+        if (m_isBinaryCollectionLog)
+        {
+            if (m_collectionLogger.get() == nullptr)
+            {
+                initiateVpdCollectionLogging();
+            }
+
+            if (m_collectionLogger.get() != nullptr)
+            {
+                writeCollectionRecords(i_event, getStringIndex(i_fruPath),
+                                       i_errorCode, i_value, i_payload);
+                return;
+            }
+        }
+#endif
+        const auto l_descriptor =
+            collectionLog::getEventDescriptor(std::to_underlying(i_event));
+        if (l_descriptor == nullptr)
+        {
+            throw std::runtime_error(
+                "Unknown event " + std::to_string(std::to_underlying(i_event)));
+        }
+
+        logMessage(collectionLog::formatEventMessage(*l_descriptor, i_fruPath,
+                                                     i_errorCode, i_value,
+                                                     i_payload),
+                   PlaceHolder::COLLECTION, std::nullopt, i_location);
+    }
+    catch (const std::exception& l_ex)
+    {
+        std::cout << "Failed to log event of FRU [" << i_fruPath
+                  << "]. Error: " << l_ex.what() << std::endl;
+    }
+}
+
 #ifdef ENABLE_FILE_LOGGING
+bool Logger::isBinaryCollectionLogRequested() noexcept
+{
+    // Environment takes precedence over the build time default.
+    if (const char* l_binaryLogEnv = std::getenv("VPD_BINARY_COLLECTION_LOG");
+        l_binaryLogEnv != nullptr)
+    {
+        return std::string_view(l_binaryLogEnv) == "1";
+    }
+
+    return VPD_BINARY_COLLECTION_LOG != 0;
+}
+
+LogOverflowPolicy Logger::getCollectionLogOverflowPolicy() noexcept
+{
+    // Environment takes precedence over the build time default.
+    if (const char* l_overflowEnv = std::getenv("VPD_COLLECTION_LOG_OVERFLOW");
+        l_overflowEnv != nullptr)
+    {
+        const std::string_view l_overflow{l_overflowEnv};
+        if (l_overflow == "drop_oldest")
+        {
+            return LogOverflowPolicy::DROP_OLDEST;
+        }
+        if (l_overflow == "block")
+        {
+            return LogOverflowPolicy::BLOCK;
+        }
+
+        std::cout << "Ignoring invalid VPD_COLLECTION_LOG_OVERFLOW value ["
+                  << l_overflow << "]." << std::endl;
+    }
+
+    return VPD_COLLECTION_LOG_DROP_OLDEST != 0 ? LogOverflowPolicy::DROP_OLDEST
+                                               : LogOverflowPolicy::BLOCK;
+}
+
+uint16_t Logger::getStringIndex(std::string_view i_string) noexcept
+{
+    if (i_string.empty())
+    {
+        return collectionLog::NO_STRING_INDEX;
+    }
+
+    try
+    {
+        {
+            std::shared_lock l_lock(m_stringTableMutex);
+            if (const auto l_itr = m_stringTable.find(i_string);
+                l_itr != m_stringTable.end())
+            {
+                return l_itr->second;
+            }
+        }
+
+        std::unique_lock l_lock(m_stringTableMutex);
+        if (const auto l_itr = m_stringTable.find(i_string);
+            l_itr != m_stringTable.end())
+        {
+            return l_itr->second;
+        }
+
+        if (m_stringTable.size() >= collectionLog::NO_STRING_INDEX)
+        {
+            return collectionLog::NO_STRING_INDEX;
+        }
+
+        const auto l_index = static_cast<uint16_t>(m_stringTable.size());
+        m_stringTable.emplace(i_string, l_index);
+
+        // Definition is written under the lock, so that it precedes in the
+        // ring any record using the index.
+        writeCollectionRecords(collectionLog::Event::STRING_DEFINITION,
+                               l_index, 0, l_index, i_string);
+        return l_index;
+    }
+    catch (const std::exception& l_ex)
+    {
+        return collectionLog::NO_STRING_INDEX;
+    }
+}
+
+void Logger::writeCollectionRecords(const collectionLog::Event i_event,
+                                    const uint16_t i_fruIndex,
+                                    const int32_t i_errorCode,
+                                    const uint32_t i_value,
+                                    std::string_view i_payload) noexcept
+{
+    // id of the calling thread, fetched once per thread
+    thread_local const auto l_threadId = static_cast<uint32_t>(gettid());
+
+    collectionLog::Record l_record;
+    l_record.m_timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    l_record.m_threadId = l_threadId;
+    l_record.m_event = std::to_underlying(i_event);
+    l_record.m_fruIndex = i_fruIndex;
+    l_record.m_errorCode = i_errorCode;
+    l_record.m_value = i_value;
+
+    i_payload = i_payload.substr(
+        0, collectionLog::MAX_RECORDS_PER_PAYLOAD *
+               collectionLog::RECORD_PAYLOAD_SIZE);
+
+    // record of an empty payload is written too
+    size_t l_offset = 0;
+    do
+    {
+        const size_t l_chunkSize = std::min(i_payload.size() - l_offset,
+                                            collectionLog::RECORD_PAYLOAD_SIZE);
+        std::memcpy(l_record.m_payload.data(), i_payload.data() + l_offset,
+                    l_chunkSize);
+        l_record.m_payloadLength = static_cast<uint8_t>(l_chunkSize);
+        l_offset += l_chunkSize;
+        l_record.m_flags =
+            l_offset < i_payload.size() ? collectionLog::FLAG_CONTINUED : 0;
+
+        m_collectionLogger->logMessage(std::string_view(
+            reinterpret_cast<const char*>(&l_record), sizeof(l_record)));
+    } while (l_offset < i_payload.size());
+}
+
 void Logger::initiateVpdCollectionLogging() noexcept
 {
     try
@@ -256,8 +450,10 @@ void Logger::initiateVpdCollectionLogging() noexcept
         for (const auto& l_dirEntry :
              std::filesystem::directory_iterator(l_collectionLogDirectory))
         {
-            // check /var/lib/vpd for number "collection.*" log file
-            const std::regex l_collectionLogFileRegex{"collection.*\\.log"};
+            // check /var/lib/vpd for number "collection.*" log file, text or
+            // binary
+            const std::regex l_collectionLogFileRegex{
+                "collection.*\\.(log|bin)"};
 
             if (std::filesystem::is_regular_file(l_dirEntry.path()) &&
                 std::regex_match(l_dirEntry.path().filename().string(),
@@ -281,6 +477,9 @@ void Logger::initiateVpdCollectionLogging() noexcept
         // maximum number of collection log files to maintain
         constexpr auto l_maxCollectionLogFiles{3};
 
+        const std::string l_extension{m_isBinaryCollectionLog ? ".bin"
+                                                              : ".log"};
+
         if (l_collectionLogFileCount >= l_maxCollectionLogFiles)
         {
             // delete oldest collection log file
@@ -296,16 +495,42 @@ void Logger::initiateVpdCollectionLogging() noexcept
                            l_collectionLogFilePath.string() +
                            " Error: " + l_ec.message());
             }
+
+            // format may have changed since the oldest file was written
+            l_collectionLogFilePath.replace_extension(l_extension);
         }
         else
         {
             l_collectionLogFilePath +=
-                "_" + std::to_string(l_collectionLogFileCount) + ".log";
+                "_" + std::to_string(l_collectionLogFileCount) + l_extension;
+        }
+
+        if (m_isBinaryCollectionLog)
+        {
+            // strings are defined afresh in every file
+            std::unique_lock l_lock(m_stringTableMutex);
+            m_stringTable.clear();
         }
 
         // create collection logger object with collection_(n+1).log
-        m_collectionLogger.reset(
-            new AsyncFileLogger(l_collectionLogFilePath, 4096));
+        std::unique_ptr<ILogFileHandler> l_collectionLogger(
+            new AsyncFileLogger(l_collectionLogFilePath, 4096,
+                                m_isBinaryCollectionLog ? LogFileFormat::BINARY
+                                                        : LogFileFormat::TEXT,
+                                m_collectionLogOverflowPolicy));
+
+        // header goes first, before any other thread can log to the file
+        if (m_isBinaryCollectionLog)
+        {
+            collectionLog::FileHeader l_fileHeader;
+            l_fileHeader.m_recordSize = sizeof(collectionLog::Record);
+
+            l_collectionLogger->logMessage(std::string_view(
+                reinterpret_cast<const char*>(&l_fileHeader),
+                sizeof(l_fileHeader)));
+        }
+
+        m_collectionLogger = std::move(l_collectionLogger);
     }
     catch (const std::exception& l_ex)
     {
@@ -355,74 +580,107 @@ void SyncFileLogger::logMessage(const std::string_view& i_message)
 
 void AsyncFileLogger::logMessage(const std::string_view& i_message)
 {
-    try
-    {
-        // acquire lock on queue
-        std::unique_lock<std::mutex> l_lock(m_mutex);
-
-        // push message to queue
-        m_messageQueue.emplace(timestamp() + " : " + std::string(i_message));
+    // push message to ring, no lock or allocation needed
+    m_ringBuffer.push(i_message, std::chrono::system_clock::now());
 
-        // notify log worker thread
-        m_cv.notify_one();
-    }
-    catch (const std::exception& l_ex)
+    // notify log worker thread if it is idle. A notification missed in a race
+    // only delays the write till flush interval.
+    if (m_isWorkerWaiting.load(std::memory_order_acquire))
     {
-        // log message to journal if we fail to push message to queue
-        Logger::getLoggerInstance()->logMessage(i_message);
+        m_cv.notify_one();
     }
 }
 
 void AsyncFileLogger::fileWorker() noexcept
 {
-    // create lock object on mutex
-    std::unique_lock<std::mutex> l_lock(m_mutex);
+    // buffers reused across batches
+    std::string l_message;
+    std::string l_batch;
+    std::chrono::system_clock::time_point l_time;
+
+    // timestamp is formatted once for messages logged in the same millisecond
+    std::string l_timestamp;
+    std::chrono::milliseconds l_timestampMs{-1};
 
     // infinite loop
     while (true)
     {
-        // check for exit conditions
-        if (!m_fileStream.is_open() || m_stopLogging)
-        {
-            break;
-        }
-
-        // wait for notification from log producer
-        m_cv.wait(l_lock,
-                  [this] { return m_stopLogging || !m_messageQueue.empty(); });
-
-        // flush the queue
-        while (!m_messageQueue.empty())
+        size_t l_messageCount{0};
+        try
         {
-            // read the first message in queue
-            const auto l_logMessage = m_messageQueue.front();
-            try
+            // drain the ring, a batch is bounded by ring size so that the
+            // worker keeps pace with producers
+            while (l_messageCount < m_ringBuffer.getSlotCount() &&
+                   m_ringBuffer.pop(l_message, l_time))
             {
-                // pop the message from queue
-                m_messageQueue.pop();
+                ++l_messageCount;
 
-                // unlock mutex on queue
-                l_lock.unlock();
+                if (m_fileFormat == LogFileFormat::BINARY)
+                {
+                    l_batch.append(l_message);
+                    continue;
+                }
 
-                // flush the message to file
-                m_fileStream << l_logMessage << std::endl;
+                const auto l_ms =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        l_time.time_since_epoch());
+                if (l_ms != l_timestampMs)
+                {
+                    l_timestamp = timestamp(l_time);
+                    l_timestampMs = l_ms;
+                }
 
-                // lock mutex on queue
-                l_lock.lock();
+                l_batch.append(l_timestamp)
+                    .append(" : ")
+                    .append(l_message)
+                    .push_back('\n');
             }
-            catch (const std::exception& l_ex)
-            {
-                // log message to journal if we fail to push message to queue
-                Logger::getLoggerInstance()->logMessage(l_logMessage);
 
-                // check if we need to reacquire lock before continuing to flush
-                // queue
-                if (!l_lock.owns_lock())
-                {
-                    l_lock.lock();
-                }
+            if (!l_batch.empty())
+            {
+                // single flush for the whole batch
+                m_fileStream.write(l_batch.data(),
+                                   static_cast<std::streamsize>(l_batch.size()));
+                m_fileStream.flush();
             }
-        } // queue flush loop
+        }
+        catch (const std::exception& l_ex)
+        {
+            // log batch to journal if we fail to write it to file, binary
+            // batch is of no use there
+            Logger::getLoggerInstance()->logMessage(
+                m_fileFormat == LogFileFormat::BINARY
+                    ? "Failed to write " + std::to_string(l_batch.size()) +
+                          " bytes of binary log to " + m_filePath.string()
+                    : l_batch);
+        }
+        l_batch.clear();
+
+        if (l_messageCount != 0)
+        {
+            continue;
+        }
+
+        // check for exit condition, all buffered messages are written by now
+        if (m_stopLogging && m_ringBuffer.isEmpty())
+        {
+            break;
+        }
+
+        if (!m_ringBuffer.isEmpty())
+        {
+            // a producer is still copying its message in
+            std::this_thread::yield();
+            continue;
+        }
+
+        // wait for notification from log producer or flush interval
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_isWorkerWaiting.store(true, std::memory_order_release);
+        m_cv.wait_for(l_lock, FLUSH_INTERVAL, [this] {
+            return m_stopLogging || !m_ringBuffer.isEmpty();
+        });
+        m_isWorkerWaiting.store(false, std::memory_order_release);
     } // thread loop
 }
 
@@ -2,9 +2,13 @@
 
 #include "manager.hpp"
 
+#include "collection_tracer.hpp"
 #include "constants.hpp"
+#include "eeprom_fingerprint_store.hpp"
 #include "exceptions.hpp"
 #include "gpio_monitor.hpp"
+#include "ipz_parser.hpp"
+#include "parsed_vpd_cache.hpp"
 #include "parser.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
@@ -18,6 +22,7 @@
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
+#include <algorithm>
 #include <format>
 
 namespace vpd
@@ -52,6 +57,14 @@ Manager::Manager(
                 return this->updateKeyword(i_vpdPath, i_paramsToWriteData);
             });
 
+        iFace->register_method(
+            "UpdateKeywords",
+            [this](const types::Path i_vpdPath,
+                   const std::vector<types::IpzData> i_keywordsToUpdate)
+                -> int {
+                return this->updateKeywords(i_vpdPath, i_keywordsToUpdate);
+            });
+
         iFace->register_method(
             "WriteKeywordOnHardware",
             [this](const types::Path i_fruPath,
@@ -134,6 +147,14 @@ Manager::Manager(
                 return this->getParsedVpd(i_fruPath);
             });
 
+        // Trace phases of the next all FRU VPD collections to
+        // constants::collectionTraceFile, for offline analysis.
+        iFace->register_method(
+            "SetCollectionTraceEnabled", [](const bool i_isEnabled) {
+                CollectionTracer::getTracerInstance()->setRequested(
+                    i_isEnabled);
+            });
+
         // Indicates FRU VPD collection for the system has not started.
         progressiFace->register_property_rw<std::string>(
             "Status", sdbusplus::vtable::property_::emits_change,
@@ -143,6 +164,39 @@ Manager::Manager(
             },
             [this](const auto&) { return m_vpdCollectionStatus; });
 
+        // Parsed VPD cache statistics, to help tune readers polling VPD.
+        progressiFace->register_property_r<uint64_t>(
+            "ParsedVpdCacheHits", sdbusplus::vtable::property_::none,
+            [](const auto&) {
+                return ParsedVpdCache::getCacheInstance()->getHitCount();
+            });
+
+        progressiFace->register_property_r<uint64_t>(
+            "ParsedVpdCacheMisses", sdbusplus::vtable::property_::none,
+            [](const auto&) {
+                return ParsedVpdCache::getCacheInstance()->getMissCount();
+            });
+
+        // Outcome of the last VPD recollection, FRUs whose EEPROM fingerprint
+        // was unchanged are skipped.
+        progressiFace->register_property_r<uint64_t>(
+            "RecollectionSkippedFrus", sdbusplus::vtable::property_::none,
+            [](const auto&) {
+                return EepromFingerprintStore::getStoreInstance()
+                    ->getSkippedCount();
+            });
+
+        progressiFace->register_property_r<uint64_t>(
+            "RecollectionProcessedFrus", sdbusplus::vtable::property_::none,
+            [](const auto&) {
+                return EepromFingerprintStore::getStoreInstance()
+                    ->getProcessedCount();
+            });
+
+        // Location codes get indexed as they are published, so this has to
+        // be done before any collection starts.
+        registerLocationCodeCallbacks();
+
         ConfigManager::ManagerPassKey l_configMgrKey;
 
         // initialize ConfigManager with the default JSON so that any
@@ -229,37 +283,17 @@ void Manager::readVpdCollectionMode() noexcept
     }
 }
 
-int Manager::updateKeyword(const types::Path i_vpdPath,
-                           const types::WriteVpdParams i_paramsToWriteData)
+types::Path Manager::getFruPathToUpdate(
+    const types::Path& i_vpdPath,
+    const nlohmann::json& i_sysCfgJsonObj) const noexcept
 {
-    if (i_vpdPath.empty())
-    {
-        throw types::DbusInvalidArgument();
-    }
-
     uint16_t l_errCode = 0;
     types::Path l_fruPath;
-    nlohmann::json l_sysCfgJsonObj{};
 
-    if (m_configManager)
+    // Get the EEPROM path
+    if (!i_sysCfgJsonObj.empty())
     {
-        const auto l_jsonResult = m_configManager->getJsonObj(i_vpdPath);
-        if (l_jsonResult.has_value())
-        {
-            l_sysCfgJsonObj = l_jsonResult.value().get();
-        }
-        else
-        {
-            m_logger->logMessage(std::format(
-                "JSON not found for path {}.{}", i_vpdPath,
-                commonUtility::getErrCodeMsg(l_jsonResult.error())));
-        }
-
-        // Get the EEPROM path
-        if (!l_sysCfgJsonObj.empty())
-        {
-            l_fruPath = jsonUtility::getFruPathFromJson(i_vpdPath, l_errCode);
-        }
+        l_fruPath = jsonUtility::getFruPathFromJson(i_vpdPath, l_errCode);
     }
 
     if (l_fruPath.empty())
@@ -274,6 +308,23 @@ int Manager::updateKeyword(const types::Path i_vpdPath,
         l_fruPath = i_vpdPath;
     }
 
+    return l_fruPath;
+}
+
+int Manager::updateKeyword(const types::Path i_vpdPath,
+                           const types::WriteVpdParams i_paramsToWriteData)
+{
+    if (i_vpdPath.empty())
+    {
+        throw types::DbusInvalidArgument();
+    }
+
+    uint16_t l_errCode = 0;
+    const types::JsonSnapshot l_sysCfgJson = getConfigJson(i_vpdPath);
+    const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJson;
+    const types::Path l_fruPath =
+        getFruPathToUpdate(i_vpdPath, l_sysCfgJsonObj);
+
     try
     {
         std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
@@ -364,35 +415,82 @@ int Manager::updateKeyword(const types::Path i_vpdPath,
     }
 }
 
-int Manager::updateKeywordOnHardware(
-    const types::Path i_fruPath,
-    const types::WriteVpdParams i_paramsToWriteData)
+int Manager::updateKeywords(
+    const types::Path i_vpdPath,
+    const std::vector<types::IpzData> i_keywordsToUpdate)
 {
-    if (i_fruPath.empty())
+    if (i_vpdPath.empty() || i_keywordsToUpdate.empty())
     {
         throw types::DbusInvalidArgument();
     }
 
+    uint16_t l_errCode = 0;
+    const types::JsonSnapshot l_sysCfgJson = getConfigJson(i_vpdPath);
+    const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJson;
+    const types::Path l_fruPath =
+        getFruPathToUpdate(i_vpdPath, l_sysCfgJsonObj);
+
     try
     {
-        nlohmann::json l_sysCfgJsonObj{};
+        std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
+            l_fruPath, l_sysCfgJsonObj, m_vpdCollectionMode);
 
-        if (m_configManager)
-        {
-            const auto l_jsonResult = m_configManager->getJsonObj(i_fruPath);
+        auto l_rc = l_parserObj->updateVpdKeywords(i_keywordsToUpdate);
 
-            if (l_jsonResult.has_value())
-            {
-                l_sysCfgJsonObj = l_jsonResult.value().get();
-            }
-            else
+        if (l_rc != constants::FAILURE && m_backupAndRestoreObj)
+        {
+            if (m_backupAndRestoreObj->updateKeywordsOnPrimaryOrBackupPath(
+                    l_fruPath, i_keywordsToUpdate) < constants::VALUE_0)
             {
-                m_logger->logMessage(std::format(
-                    "JSON not found for path {}. {}", i_fruPath,
-                    commonUtility::getErrCodeMsg(l_jsonResult.error())));
+                m_logger->logMessage(
+                    "Write success, but backup and restore failed for file[" +
+                    l_fruPath + "]");
             }
         }
 
+        for (const auto& l_keywordToUpdate : i_keywordsToUpdate)
+        {
+            m_logger->logMessage(
+                "VPD write " +
+                    std::string((l_rc != constants::FAILURE) ? "successful"
+                                                             : "failed") +
+                    " on path[" + i_vpdPath + "] : " +
+                    vpdSpecificUtility::convertWriteVpdParamsToString(
+                        l_keywordToUpdate, l_errCode),
+                PlaceHolder::VPD_WRITE);
+        }
+
+        return l_rc;
+    }
+    catch (const std::exception& l_exception)
+    {
+        m_logger->logMessage(
+            std::string("Update keywords failed for file[") + i_vpdPath +
+                "], reason:" + std::string(l_exception.what()),
+            PlaceHolder::PEL,
+            types::PelInfoTuple{EventLogger::getErrorType(l_exception),
+                                types::SeverityType::Error, 0, std::nullopt,
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt});
+
+        return -1;
+    }
+}
+
+int Manager::updateKeywordOnHardware(
+    const types::Path i_fruPath,
+    const types::WriteVpdParams i_paramsToWriteData)
+{
+    if (i_fruPath.empty())
+    {
+        throw types::DbusInvalidArgument();
+    }
+
+    try
+    {
+        const types::JsonSnapshot l_sysCfgJson = getConfigJson(i_fruPath);
+        const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJson;
+
         std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
             i_fruPath, l_sysCfgJsonObj, m_vpdCollectionMode);
         return l_parserObj->updateVpdKeywordOnHardware(i_paramsToWriteData);
@@ -422,22 +520,8 @@ types::DbusVariantType Manager::readKeyword(
 
     try
     {
-        nlohmann::json l_jsonObj{};
-
-        if (m_configManager)
-        {
-            const auto l_jsonResult = m_configManager->getJsonObj(i_fruPath);
-            if (l_jsonResult.has_value())
-            {
-                l_jsonObj = l_jsonResult.value().get();
-            }
-            else
-            {
-                m_logger->logMessage(std::format(
-                    "JSON not found for path {}. {}", i_fruPath,
-                    commonUtility::getErrCodeMsg(l_jsonResult.error())));
-            }
-        }
+        const types::JsonSnapshot l_configJson = getConfigJson(i_fruPath);
+        const nlohmann::json& l_jsonObj = *l_configJson;
 
         std::error_code ec;
 
@@ -612,18 +696,28 @@ std::string Manager::getExpandedLocationCode(
 
     /*
         - select one inventory path
-        - use selected inventory path to get expanded location code from D-Bus
+        - get expanded location code of selected inventory path from index,
+          read it from D-Bus if not indexed yet
     */
+    const std::string l_inventoryPath{l_inventoryPathsResult.value().at(0)};
+
+    if (auto l_expandedLocationCode =
+            m_locationCodeIndex->getLocationCode(l_inventoryPath))
+    {
+        return *l_expandedLocationCode;
+    }
 
     auto l_dbusReadRes = dbusUtility::readDbusProperty(
-        constants::pimServiceName, l_inventoryPathsResult.value().at(0),
-        constants::locationCodeInf, "LocationCode");
+        constants::pimServiceName, l_inventoryPath, constants::locationCodeInf,
+        "LocationCode");
 
     const auto l_expandedLocationCodeRes =
         std::get_if<std::string>(&l_dbusReadRes);
 
     if (l_expandedLocationCodeRes)
     {
+        m_locationCodeIndex->update(l_inventoryPath,
+                                    *l_expandedLocationCodeRes);
         return *l_expandedLocationCodeRes;
     }
 
@@ -888,8 +982,26 @@ types::ListOfPaths Manager::getFrusByExpandedLocationCode(
         throw types::DbusInvalidArgument();
     }
 
-    types::ListOfPaths l_fruPaths;
+    if (!m_isLocationCodeIndexSeeded)
+    {
+        seedLocationCodeIndex();
+    }
+
+    types::ListOfPaths l_fruPaths =
+        m_locationCodeIndex->getInventoryPaths(i_expandedLocationCode);
+
+    if (l_fruPaths.empty())
+    {
+        m_logger->logMessage(
+            std::format("No FRUs found for expanded location code: {}",
+                        i_expandedLocationCode));
+    }
+
+    return l_fruPaths;
+}
 
+void Manager::seedLocationCodeIndex() noexcept
+{
     try
     {
         const auto l_managedObjectsResult = dbusUtility::getManagedObjects(
@@ -900,56 +1012,131 @@ types::ListOfPaths Manager::getFrusByExpandedLocationCode(
             if (l_managedObjectsResult.error() != error_code::DBUS_FAILURE)
             {
                 m_logger->logMessage(std::format(
-                    "Failed to get managed objects for expanded location code {}: Error{}",
-                    i_expandedLocationCode,
+                    "Failed to get managed objects to seed location code index: Error{}",
                     commonUtility::getErrCodeMsg(
                         l_managedObjectsResult.error())));
             }
-            return l_fruPaths;
+            return;
         }
 
-        const auto& l_managedObjects = l_managedObjectsResult.value();
-
-        for (const auto& [l_objPath, l_interfaceMap] : l_managedObjects)
+        for (const auto& [l_objPath, l_interfaceMap] :
+             l_managedObjectsResult.value())
         {
-            auto l_locCodeIntfIter =
-                l_interfaceMap.find(constants::locationCodeInf);
-            if (l_locCodeIntfIter == l_interfaceMap.end())
-            {
-                continue;
-            }
+            m_locationCodeIndex->update(l_objPath.str, l_interfaceMap);
+        }
 
-            const auto& l_propertyMap = l_locCodeIntfIter->second;
-            auto l_locCodePropIter = l_propertyMap.find("LocationCode");
-            if (l_locCodePropIter == l_propertyMap.end())
-            {
-                continue;
-            }
+        m_isLocationCodeIndexSeeded = true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(std::format(
+            "Unexpected error occurred while seeding location code index: Error{}",
+            l_ex.what()));
+    }
+}
 
-            // Check if the location code matches
-            if (const auto l_locCode =
-                    std::get_if<std::string>(&l_locCodePropIter->second);
-                l_locCode && *l_locCode == i_expandedLocationCode)
-            {
-                l_fruPaths.emplace_back(l_objPath);
-            }
-        }
+void Manager::registerLocationCodeCallbacks() noexcept
+{
+    try
+    {
+        dbusUtility::getPublishObserver() =
+            [l_locationCodeIndex =
+                 m_locationCodeIndex](const types::ObjectMap& i_objectMap) {
+                l_locationCodeIndex->update(i_objectMap);
+            };
+
+        m_locationCodeMatches.emplace_back(std::make_shared<sdbusplus::match>(
+            *m_asioConnection,
+            sdbusplus::match_rules::interfacesAdded(constants::pimPath) +
+                sdbusplus::match_rules::sender(constants::pimServiceName),
+            [this](sdbusplus::message_t& i_msg) {
+                interfacesAddedCallback(i_msg);
+            }));
+
+        m_locationCodeMatches.emplace_back(std::make_shared<sdbusplus::match>(
+            *m_asioConnection,
+            sdbusplus::match_rules::interfacesRemoved(constants::pimPath) +
+                sdbusplus::match_rules::sender(constants::pimServiceName),
+            [this](sdbusplus::message_t& i_msg) {
+                interfacesRemovedCallback(i_msg);
+            }));
+
+        m_locationCodeMatches.emplace_back(std::make_shared<sdbusplus::match>(
+            *m_asioConnection,
+            sdbusplus::match_rules::propertiesChangedNamespace(
+                constants::pimPath, constants::locationCodeInf) +
+                sdbusplus::match_rules::sender(constants::pimServiceName),
+            [this](sdbusplus::message_t& i_msg) {
+                locationCodeChangeCallback(i_msg);
+            }));
+    }
+    catch (const std::exception& l_ex)
+    {
+        // Lookups still work on what gets published and seeded.
+        m_logger->logMessage(std::format(
+            "Failed to register location code callbacks, error: {}",
+            l_ex.what()));
+    }
+}
 
-        if (l_fruPaths.empty())
+void Manager::interfacesAddedCallback(sdbusplus::message_t& i_msg) noexcept
+{
+    try
+    {
+        sdbusplus::message::object_path l_objPath;
+        types::InterfaceMap l_interfaceMap;
+        i_msg.read(l_objPath, l_interfaceMap);
+
+        m_locationCodeIndex->update(l_objPath.str, l_interfaceMap);
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(std::format(
+            "Failed to process InterfacesAdded signal for location code index, error: {}",
+            l_ex.what()));
+    }
+}
+
+void Manager::interfacesRemovedCallback(sdbusplus::message_t& i_msg) noexcept
+{
+    try
+    {
+        sdbusplus::message::object_path l_objPath;
+        std::vector<std::string> l_interfaces;
+        i_msg.read(l_objPath, l_interfaces);
+
+        if (std::ranges::find(l_interfaces, constants::locationCodeInf) !=
+            l_interfaces.end())
         {
-            m_logger->logMessage(
-                std::format("No FRUs found for expanded location code: {}",
-                            i_expandedLocationCode));
+            m_locationCodeIndex->remove(l_objPath.str);
         }
     }
     catch (const std::exception& l_ex)
     {
         m_logger->logMessage(std::format(
-            "Unexpected error occurred while getting FRUs for expanded location code {}: Error{}",
-            i_expandedLocationCode, l_ex.what()));
+            "Failed to process InterfacesRemoved signal for location code index, error: {}",
+            l_ex.what()));
     }
+}
 
-    return l_fruPaths;
+void Manager::locationCodeChangeCallback(sdbusplus::message_t& i_msg) noexcept
+{
+    try
+    {
+        std::string l_interface;
+        types::PropertyMap l_propertyMap;
+        i_msg.read(l_interface, l_propertyMap);
+
+        m_locationCodeIndex->update(i_msg.get_path(),
+                                    types::InterfaceMap{{l_interface,
+                                                         l_propertyMap}});
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(std::format(
+            "Failed to process LocationCode change for location code index, error: {}",
+            l_ex.what()));
+    }
 }
 
 void Manager::performVpdRecollection()
@@ -1110,6 +1297,9 @@ void Manager::deleteAllFRUVPD() const noexcept
             return;
         }
 
+        // VPD on D-Bus is going away, every FRU needs a full recollection.
+        EepromFingerprintStore::getStoreInstance()->invalidateAll();
+
         bool l_directoryRemoved = false;
         uint16_t l_errCode = 0;
 
@@ -1161,6 +1351,91 @@ void Manager::deleteAllFRUVPD() const noexcept
     }
 }
 
+types::JsonSnapshot Manager::getConfigJson(
+    const std::string& i_vpdPath) const noexcept
+{
+    // Handed out when path has no config, doesn't need an owner.
+    static const nlohmann::json l_emptyJson{};
+
+    if (m_configManager)
+    {
+        auto l_jsonResult = m_configManager->getJsonSnapshot(i_vpdPath);
+        if (l_jsonResult.has_value())
+        {
+            return std::move(l_jsonResult.value());
+        }
+
+        m_logger->logMessage(
+            std::format("JSON not found for path {}. Error: {}", i_vpdPath,
+                        commonUtility::getErrCodeMsg(l_jsonResult.error())));
+    }
+
+    return types::JsonSnapshot(types::JsonSnapshot{}, &l_emptyJson);
+}
+
+types::ParsedVpdMap Manager::parseVpdForDbus(
+    const types::Path& i_fruPath, const nlohmann::json& i_sysCfgJsonObj) const
+{
+    std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
+        i_fruPath, i_sysCfgJsonObj, m_vpdCollectionMode);
+
+    std::shared_ptr<ParserInterface> l_vpdParser =
+        l_parserObj->getVpdParserInstance();
+
+    if (const auto l_ipzParser =
+            std::dynamic_pointer_cast<IpzVpdParser>(l_vpdParser))
+    {
+        // IPZ VPD: build D-Bus map directly from the parsed view, to avoid
+        // an intermediate map of strings.
+        const IpzVpdView l_ipzView = l_ipzParser->parseToView();
+
+        types::DbusIPZVpdMap l_result;
+        for (const auto& l_entry : l_ipzView.getEntries())
+        {
+            const std::string_view l_value = l_ipzView.getValue(l_entry);
+            l_result[std::string(l_entry.m_record)].emplace(
+                std::string(l_entry.m_keyword),
+                types::BinaryVector(l_value.begin(), l_value.end()));
+        }
+
+        return l_result;
+    }
+
+    const types::VPDMapVariant l_parsedVpd = l_vpdParser->parse();
+
+    if (const auto* l_kwMap = std::get_if<types::KeywordVpdMap>(&l_parsedVpd))
+    {
+        // Keyword VPD: BinaryVector and string pass through as-is;
+        // only size_t needs casting to uint64_t for D-Bus.
+        types::DbusKeywordVpdMap l_result;
+        for (const auto& [l_keyword, l_value] : *l_kwMap)
+        {
+            std::visit(
+                [&](const auto& l_val) {
+                    using T = std::decay_t<decltype(l_val)>;
+                    if constexpr (std::is_same_v<T, size_t>)
+                    {
+                        l_result.emplace(l_keyword,
+                                         static_cast<uint64_t>(l_val));
+                    }
+                    else
+                    {
+                        l_result.emplace(l_keyword, l_val);
+                    }
+                },
+                l_value);
+        }
+        return l_result;
+    }
+
+    // std::monostate — unrecognised VPD format
+    m_logger->logMessage(
+        std::format("getParsedVpd: unrecognised VPD format for FRU [{}].",
+                    i_fruPath),
+        PlaceHolder::DEFAULT);
+    throw types::DbusInvalidArgument();
+}
+
 types::ParsedVpdMap Manager::getParsedVpd(const types::Path& i_fruPath)
 {
     if (i_fruPath.empty())
@@ -1182,79 +1457,13 @@ types::ParsedVpdMap Manager::getParsedVpd(const types::Path& i_fruPath)
 
     try
     {
-        nlohmann::json l_jsonObj{};
+        const types::JsonSnapshot l_configJson = getConfigJson(i_fruPath);
+        const nlohmann::json& l_jsonObj = *l_configJson;
 
-        if (m_configManager)
-        {
-            const auto l_jsonResult = m_configManager->getJsonObj(i_fruPath);
-            if (l_jsonResult.has_value())
-            {
-                l_jsonObj = l_jsonResult.value().get();
-            }
-            else
-            {
-                m_logger->logMessage(std::format(
-                    "JSON not found for path {}. Error: {}", i_fruPath,
-                    commonUtility::getErrCodeMsg(l_jsonResult.error())));
-            }
-        }
-
-        std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(i_fruPath, l_jsonObj, m_vpdCollectionMode);
-
-        const types::VPDMapVariant l_parsedVpd = l_parserObj->parse();
-
-        if (const auto* l_ipzMap = std::get_if<types::IPZVpdMap>(&l_parsedVpd))
-        {
-            // IPZ VPD: convert string values to BinaryVector for D-Bus
-            types::DbusIPZVpdMap l_result;
-            for (const auto& [l_record, l_kwMap] : *l_ipzMap)
-            {
-                std::map<types::Keyword, types::BinaryVector> l_kwBinMap;
-                for (const auto& [l_keyword, l_value] : l_kwMap)
-                {
-                    l_kwBinMap.emplace(
-                        l_keyword,
-                        types::BinaryVector(l_value.begin(), l_value.end()));
-                }
-                l_result.emplace(l_record, std::move(l_kwBinMap));
-            }
-
-            return l_result;
-        }
-
-        if (const auto* l_kwMap =
-                std::get_if<types::KeywordVpdMap>(&l_parsedVpd))
-        {
-            // Keyword VPD: BinaryVector and string pass through as-is;
-            // only size_t needs casting to uint64_t for D-Bus.
-            types::DbusKeywordVpdMap l_result;
-            for (const auto& [l_keyword, l_value] : *l_kwMap)
-            {
-                std::visit(
-                    [&](const auto& l_val) {
-                        using T = std::decay_t<decltype(l_val)>;
-                        if constexpr (std::is_same_v<T, size_t>)
-                        {
-                            l_result.emplace(l_keyword,
-                                             static_cast<uint64_t>(l_val));
-                        }
-                        else
-                        {
-                            l_result.emplace(l_keyword, l_val);
-                        }
-                    },
-                    l_value);
-            }
-            return l_result;
-        }
-
-        // std::monostate — unrecognised VPD format
-        m_logger->logMessage(
-            std::format("getParsedVpd: unrecognised VPD format for FRU [{}].",
-                        i_fruPath),
-            PlaceHolder::DEFAULT);
-        throw types::DbusInvalidArgument();
+        return *ParsedVpdCache::getCacheInstance()->getParsedVpd(
+            i_fruPath, [this, &i_fruPath, &l_jsonObj]() {
+                return parseVpdForDbus(i_fruPath, l_jsonObj);
+            });
     }
     catch (const types::DbusInvalidArgument&)
     {
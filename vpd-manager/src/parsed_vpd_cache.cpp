@@ -0,0 +1,98 @@
+#include "parsed_vpd_cache.hpp"
+
+namespace vpd
+{
+std::shared_ptr<ParsedVpdCache> ParsedVpdCache::getCacheInstance()
+{
+    static std::shared_ptr<ParsedVpdCache> l_cacheInstance(
+        new ParsedVpdCache());
+    return l_cacheInstance;
+}
+
+bool ParsedVpdCache::getFingerprint(const types::Path& i_filePath,
+                                    FileFingerprint& o_fingerprint) noexcept
+{
+    struct stat l_fileStat{};
+    if (stat(i_filePath.c_str(), &l_fileStat) != 0)
+    {
+        return false;
+    }
+
+    o_fingerprint.m_inode = l_fileStat.st_ino;
+    o_fingerprint.m_size = l_fileStat.st_size;
+    o_fingerprint.m_modifiedTime = l_fileStat.st_mtim;
+    return true;
+}
+
+bool ParsedVpdCache::isSameFingerprint(const FileFingerprint& i_lhs,
+                                       const FileFingerprint& i_rhs) noexcept
+{
+    return i_lhs.m_inode == i_rhs.m_inode && i_lhs.m_size == i_rhs.m_size &&
+           i_lhs.m_modifiedTime.tv_sec == i_rhs.m_modifiedTime.tv_sec &&
+           i_lhs.m_modifiedTime.tv_nsec == i_rhs.m_modifiedTime.tv_nsec;
+}
+
+std::shared_ptr<const types::ParsedVpdMap> ParsedVpdCache::getParsedVpd(
+    const types::Path& i_eepromPath,
+    const std::function<types::ParsedVpdMap()>& i_parseFunction)
+{
+    FileFingerprint l_fingerprint;
+    const bool l_hasFingerprint = getFingerprint(i_eepromPath, l_fingerprint);
+
+    uint64_t l_generation = 0;
+    {
+        std::scoped_lock l_lock(m_mutex);
+
+        const auto l_entryItr = m_entries.find(i_eepromPath);
+        if (l_entryItr != m_entries.end())
+        {
+            if (l_hasFingerprint &&
+                isSameFingerprint(l_entryItr->second.m_fingerprint,
+                                  l_fingerprint))
+            {
+                m_hitCount.fetch_add(1, std::memory_order_relaxed);
+                return l_entryItr->second.m_parsedVpd;
+            }
+
+            // File has changed underneath.
+            m_entries.erase(l_entryItr);
+        }
+
+        l_generation = m_generation;
+    }
+
+    m_missCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Parse outside the lock, it involves EEPROM access.
+    auto l_parsedVpd =
+        std::make_shared<const types::ParsedVpdMap>(i_parseFunction());
+
+    if (l_hasFingerprint)
+    {
+        std::scoped_lock l_lock(m_mutex);
+
+        // Skip caching if anything got invalidated during the parse.
+        if (l_generation == m_generation)
+        {
+            m_entries.insert_or_assign(
+                i_eepromPath, CacheEntry{l_parsedVpd, l_fingerprint});
+        }
+    }
+
+    return l_parsedVpd;
+}
+
+void ParsedVpdCache::invalidate(const types::Path& i_eepromPath) noexcept
+{
+    std::scoped_lock l_lock(m_mutex);
+    m_entries.erase(i_eepromPath);
+    ++m_generation;
+}
+
+void ParsedVpdCache::invalidateAll() noexcept
+{
+    std::scoped_lock l_lock(m_mutex);
+    m_entries.clear();
+    ++m_generation;
+}
+} // namespace vpd
@@ -1,8 +1,11 @@
 #include "parser.hpp"
 
+#include "collection_tracer.hpp"
 #include "constants.hpp"
 #include "ipz_parser.hpp"
 #include "keyword_vpd_parser.hpp"
+#include "parsed_vpd_cache.hpp"
+#include "vpd_image.hpp"
 
 #include <utility/dbus_utility.hpp>
 #include <utility/event_logger_utility.hpp>
@@ -11,11 +14,13 @@
 
 #include <format>
 #include <fstream>
+#include <future>
 #include <string>
 
 namespace vpd
 {
-Parser::Parser(const std::string& i_vpdFilePath, nlohmann::json i_parsedJson,
+Parser::Parser(const std::string& i_vpdFilePath,
+               const nlohmann::json& i_parsedJson,
                types::VpdCollectionMode i_vpdCollectionMode) :
     m_vpdFilePath(i_vpdFilePath), m_parsedJson(i_parsedJson),
     m_vpdCollectionMode(i_vpdCollectionMode),
@@ -62,27 +67,46 @@ Parser::Parser(const std::string& i_vpdFilePath, nlohmann::json i_parsedJson,
 
 std::shared_ptr<vpd::ParserInterface> Parser::getVpdParserInstance()
 {
-    // Read the VPD data into a vector.
+    // Holds parser along with the image it views. Every call loads a fresh
+    // image, so that parsers returned earlier stay valid.
+    struct ParserWithImage
+    {
+        VpdImage m_vpdImage;
+        std::shared_ptr<vpd::ParserInterface> m_parser;
+    };
+
+    auto l_parserWithImage = std::make_shared<ParserWithImage>();
+
+    // Load the VPD data, parsers work on a view of it.
     uint16_t l_errCode = 0;
-    vpdSpecificUtility::getVpdDataInVector(m_vpdModeBasedFruPath, m_vpdVector,
-                                           m_vpdStartOffset, l_errCode);
+    l_parserWithImage->m_vpdImage.load(m_vpdModeBasedFruPath,
+                                       m_vpdStartOffset, l_errCode);
 
     if (l_errCode)
     {
-        m_logger->logMessage("Failed to get VPD in vector, error : " +
+        m_logger->logMessage("Failed to load VPD, error : " +
                              commonUtility::getErrCodeMsg(l_errCode));
     }
 
     // This will detect the type of parser required.
-    std::shared_ptr<vpd::ParserInterface> l_parser = ParserFactory::getParser(
-        m_vpdVector, m_vpdModeBasedFruPath, m_vpdStartOffset);
+    l_parserWithImage->m_parser = ParserFactory::getParser(
+        l_parserWithImage->m_vpdImage.getView(), m_vpdModeBasedFruPath,
+        m_vpdStartOffset);
 
-    return l_parser;
+    // Returned pointer shares ownership of the image.
+    return std::shared_ptr<vpd::ParserInterface>(
+        l_parserWithImage, l_parserWithImage->m_parser.get());
 }
 
 types::VPDMapVariant Parser::parse()
 {
-    std::shared_ptr<vpd::ParserInterface> l_parser = getVpdParserInstance();
+    std::shared_ptr<vpd::ParserInterface> l_parser;
+    {
+        TraceSpan l_readSpan("eepromRead", m_vpdFilePath);
+        l_parser = getVpdParserInstance();
+    }
+
+    TraceSpan l_parseSpan("parse", m_vpdFilePath);
     return l_parser->parse();
 }
 
@@ -313,6 +337,9 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData,
         l_bytesUpdatedOnHardware = constants::FAILURE;
     }
 
+    // Hardware may have changed even if the update failed midway.
+    ParsedVpdCache::getCacheInstance()->invalidate(m_vpdFilePath);
+
     // Disable Reboot Guard
     if (constants::FAILURE == dbusUtility::DisableRebootGuard())
     {
@@ -335,6 +362,183 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
     return updateVpdKeyword(i_paramsToWriteData, o_updatedValue);
 }
 
+int Parser::updateVpdKeywords(
+    const std::vector<types::IpzData>& i_keywordsToUpdate)
+{
+    int l_bytesUpdatedOnHardware = constants::FAILURE;
+
+    // Enable Reboot Guard
+    if (constants::FAILURE == dbusUtility::EnableRebootGuard())
+    {
+        m_logger->logMessage(
+            "Failed to enable BMC Reboot Guard while updating keywords on " +
+                m_vpdFilePath,
+            PlaceHolder::PEL,
+            types::PelInfoTuple{types::ErrorType::DbusFailure,
+                                types::SeverityType::Informational, 0,
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt, std::nullopt});
+
+        return constants::FAILURE;
+    }
+
+    try
+    {
+        std::shared_ptr<IpzVpdParser> l_ipzParser =
+            std::dynamic_pointer_cast<IpzVpdParser>(getVpdParserInstance());
+
+        if (!l_ipzParser)
+        {
+            throw std::runtime_error(
+                "Multiple keyword update is supported only for IPZ VPD.");
+        }
+
+        l_bytesUpdatedOnHardware =
+            l_ipzParser->writeKeywordsOnHardware(i_keywordsToUpdate);
+
+        uint16_t l_errCode = 0;
+
+        auto [l_fruPath, l_inventoryObjPath, l_redundantFruPath] =
+            jsonUtility::getAllPathsToUpdateKeyword(m_vpdFilePath, l_errCode);
+
+        if (l_errCode == error_code::INVALID_INPUT_PARAMETER ||
+            l_errCode == error_code::INVALID_JSON)
+        {
+            throw std::runtime_error(
+                "Failed to get paths to update keyword. Error : " +
+                commonUtility::getErrCodeMsg(l_errCode));
+        }
+
+        if (l_errCode == error_code::ERROR_GETTING_REDUNDANT_PATH)
+        {
+            m_logger->logMessage(commonUtility::getErrCodeMsg(l_errCode));
+        }
+
+        // If inventory D-bus object path is present, update keywords' value on
+        // DBus
+        if (!l_inventoryObjPath.empty())
+        {
+            // Read keywords' value from hardware to write the same on D-bus.
+            l_ipzParser =
+                std::dynamic_pointer_cast<IpzVpdParser>(getVpdParserInstance());
+
+            dbusUtility::PublishBatch l_publishBatch;
+
+            for (const auto& [l_recordName, l_keywordName, l_value] :
+                 i_keywordsToUpdate)
+            {
+                const auto l_keywordValue =
+                    l_ipzParser->getKeywordValue(l_recordName, l_keywordName);
+
+                // Get D-bus name for the given keyword
+                const auto l_propertyName =
+                    vpdSpecificUtility::getDbusPropNameForGivenKw(l_keywordName,
+                                                                  l_errCode);
+
+                if (l_errCode)
+                {
+                    m_logger->logMessage(
+                        "Failed to get Dbus property name for given keyword, error : " +
+                        commonUtility::getErrCodeMsg(l_errCode));
+                }
+
+                const types::WriteVpdParams l_dbusParams(std::make_tuple(
+                    l_recordName, l_propertyName,
+                    types::BinaryVector(l_keywordValue.begin(),
+                                        l_keywordValue.end())));
+
+                vpdSpecificUtility::updateKeywordOnDBus(
+                    m_vpdFilePath, l_dbusParams, m_parsedJson, l_errCode);
+
+                if (l_errCode)
+                {
+                    throw std::runtime_error(std::format(
+                        "Failed to update keyword value on D-Bus, error : {}.",
+                        commonUtility::getErrCodeMsg(l_errCode)));
+                }
+
+                vpdSpecificUtility::updateCiPropertyOfInheritedFrus(
+                    m_vpdFilePath, l_dbusParams, m_parsedJson, l_errCode);
+
+                if (l_errCode)
+                {
+                    m_logger->logMessage(
+                        "Failed to update Ci property of inherited FRUs, error : " +
+                        commonUtility::getErrCodeMsg(l_errCode));
+                }
+
+                auto l_updateExtraInterfaceResult =
+                    vpdSpecificUtility::updateExtraInterfaceProperties(
+                        m_vpdFilePath, l_dbusParams, m_parsedJson);
+
+                if (!l_updateExtraInterfaceResult)
+                {
+                    m_logger->logMessage(
+                        "Failed to update extra interface(s) property of FRU, error : " +
+                        commonUtility::getErrCodeMsg(
+                            l_updateExtraInterfaceResult.error()));
+                }
+            }
+
+            // On exception, hardware is already updated and the batch
+            // publishes what was gathered as it goes out of scope.
+            if (!l_publishBatch.commit())
+            {
+                throw std::runtime_error(
+                    "Failed to publish updated keywords on D-Bus.");
+            }
+        }
+
+        // Update keywords' value on redundant hardware if present
+        if (!l_redundantFruPath.empty())
+        {
+            Parser l_redundantParserObj(l_redundantFruPath, m_parsedJson);
+
+            const auto l_redundantIpzParser =
+                std::dynamic_pointer_cast<IpzVpdParser>(
+                    l_redundantParserObj.getVpdParserInstance());
+
+            if (!l_redundantIpzParser ||
+                l_redundantIpzParser->writeKeywordsOnHardware(
+                    i_keywordsToUpdate) < 0)
+            {
+                throw std::runtime_error(
+                    "Error while updating keywords' value on redundant path " +
+                    l_redundantFruPath);
+            }
+
+            ParsedVpdCache::getCacheInstance()->invalidate(l_redundantFruPath);
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage("Update VPD keywords failed for : " +
+                             m_vpdFilePath +
+                             " failed due to error: " + l_ex.what());
+
+        // update failed, set return value to failure
+        l_bytesUpdatedOnHardware = constants::FAILURE;
+    }
+
+    // Hardware may have changed even if the update failed midway.
+    ParsedVpdCache::getCacheInstance()->invalidate(m_vpdFilePath);
+
+    // Disable Reboot Guard
+    if (constants::FAILURE == dbusUtility::DisableRebootGuard())
+    {
+        m_logger->logMessage(
+            "Failed to disable BMC Reboot Guard while updating keywords on " +
+                m_vpdFilePath,
+            PlaceHolder::PEL,
+            types::PelInfoTuple{types::ErrorType::DbusFailure,
+                                types::SeverityType::Critical, 0, std::nullopt,
+                                std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt});
+    }
+
+    return l_bytesUpdatedOnHardware;
+}
+
 int Parser::updateVpdKeywordOnRedundantPath(
     const std::string& i_fruPath,
     const types::WriteVpdParams& i_paramsToWriteData)
@@ -347,10 +551,17 @@ int Parser::updateVpdKeywordOnRedundantPath(
         std::shared_ptr<ParserInterface> l_vpdParserInstance =
             l_parserObj->getVpdParserInstance();
 
-        return l_vpdParserInstance->writeKeywordOnHardware(i_paramsToWriteData);
+        const auto l_bytesUpdated =
+            l_vpdParserInstance->writeKeywordOnHardware(i_paramsToWriteData);
+
+        ParsedVpdCache::getCacheInstance()->invalidate(i_fruPath);
+
+        return l_bytesUpdated;
     }
     catch (const std::exception& l_exception)
     {
+        ParsedVpdCache::getCacheInstance()->invalidate(i_fruPath);
+
         m_logger->logMessage(
             "Error while updating keyword's value on redundant path " +
                 i_fruPath + ", error: " + std::string(l_exception.what()),
@@ -431,6 +642,8 @@ int Parser::updateVpdKeywordOnHardware(
                                 std::nullopt, std::nullopt});
     }
 
+    ParsedVpdCache::getCacheInstance()->invalidate(m_vpdFilePath);
+
     // Disable Reboot Guard
     if (constants::FAILURE == dbusUtility::DisableRebootGuard())
     {
@@ -454,14 +667,20 @@ bool Parser::compareData(const std::string& i_redundantEepromPath)
         throw std::runtime_error("Empty redundant path received");
     }
 
-    std::shared_ptr<vpd::ParserInterface> l_primaryParser =
-        this->getVpdParserInstance();
-
     Parser l_parserForRedundant(i_redundantEepromPath, m_parsedJson,
                                 m_vpdCollectionMode);
 
+    // EEPROMs are read alongside each other.
+    auto l_redundantParserFuture =
+        std::async(std::launch::async, [&l_parserForRedundant]() {
+            return l_parserForRedundant.getVpdParserInstance();
+        });
+
+    std::shared_ptr<vpd::ParserInterface> l_primaryParser =
+        this->getVpdParserInstance();
+
     std::shared_ptr<vpd::ParserInterface> l_redundantParser =
-        l_parserForRedundant.getVpdParserInstance();
+        l_redundantParserFuture.get();
 
     if (typeid(*l_primaryParser.get()) != typeid(*l_redundantParser.get()))
     {
@@ -470,8 +689,6 @@ bool Parser::compareData(const std::string& i_redundantEepromPath)
     }
 
     return l_primaryParser->compareData(l_redundantParser);
-
-    return false;
 }
 
 } // namespace vpd
@@ -31,7 +31,7 @@ enum vpdType
  *
  * @return Type of VPD data, "INVALID_VPD_FORMAT" in case of unknown type.
  */
-static vpdType vpdTypeCheck(const types::BinaryVector& i_vpdVector)
+static vpdType vpdTypeCheck(types::BinaryView i_vpdVector)
 {
     if (i_vpdVector[constants::IPZ_DATA_START] == constants::IPZ_DATA_START_TAG)
     {
@@ -96,7 +96,7 @@ static vpdType vpdTypeCheck(const types::BinaryVector& i_vpdVector)
 }
 
 std::shared_ptr<ParserInterface> ParserFactory::getParser(
-    const types::BinaryVector& i_vpdVector, const std::string& i_vpdFilePath,
+    types::BinaryView i_vpdVector, const std::string& i_vpdFilePath,
     size_t i_vpdStartOffset)
 {
     if (i_vpdVector.empty())
@@ -0,0 +1,324 @@
+#include "pim_publisher.hpp"
+
+#include "constants.hpp"
+#include "logger.hpp"
+#include "utility/dbus_utility.hpp"
+
+#include <cstring>
+#include <format>
+
+namespace vpd
+{
+namespace
+{
+/**
+ * @brief API to make a Notify call on PIM.
+ *
+ * @param[in] i_batch - Objects with paths relative to PIM path.
+ *
+ * @return true if PIM took the objects, false otherwise.
+ */
+bool tryNotifyPIM(const types::ObjectMap& i_batch) noexcept
+{
+    try
+    {
+        dbusUtility::notifyPIM(i_batch);
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+} // namespace
+
+PimPublisher::~PimPublisher()
+{
+    stop();
+}
+
+const std::shared_ptr<PimPublisher>& PimPublisher::getPublisherInstance()
+{
+    static std::shared_ptr<PimPublisher> l_publisherInstance(
+        new PimPublisher());
+    return l_publisherInstance;
+}
+
+void PimPublisher::start()
+{
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        if (m_isRunning)
+        {
+            return;
+        }
+
+        // Flusher of the previous run has exited, nothing else touches it.
+        m_failedObjectPaths.clear();
+        m_isStopping = false;
+
+        m_flusherThread = std::thread(&PimPublisher::flushLoop, this);
+        m_isRunning = true;
+    }
+
+    dbusUtility::getPublishSink().store(&PimPublisher::queueObjectMap,
+                                        std::memory_order_release);
+}
+
+std::vector<std::string> PimPublisher::stop() noexcept
+{
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        if (!m_isRunning)
+        {
+            return {};
+        }
+
+        // Threads which still see the sink find it refusing and publish
+        // directly.
+        m_isRunning = false;
+        m_isStopping = true;
+    }
+
+    dbusUtility::getPublishSink().store(nullptr, std::memory_order_release);
+    m_cv.notify_one();
+
+    if (m_flusherThread.joinable())
+    {
+        m_flusherThread.join();
+    }
+
+    std::vector<std::string> l_failedObjectPaths;
+    try
+    {
+        l_failedObjectPaths.reserve(m_failedObjectPaths.size());
+        for (const auto& l_objectPath : m_failedObjectPaths)
+        {
+            l_failedObjectPaths.emplace_back(constants::pimPath + l_objectPath);
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to list object paths failed to publish, error: " +
+            std::string(l_ex.what()));
+    }
+
+    return l_failedObjectPaths;
+}
+
+bool PimPublisher::isRunning() const noexcept
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    return m_isRunning;
+}
+
+bool PimPublisher::queueObjectMap(types::ObjectMap& io_objectMap) noexcept
+{
+    return getPublisherInstance()->queue(io_objectMap);
+}
+
+bool PimPublisher::queue(types::ObjectMap& io_objectMap) noexcept
+{
+    bool l_isFlushDue = false;
+    try
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        if (!m_isRunning)
+        {
+            return false;
+        }
+
+        const size_t l_objectCount = io_objectMap.size();
+
+        // Map is left untouched if this throws.
+        m_queue.push_back(std::move(io_objectMap));
+
+        // Flusher waits for the first map, and then for a full batch.
+        l_isFlushDue =
+            (m_queue.size() == 1) ||
+            (m_queuedObjectCount < constants::MAX_OBJECTS_PER_NOTIFY &&
+             m_queuedObjectCount + l_objectCount >=
+                 constants::MAX_OBJECTS_PER_NOTIFY);
+
+        if (m_queue.size() == 1)
+        {
+            m_oldestQueueTime = std::chrono::steady_clock::now();
+        }
+        m_queuedObjectCount += l_objectCount;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    if (l_isFlushDue)
+    {
+        m_cv.notify_one();
+    }
+    return true;
+}
+
+void PimPublisher::flushLoop() noexcept
+{
+    std::unique_lock<std::mutex> l_lock(m_mutex);
+    while (true)
+    {
+        m_cv.wait(l_lock,
+                  [this]() { return m_isStopping || !m_queue.empty(); });
+
+        if (m_queue.empty())
+        {
+            // Stopped with nothing left to send.
+            break;
+        }
+
+        // Give other FRUs a chance to fill the batch.
+        m_cv.wait_until(
+            l_lock,
+            m_oldestQueueTime + std::chrono::milliseconds(
+                                    constants::PIM_PUBLISH_FLUSH_INTERVAL_MS),
+            [this]() {
+                return m_isStopping || m_queuedObjectCount >=
+                                           constants::MAX_OBJECTS_PER_NOTIFY;
+            });
+
+        std::vector<types::ObjectMap> l_objectMaps = std::move(m_queue);
+        m_queue.clear();
+        m_queuedObjectCount = 0;
+
+        // Threads keep queuing while the batch is sent.
+        l_lock.unlock();
+        flush(std::move(l_objectMaps));
+        l_lock.lock();
+    }
+}
+
+void PimPublisher::flush(std::vector<types::ObjectMap>&& i_objectMaps) noexcept
+{
+    try
+    {
+        types::ObjectMap l_mergedObjectMap;
+        for (auto& l_objectMap : i_objectMaps)
+        {
+            dbusUtility::mergeObjectMap(l_mergedObjectMap,
+                                        std::move(l_objectMap));
+        }
+
+        const size_t l_pimPathLength = std::strlen(constants::pimPath);
+
+        types::ObjectMap l_batch;
+        while (!l_mergedObjectMap.empty())
+        {
+            auto l_nodeHandle =
+                l_mergedObjectMap.extract(l_mergedObjectMap.begin());
+
+            // PIM takes object paths relative to its own path.
+            if (l_nodeHandle.key().str.starts_with(constants::pimPath))
+            {
+                l_nodeHandle.key().str.erase(0, l_pimPathLength);
+            }
+
+            // Completed status of a FRU whose VPD failed in an earlier batch.
+            if (m_failedObjectPaths.contains(l_nodeHandle.key().str))
+            {
+                auto l_progressItr = l_nodeHandle.mapped().find(
+                    types::CommonProgress::interface);
+                if (l_progressItr != l_nodeHandle.mapped().end() &&
+                    l_progressItr->second.contains("Status"))
+                {
+                    l_progressItr->second["Status"] =
+                        types::CommonProgress::convertOperationStatusToString(
+                            types::VpdCollectionStatus::Failed);
+                }
+            }
+
+            l_batch.insert(std::move(l_nodeHandle));
+            if (l_batch.size() == constants::MAX_OBJECTS_PER_NOTIFY)
+            {
+                sendBatch(l_batch);
+                l_batch.clear();
+            }
+        }
+
+        if (!l_batch.empty())
+        {
+            sendBatch(l_batch);
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to publish queued VPD, error: " + std::string(l_ex.what()));
+    }
+}
+
+void PimPublisher::sendBatch(const types::ObjectMap& i_batch) noexcept
+{
+    if (tryNotifyPIM(i_batch))
+    {
+        return;
+    }
+
+    try
+    {
+        // Notify override stands in for PIM, hence PIM is not looked up.
+        bool l_isPimRunning =
+            static_cast<bool>(dbusUtility::getPimNotifyOverride());
+        try
+        {
+            l_isPimRunning =
+                l_isPimRunning ||
+                dbusUtility::isServiceRunning(constants::pimServiceName);
+        }
+        catch (const std::exception&)
+        {
+            // Bus itself is unreachable.
+        }
+
+        if (!l_isPimRunning)
+        {
+            // Nothing would go through, spare the calls per object.
+            for (const auto& l_object : i_batch)
+            {
+                m_failedObjectPaths.insert(l_object.first.str);
+            }
+
+            Logger::getLoggerInstance()->logMessage(std::format(
+                "PIM not running, failed to publish {} objects",
+                i_batch.size()));
+            return;
+        }
+
+        for (const auto& [l_objectPath, l_interfaceMap] : i_batch)
+        {
+            if (tryNotifyPIM(types::ObjectMap{{l_objectPath, l_interfaceMap}}))
+            {
+                continue;
+            }
+
+            m_failedObjectPaths.insert(l_objectPath.str);
+            Logger::getLoggerInstance()->logMessage(
+                std::format("Failed to publish VPD of object {}{}",
+                            constants::pimPath, l_objectPath.str));
+
+            // Status sent along with the failed object did not land either.
+            if (l_interfaceMap.contains(types::CommonProgress::interface))
+            {
+                tryNotifyPIM(types::ObjectMap{
+                    {l_objectPath,
+                     {{types::CommonProgress::interface,
+                       {{"Status",
+                         types::CommonProgress::convertOperationStatusToString(
+                             types::VpdCollectionStatus::Failed)}}}}}});
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        Logger::getLoggerInstance()->logMessage(
+            "Failed to publish batch of VPD, error: " +
+            std::string(l_ex.what()));
+    }
+}
+} // namespace vpd
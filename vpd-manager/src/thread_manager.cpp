@@ -1,18 +1,29 @@
+#include "config.h"
+
 #include "thread_manager.hpp"
 
+#include "collection_tracer.hpp"
 #include "constants.hpp"
+#include "eeprom_fingerprint_store.hpp"
 #include "exceptions.hpp"
 #include "logger.hpp"
+#include "pim_publisher.hpp"
 #include "types.hpp"
+#include "utility/dbus_utility.hpp"
 #include "utility/event_logger_utility.hpp"
 #include "utility/vpd_specific_utility.hpp"
 #include "worker.hpp"
 
 #include <utility/json_utility.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <format>
 #include <thread>
+#include <unordered_set>
 
 namespace vpd
 {
@@ -37,6 +48,14 @@ ThreadManager::ThreadManager(
     }
 }
 
+ThreadManager::~ThreadManager()
+{
+    if (m_collectionThread.joinable())
+    {
+        m_collectionThread.join();
+    }
+}
+
 void ThreadManager::updateOverallCollectionStatus(
     const types::VpdCollectionStatus i_status) const noexcept
 {
@@ -46,14 +65,24 @@ void ThreadManager::updateOverallCollectionStatus(
     m_progressInterface->signal_property("Status");
 }
 
-void ThreadManager::collectAllChassisVpd()
+void ThreadManager::collectAllChassisVpd(
+    const std::shared_ptr<CollectionContext>& i_context)
 {
+    // Config snapshot used by the whole collection, tasks borrow chassis JSON
+    // from it instead of copying.
+    const std::shared_ptr<const ConfigManager> l_configSnapshot =
+        m_configManager;
+    if (!l_configSnapshot)
+    {
+        throw JsonException("ConfigManager is not initialized.");
+    }
+
     // Get the chassis to motherboard EEPROM path map from ConfigManager
     const auto& l_chassisToMotherboardEepromMap =
-        m_configManager->getChassisToMotherboardEepromMap();
+        l_configSnapshot->getChassisToMotherboardEepromMap();
 
     // Get the chassisId to json map for chassis-specific configuration
-    const auto& l_chassisIdToJsonMap = m_configManager->getChassisIdToJsonMap();
+    const auto& l_chassisIdToJsonMap = l_configSnapshot->getChassisIdToJsonMap();
 
     if (l_chassisToMotherboardEepromMap.empty() || l_chassisIdToJsonMap.empty())
     {
@@ -64,7 +93,10 @@ void ThreadManager::collectAllChassisVpd()
     }
 
     // Update the chassis count
-    m_chassisCount = l_chassisToMotherboardEepromMap.size();
+    {
+        std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+        i_context->m_chassisCount = l_chassisToMotherboardEepromMap.size();
+    }
 
     m_logger->logMessage(
         std::format(
@@ -78,7 +110,7 @@ void ThreadManager::collectAllChassisVpd()
         auto l_chassisToJsonItr = l_chassisIdToJsonMap.find(l_chassisId);
         if (l_chassisToJsonItr == l_chassisIdToJsonMap.end())
         {
-            --m_chassisCount;
+            markChassisComplete(i_context);
 
             // Update per-chassis collection status to Failed
             uint16_t l_errCode = 0;
@@ -106,74 +138,179 @@ void ThreadManager::collectAllChassisVpd()
         // Skip collecting system VPD path again
         if (l_eepromPath == SYSTEM_VPD_FILE_PATH)
         {
-            handleChassisHavingSystemVpd(l_chassisToJsonItr->second,
-                                         l_chassisId, l_eepromPath);
+            handleChassisHavingSystemVpd(
+                i_context,
+                types::JsonSnapshot(l_configSnapshot,
+                                    &l_chassisToJsonItr->second),
+                l_chassisId, l_eepromPath);
             continue;
         }
 #endif
 
-        m_logger->logMessage(
-            std::format(
-                "Spawning thread for chassis [{}] with EEPROM path [{}]",
-                l_chassisId, l_eepromPath),
-            PlaceHolder::COLLECTION);
+        m_logger->logEvent(collectionLog::Event::CHASSIS_COLLECTION_QUEUED,
+                           l_eepromPath, 0, 0, l_chassisId);
 
         try
         {
-            const nlohmann::json& l_chassisJson = l_chassisToJsonItr->second;
+            const types::JsonSnapshot l_chassisJson(
+                l_configSnapshot, &l_chassisToJsonItr->second);
+
+            submitCollectionTask(i_context, l_eepromPath,
+                                 [i_context, l_eepromPath, l_chassisJson,
+                                  l_chassisId, this]() {
+                TraceSpan l_span("chassisTask", l_eepromPath);
 
-            std::thread{[l_eepromPath, l_chassisJson, l_chassisId, this]() {
-                // Create a local Worker instance for this thread
+                // Create a local Worker instance for this task
                 Worker l_threadWorker;
 
                 uint16_t l_errCode = 0;
                 auto [l_isPresent, l_collectionStatus] =
-                    l_threadWorker.collectFruVpd(l_eepromPath, l_chassisJson,
+                    l_threadWorker.collectFruVpd(l_eepromPath, *l_chassisJson,
                                                  l_errCode);
 
                 updateSystemView(l_chassisId, l_eepromPath, l_isPresent);
 
                 {
-                    std::lock_guard<std::mutex> l_lock(m_mutex);
-                    m_chassisResultQueue.push(std::make_tuple(
+                    std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+                    i_context->m_chassisResultQueue.push(std::make_tuple(
                         l_isPresent, l_eepromPath, l_chassisJson));
-                    m_completionCv.notify_one();
+                    i_context->m_completionCv.notify_all();
                 }
 
-                m_logger->logMessage(
-                    std::format("Completed VPD collection for EEPROM [{}]. "
-                                "Present: {}, Status: {}, ErrorCode: {}",
-                                l_eepromPath, l_isPresent, l_collectionStatus,
-                                l_errCode),
-                    PlaceHolder::COLLECTION);
-            }}.detach();
-            // ToDo:- this detach mode is for time being, we need to update the
-            // system view post collection.
+                m_logger->logEvent(
+                    collectionLog::Event::CHASSIS_COLLECTION_COMPLETED,
+                    l_eepromPath, l_errCode, l_isPresent, l_collectionStatus);
+            });
         }
         catch (const std::exception& l_ex)
         {
-            --m_chassisCount;
+            markChassisComplete(i_context);
             m_logger->logMessage(std::format(
-                "Failed to spawn thread for chassis [{}], EEPROM [{}]. "
+                "Failed to queue VPD collection for chassis [{}], EEPROM [{}]. "
                 "Error: {}, Type: {}",
                 l_chassisId, l_eepromPath, l_ex.what(), typeid(l_ex).name()));
         }
     }
 }
 
+size_t ThreadManager::getCountFromEnv(const char* i_envName,
+                                      const size_t i_defaultCount) noexcept
+{
+    const char* l_envValue = std::getenv(i_envName);
+    if (l_envValue == nullptr)
+    {
+        return i_defaultCount;
+    }
+
+    size_t l_count = 0;
+    const char* l_envValueEnd = l_envValue + std::strlen(l_envValue);
+    const auto [l_ptr, l_ec] =
+        std::from_chars(l_envValue, l_envValueEnd, l_count);
+
+    if (l_ec != std::errc() || l_ptr != l_envValueEnd || l_count == 0)
+    {
+        Logger::getLoggerInstance()->logMessage(std::format(
+            "Ignoring invalid {} value [{}].", i_envName, l_envValue));
+        return i_defaultCount;
+    }
+
+    return l_count;
+}
+
+size_t ThreadManager::getCollectionThreadCount() noexcept
+{
+    return std::clamp<size_t>(
+        getCountFromEnv("VPD_COLLECTION_THREADS", VPD_COLLECTION_THREADS),
+        constants::VALUE_1, constants::MAX_COLLECTION_THREADS);
+}
+
+size_t ThreadManager::getMaxReadersPerI2cBus() noexcept
+{
+    return std::clamp<size_t>(getCountFromEnv("VPD_MAX_READERS_PER_I2C_BUS",
+                                              VPD_MAX_READERS_PER_I2C_BUS),
+                              constants::VALUE_1,
+                              constants::MAX_COLLECTION_THREADS);
+}
+
 void ThreadManager::collectAllFruVpd()
 {
     updateOverallCollectionStatus(types::VpdCollectionStatus::InProgress);
 
     try
     {
-        std::thread{[this]() {
+        // Last collection has already reported its status, it may still be
+        // dumping its trace.
+        if (m_collectionThread.joinable())
+        {
+            m_collectionThread.join();
+        }
+
+        // Pool is created on first collection and reused for later ones.
+        if (!m_threadPool)
+        {
+            m_threadPool = std::make_unique<CollectionThreadPool>(
+                getCollectionThreadCount());
+
+            m_busScheduler = std::make_unique<I2cBusScheduler>(
+                *m_threadPool, getMaxReadersPerI2cBus());
+
+            m_logger->logMessage(
+                std::format("Created VPD collection thread pool with {} "
+                            "threads, max readers per I2C bus {}",
+                            m_threadPool->getThreadCount(),
+                            getMaxReadersPerI2cBus()),
+                PlaceHolder::COLLECTION);
+        }
+
+        // Config may have changed since last collection, whose tasks are all
+        // done by now.
+        nlohmann::json l_muxes = nlohmann::json::array();
+        if (const auto l_sysCfgJson = m_configManager->getJsonObj();
+            l_sysCfgJson.has_value())
+        {
+            l_muxes = l_sysCfgJson.value().get().value(
+                "muxes", nlohmann::json::array());
+        }
+        m_busScheduler->setMuxes(l_muxes);
+        m_busScheduler->resetStatistics();
+
+        m_collectionThread = std::thread{[this]() {
+            const auto& l_tracer = CollectionTracer::getTracerInstance();
+            if (l_tracer->isRequested())
+            {
+                l_tracer->startSession();
+            }
+
+            const auto& l_publisher = PimPublisher::getPublisherInstance();
+
+            // Tasks of this collection complete against this context only.
+            const auto l_context = std::make_shared<CollectionContext>();
+
             try
             {
+                TraceSpan l_span("collectAllFruVpd", std::string_view{});
+
+                // VPD of all FRUs goes to PIM in batches, till every FRU is
+                // processed.
+                l_publisher->start();
+
+                // All VPD gets published again, fingerprints are set pending
+                // as FRUs get collected.
+                EepromFingerprintStore::getStoreInstance()->invalidateAll();
+
                 auto l_start = std::chrono::steady_clock::now();
-                collectAllChassisVpd();
+                collectAllChassisVpd(l_context);
+
+                bool l_result = processChassisResults(l_context);
+
+                // On timeout, tasks may still be publishing VPD.
+                drainCollectionTasks(l_context);
 
-                bool l_result = processChassisResults();
+                // Overall status can only be Completed once PIM has it all.
+                const auto l_failedObjectPaths = l_publisher->stop();
+                logFailedPublications(l_failedObjectPaths);
+                confirmFingerprints(l_failedObjectPaths);
+                l_result = l_result && l_failedObjectPaths.empty();
 
                 const auto l_completionStatus =
                     (l_result ? types::VpdCollectionStatus::Completed
@@ -187,15 +324,38 @@ void ThreadManager::collectAllFruVpd()
                 m_logger->logMessage(std::format(
                     "Total time taken for all FRU VPD collection = {} seconds",
                     l_elapsedSeconds));
+                m_logger->logMessage(dbusUtility::getPimPublishStatsString(),
+                                     PlaceHolder::COLLECTION);
+                m_logger->logMessage(commonUtility::getCommandStatsString(),
+                                     PlaceHolder::COLLECTION);
+                m_logger->logMessage(
+                    std::format("Collection thread pool: threads {}, tasks "
+                                "run {}, tasks stolen {}",
+                                m_threadPool->getThreadCount(),
+                                m_threadPool->getCompletedTaskCount(),
+                                m_threadPool->getStolenTaskCount()),
+                    PlaceHolder::COLLECTION);
+                m_logger->logMessage(m_busScheduler->getBusUtilisationString(),
+                                     PlaceHolder::COLLECTION);
             }
             catch (const std::exception& l_ex)
             {
+                drainCollectionTasks(l_context);
+                const auto l_failedObjectPaths = l_publisher->stop();
+                logFailedPublications(l_failedObjectPaths);
+                confirmFingerprints(l_failedObjectPaths);
                 updateOverallCollectionStatus(
                     types::VpdCollectionStatus::Failed);
                 m_logger->logMessage(std::format(
                     "Collect all FRU VPD failed, reason: {}", l_ex.what()));
             }
-        }}.detach();
+
+            if (l_tracer->isEnabled())
+            {
+                l_tracer->stopSession();
+                dumpCollectionTrace();
+            }
+        }};
 
         m_logger->logMessage("All FRUs VPD collection initiated.",
                              PlaceHolder::COLLECTION);
@@ -237,7 +397,8 @@ void ThreadManager::updateSystemView(const std::string& i_chassisId,
     }
 }
 
-bool ThreadManager::processChassisResults() noexcept
+bool ThreadManager::processChassisResults(
+    const std::shared_ptr<CollectionContext>& i_context) noexcept
 {
     if (m_configManager->getChassisToMotherboardEepromMap().empty())
     {
@@ -245,39 +406,40 @@ bool ThreadManager::processChassisResults() noexcept
         return false;
     }
 
-    // @todo: l_maxThreadsPerChassis should be calculated based on the number of
-    // chassis present in the system.
-    const size_t l_maxThreadsPerChassis = std::max<size_t>(
-        1, constants::MAX_THREADS /
-               m_configManager->getChassisToMotherboardEepromMap().size());
-
     while (true)
     {
-        bool l_decChassisCnt{false};
+        bool l_isChassisComplete{false};
         try
         {
             types::ChassisCollectionResult l_chassisResult;
 
             {
-                std::unique_lock<std::mutex> l_lock(m_mutex);
+                std::unique_lock<std::mutex> l_lock(i_context->m_mutex);
 
                 // Continue until all pending tasks are over, or timeout expires
-                const bool l_timedOut = !m_completionCv.wait_for(
+                const bool l_timedOut = !i_context->m_completionCv.wait_for(
                     l_lock,
                     std::chrono::seconds(constants::VPD_COLLECTION_TIMEOUT_SEC),
-                    [this]() {
-                        return (!m_chassisResultQueue.empty() ||
-                                (!m_chassisCount && !m_frusCount));
+                    [&i_context]() {
+                        return (!i_context->m_chassisResultQueue.empty() ||
+                                !i_context->m_chassisCount);
                     });
 
                 if (l_timedOut)
                 {
+                    size_t l_pendingFrus = 0;
+                    for (const auto& l_chassisContext :
+                         i_context->m_chassisContexts)
+                    {
+                        l_pendingFrus += l_chassisContext->m_pendingFrus;
+                    }
+
                     m_logger->logMessage(
                         std::format(
                             "VPD collection timed out after {} seconds. "
                             "Pending chassis: {}, pending FRUs: {}. Exiting.",
                             constants::VPD_COLLECTION_TIMEOUT_SEC,
-                            m_chassisCount.load(), m_frusCount.load()),
+                            i_context->m_chassisCount, l_pendingFrus),
                         PlaceHolder::ASYNC_PEL,
                         types::PelInfoTuple{types::ErrorType::FirmwareError,
                                             types::SeverityType::Warning, 0,
@@ -288,20 +450,23 @@ bool ThreadManager::processChassisResults() noexcept
                 }
 
                 // Exit when all chassis and FRU VPD collection is complete
-                if (!m_chassisCount && !m_frusCount)
+                if (!i_context->m_chassisCount &&
+                    i_context->m_chassisResultQueue.empty())
                 {
                     return true;
                 }
 
-                l_chassisResult = std::move(m_chassisResultQueue.front());
-                m_chassisResultQueue.pop();
-                l_decChassisCnt = true;
+                l_chassisResult =
+                    std::move(i_context->m_chassisResultQueue.front());
+                i_context->m_chassisResultQueue.pop();
+                l_isChassisComplete = true;
             }
 
             const auto& l_chassisEepromPath = std::get<1>(l_chassisResult);
             const auto& l_chassisJson = std::get<2>(l_chassisResult);
 
-            if (l_chassisJson["frus"].size() <= constants::VALUE_1)
+            if (!l_chassisJson || !l_chassisJson->contains("frus") ||
+                l_chassisJson->at("frus").size() <= constants::VALUE_1)
             {
                 m_logger->logMessage(std::format(
                     "There are no FRUs to collect VPD, for the chassis [{}].",
@@ -311,21 +476,15 @@ bool ThreadManager::processChassisResults() noexcept
             // Collect FRUs for present chassis
             else if (std::get<0>(l_chassisResult))
             {
-                // Increment the FRU counter before staring FRUs VPD collection.
-                // Exclude chassis/motherboard VPD, which was already collected
-                m_frusCount += l_chassisJson["frus"].size() -
-                               constants::VALUE_1;
-
-                launchFruCollectionPool(l_chassisEepromPath, l_chassisJson,
-                                        l_maxThreadsPerChassis);
+                // Chassis gets completed by its last FRU.
+                l_isChassisComplete = false;
+                launchFruCollection(i_context, l_chassisEepromPath,
+                                    l_chassisJson);
             }
             else
             {
-                m_logger->logMessage(
-                    std::format(
-                        "Chassis [{}] is not present; skipping FRUs collection.",
-                        l_chassisEepromPath),
-                    PlaceHolder::COLLECTION);
+                m_logger->logEvent(collectionLog::Event::CHASSIS_NOT_PRESENT,
+                                   l_chassisEepromPath);
             }
         }
         catch (const std::exception& l_ex)
@@ -335,159 +494,314 @@ bool ThreadManager::processChassisResults() noexcept
                 l_ex.what()));
         }
 
-        // Decrement chassis count after actions on the chassis result are
-        // complete
-        if (l_decChassisCnt)
+        if (l_isChassisComplete)
         {
-            --m_chassisCount;
+            markChassisComplete(i_context);
         }
     }
 }
 
-void ThreadManager::launchFruCollectionPool(
-    const std::string& i_chassisEeepromPath,
-    const nlohmann::json& i_chassisJson,
-    const size_t i_maxThreadsPerChassis) noexcept
+void ThreadManager::dumpCollectionTrace() noexcept
 {
-    bool l_anyThreadLaunched{false};
+    uint16_t l_errCode = 0;
+    const size_t l_spanCount =
+        CollectionTracer::getTracerInstance()->dumpChromeTrace(
+            constants::collectionTraceFile, l_errCode);
 
-    try
+    if (l_errCode)
+    {
+        m_logger->logMessage(std::format(
+            "Failed to dump VPD collection trace to [{}], error: {}",
+            constants::collectionTraceFile,
+            commonUtility::getErrCodeMsg(l_errCode)));
+        return;
+    }
+
+    m_logger->logMessage(
+        std::format("VPD collection trace with {} spans dumped to [{}]",
+                    l_spanCount, constants::collectionTraceFile),
+        PlaceHolder::COLLECTION);
+}
+
+void ThreadManager::logFailedPublications(
+    const std::vector<std::string>& i_failedObjectPaths) noexcept
+{
+    if (i_failedObjectPaths.empty())
+    {
+        return;
+    }
+
+    std::string l_objectPaths;
+    for (const auto& l_objectPath : i_failedObjectPaths)
     {
-        // Create shared context for FRU collection thread pool
-        auto l_fruThreadContext = std::make_shared<FruThreadContext>(
-            i_chassisEeepromPath, i_chassisJson);
+        l_objectPaths += (l_objectPaths.empty() ? "" : ", ") + l_objectPath;
+    }
+
+    m_logger->logMessage(
+        std::format("Failed to publish VPD of {} objects: [{}]",
+                    i_failedObjectPaths.size(), l_objectPaths),
+        PlaceHolder::COLLECTION);
+}
 
-        // Launch thread pool for parallel FRU VPD collection
-        for (size_t l_index = 0; l_index < i_maxThreadsPerChassis; ++l_index)
+void ThreadManager::confirmFingerprints(
+    const std::vector<std::string>& i_failedObjectPaths) noexcept
+{
+    const auto l_fingerprintStore = EepromFingerprintStore::getStoreInstance();
+
+    try
+    {
+        std::unordered_set<std::string> l_failedEepromPaths;
+        if (!i_failedObjectPaths.empty())
         {
-            try
+            const auto l_sysCfgJson = m_configManager->getJsonObj();
+            if (!l_sysCfgJson.has_value())
             {
-                std::thread([this, i_chassisEeepromPath, l_fruThreadContext]() {
-                    processFruCollection(l_fruThreadContext);
-                }).detach();
-
-                l_anyThreadLaunched = true;
+                throw std::runtime_error(
+                    "Failed to get system config JSON, error: " +
+                    commonUtility::getErrCodeMsg(l_sysCfgJson.error()));
             }
-            catch (const std::exception& l_ex)
+
+            // EEPROM failed if any of its objects did.
+            for (const auto& [l_eepromPath, l_subFruJsonArray] :
+                 l_sysCfgJson->get().at("frus").items())
             {
-                m_logger->logMessage(std::format(
-                    "Failed to launch FRU collection thread #{} for chassis "
-                    "[{}], error: {}",
-                    l_index + 1, i_chassisEeepromPath, l_ex.what()));
+                for (const auto& l_subFruJson : l_subFruJsonArray)
+                {
+                    if (std::ranges::binary_search(
+                            i_failedObjectPaths,
+                            l_subFruJson.value("inventoryPath", "")))
+                    {
+                        l_failedEepromPaths.emplace(l_eepromPath);
+                        break;
+                    }
+                }
             }
         }
+
+        l_fingerprintStore->confirmPending(l_failedEepromPaths);
     }
     catch (const std::exception& l_ex)
     {
+        // Without the outcome, no FRU can be skipped on recollection.
+        l_fingerprintStore->invalidateAll();
         m_logger->logMessage(std::format(
-            "Failed to create FRU collection thread pool for chassis "
-            "[{}], error: {}",
-            i_chassisEeepromPath, l_ex.what()));
+            "Failed to confirm EEPROM fingerprints, error: {}", l_ex.what()));
     }
+}
 
-    // Decrement the FRU counter if no threads were launched
-    if (!l_anyThreadLaunched &&
-        i_chassisJson["frus"].size() > constants::VALUE_1)
+void ThreadManager::markChassisComplete(
+    const std::shared_ptr<CollectionContext>& i_context) noexcept
+{
+    std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+    if (i_context->m_chassisCount > 0)
     {
-        m_frusCount -= i_chassisJson["frus"].size() - constants::VALUE_1;
-        m_completionCv.notify_one();
+        --i_context->m_chassisCount;
     }
+    i_context->m_completionCv.notify_all();
 }
 
-void ThreadManager::processFruCollection(
-    const std::shared_ptr<FruThreadContext>& i_fruThreadContext) noexcept
+void ThreadManager::submitCollectionTask(
+    const std::shared_ptr<CollectionContext>& i_context,
+    const std::string& i_eepromPath, std::function<void()> i_task)
 {
-    if (!i_fruThreadContext)
     {
-        m_logger->logMessage(
-            "Received null FRU thread context. Skipping FRU VPD collection.");
-        return;
+        std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+        ++i_context->m_inFlightTasks;
     }
 
+    const auto l_finishTask = [i_context]() {
+        std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+        --i_context->m_inFlightTasks;
+        i_context->m_completionCv.notify_all();
+    };
+
     try
     {
-        while (true)
-        {
-            // Get next FRU to process
-            std::string l_fruPath = getNextFruPath(i_fruThreadContext);
-
-            if (l_fruPath.empty())
-            {
-                break;
-            }
-
-            uint16_t l_errCode = 0;
-            auto [l_isPresent, l_collectionStatus] = Worker{}.collectFruVpd(
-                l_fruPath, i_fruThreadContext->m_chassisJson, l_errCode);
+        m_busScheduler->submit(
+            i_eepromPath,
+            [i_context, l_finishTask, l_task = std::move(i_task)]() {
+                bool l_isCancelled = false;
+                {
+                    std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+                    l_isCancelled = i_context->m_isCancelled;
+                }
 
-            // Update FRU count and notify waiting thread
-            if (m_frusCount > 0)
-            {
-                --m_frusCount;
-            }
-            m_completionCv.notify_one();
-        }
+                try
+                {
+                    if (!l_isCancelled)
+                    {
+                        l_task();
+                    }
+                }
+                catch (...)
+                {
+                    l_finishTask();
+                    throw;
+                }
+                l_finishTask();
+            });
     }
-    catch (const std::exception& l_ex)
+    catch (...)
     {
-        m_logger->logMessage(
-            std::format("Exception in FRU collection thread for chassis "
-                        "[{}], error: {}",
-                        i_fruThreadContext->m_chassisEeepromPath, l_ex.what()));
+        l_finishTask();
+        throw;
     }
 }
 
-std::string ThreadManager::getNextFruPath(
-    const std::shared_ptr<FruThreadContext>& i_fruThreadContext) const noexcept
+void ThreadManager::drainCollectionTasks(
+    const std::shared_ptr<CollectionContext>& i_context) noexcept
+{
+    std::unique_lock<std::mutex> l_lock(i_context->m_mutex);
+    i_context->m_isCancelled = true;
+
+    // Running tasks are bounded by EEPROM read and publish timeouts.
+    i_context->m_completionCv.wait(l_lock, [&i_context]() {
+        return i_context->m_inFlightTasks == 0;
+    });
+}
+
+void ThreadManager::launchFruCollection(
+    const std::shared_ptr<CollectionContext>& i_context,
+    const std::string& i_chassisEeepromPath,
+    const types::JsonSnapshot& i_chassisJson) noexcept
 {
+    size_t l_unqueuedFrus = 0;
+    std::shared_ptr<ChassisCollectionContext> l_chassisContext;
+
     try
     {
-        if (!i_fruThreadContext)
+        const auto& l_frus =
+            i_chassisJson->at("frus").get_ref<const nlohmann::json::object_t&>();
+
+        // Exclude chassis/motherboard VPD, which was already collected
+        const size_t l_fruCount =
+            l_frus.size() - (l_frus.contains(i_chassisEeepromPath)
+                                 ? constants::VALUE_1
+                                 : constants::VALUE_0);
+
+        if (l_fruCount == constants::VALUE_0)
         {
-            m_logger->logMessage("Invalid input is given");
-            return std::string{};
+            markChassisComplete(i_context);
+            return;
         }
 
-        std::string l_fruPath;
-
-        std::lock_guard<std::mutex> l_lock(i_fruThreadContext->m_fruItrMutex);
+        l_chassisContext = std::make_shared<ChassisCollectionContext>(
+            i_chassisEeepromPath, i_chassisJson, l_fruCount);
 
-        while (i_fruThreadContext->m_fruItr != i_fruThreadContext->m_frus.end())
         {
-            l_fruPath = i_fruThreadContext->m_fruItr->first;
-            ++i_fruThreadContext->m_fruItr;
+            std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+            i_context->m_chassisContexts.emplace_back(l_chassisContext);
+        }
 
-            // Skip chassis EEPROM as it was already collected
-            if (l_fruPath == i_fruThreadContext->m_chassisEeepromPath)
+        l_unqueuedFrus = l_fruCount;
+
+        // Task per FRU, so that idle threads can pick up FRUs of any chassis.
+        // Scheduler spreads the tasks across I2C buses.
+        for (const auto& l_fru :
+             l_chassisContext->m_chassisJson->at("frus").items())
+        {
+            if (l_fru.key() == i_chassisEeepromPath)
             {
-                l_fruPath.clear();
                 continue;
             }
 
-            break;
+            try
+            {
+                submitCollectionTask(
+                    i_context, l_fru.key(),
+                    [this, i_context, l_chassisContext, l_fruPath = l_fru.key(),
+                     l_queuedTime = std::chrono::steady_clock::now()]() {
+                        // Time spent waiting for bus slot and pool thread.
+                        CollectionTracer::getTracerInstance()->recordSpan(
+                            "queueWait", l_fruPath, l_queuedTime,
+                            std::chrono::steady_clock::now());
+
+                        collectChassisFru(i_context, l_chassisContext,
+                                          l_fruPath);
+                    });
+                --l_unqueuedFrus;
+            }
+            catch (const std::exception& l_ex)
+            {
+                m_logger->logMessage(std::format(
+                    "Failed to queue VPD collection of FRU [{}] of chassis "
+                    "[{}], error: {}",
+                    l_fru.key(), i_chassisEeepromPath, l_ex.what()));
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(std::format(
+            "Failed to launch FRU collection for chassis [{}], error: {}",
+            i_chassisEeepromPath, l_ex.what()));
+
+        if (!l_chassisContext)
+        {
+            markChassisComplete(i_context);
+            return;
         }
+    }
+
+    // Account for FRUs which couldn't be queued.
+    if (l_unqueuedFrus > 0 &&
+        l_chassisContext->m_pendingFrus.fetch_sub(l_unqueuedFrus) ==
+            l_unqueuedFrus)
+    {
+        markChassisComplete(i_context);
+    }
+}
 
-        return l_fruPath;
+void ThreadManager::collectChassisFru(
+    const std::shared_ptr<CollectionContext>& i_context,
+    const std::shared_ptr<ChassisCollectionContext>& i_chassisContext,
+    const std::string& i_fruPath) noexcept
+{
+    TraceSpan l_span("fruTask", i_fruPath);
+
+    try
+    {
+        uint16_t l_errCode = 0;
+        std::ignore = Worker{}.collectFruVpd(
+            i_fruPath, *i_chassisContext->m_chassisJson, l_errCode);
     }
     catch (const std::exception& l_ex)
     {
         m_logger->logMessage(std::format(
-            "Error while getting next FRU path, reason: {}", l_ex.what()));
-        return std::string{};
+            "Exception in FRU [{}] collection for chassis [{}], error: {}",
+            i_fruPath, i_chassisContext->m_chassisEeepromPath, l_ex.what()));
+    }
+
+    // Last FRU of the chassis completes the chassis.
+    if (i_chassisContext->m_pendingFrus.fetch_sub(1) == constants::VALUE_1)
+    {
+        m_logger->logEvent(
+            collectionLog::Event::CHASSIS_FRUS_COLLECTED,
+            i_chassisContext->m_chassisEeepromPath, 0,
+            static_cast<uint32_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() -
+                    i_chassisContext->m_startTime)
+                    .count()));
+
+        markChassisComplete(i_context);
     }
 }
 
 #ifdef IBM_SYSTEM
 void ThreadManager::handleChassisHavingSystemVpd(
-    const nlohmann::json& i_chassisJson, const std::string& i_chassisId,
+    const std::shared_ptr<CollectionContext>& i_context,
+    const types::JsonSnapshot& i_chassisJson, const std::string& i_chassisId,
     const std::string& i_eepromPath) noexcept
 {
     try
     {
+        const nlohmann::json& l_chassisJson = *i_chassisJson;
+
         // Read Present property value from Dbus.
         auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-            i_chassisJson["frus"][i_eepromPath][0]["serviceName"],
-            i_chassisJson["frus"][i_eepromPath][0]["inventoryPath"],
+            l_chassisJson["frus"][i_eepromPath][0]["serviceName"],
+            l_chassisJson["frus"][i_eepromPath][0]["inventoryPath"],
             constants::inventoryItemInf, "Present");
 
         bool l_isFruPresent = false;
@@ -500,22 +814,21 @@ void ThreadManager::handleChassisHavingSystemVpd(
             m_logger->logMessage(std::format(
                 "Invalid type received for Present property from D-Bus for inventory path: [{}], proceeding further by assuming chassis is absent.",
                 std::string(
-                    i_chassisJson["frus"][i_eepromPath][0]["inventoryPath"])));
+                    l_chassisJson["frus"][i_eepromPath][0]["inventoryPath"])));
         }
 
         updateSystemView(i_chassisId, i_eepromPath, l_isFruPresent);
 
         {
-            std::lock_guard<std::mutex> l_lock(m_mutex);
-            m_chassisResultQueue.push(
+            std::lock_guard<std::mutex> l_lock(i_context->m_mutex);
+            i_context->m_chassisResultQueue.push(
                 std::make_tuple(l_isFruPresent, i_eepromPath, i_chassisJson));
-            m_completionCv.notify_one();
+            i_context->m_completionCv.notify_all();
         }
     }
     catch (const std::exception& l_ex)
     {
-        --m_chassisCount;
-        m_completionCv.notify_one();
+        markChassisComplete(i_context);
 
         m_logger->logMessage(std::format(
             "Error while handling chassis with system VPD path, reason: {}",
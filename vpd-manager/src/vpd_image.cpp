@@ -0,0 +1,234 @@
+#include "vpd_image.hpp"
+
+#include "constants.hpp"
+#include "error_codes.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace vpd
+{
+VpdImage::~VpdImage()
+{
+    release();
+}
+
+void VpdImage::release() noexcept
+{
+    if (m_mappedAddress != nullptr)
+    {
+        ::munmap(m_mappedAddress, m_mappedLength);
+        m_mappedAddress = nullptr;
+        m_mappedLength = 0;
+    }
+
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_view = types::BinaryView{};
+}
+
+void VpdImage::load(const std::string& i_vpdFilePath, size_t i_vpdStartOffset,
+                    uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    release();
+
+    if (i_vpdFilePath.empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return;
+    }
+
+    const int l_fd = ::open(i_vpdFilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (l_fd < 0)
+    {
+        o_errCode = (errno == ENOENT) ? error_code::FILE_NOT_FOUND
+                                      : error_code::FILE_ACCESS_ERROR;
+        return;
+    }
+
+    struct stat l_fileStat{};
+    if (::fstat(l_fd, &l_fileStat) != 0)
+    {
+        ::close(l_fd);
+        o_errCode = error_code::FILE_SYSTEM_ERROR;
+        return;
+    }
+
+    const size_t l_fileSize = static_cast<size_t>(l_fileStat.st_size);
+    if (i_vpdStartOffset >= l_fileSize)
+    {
+        // Nothing to read, caller gets an empty view.
+        ::close(l_fd);
+        return;
+    }
+
+    const size_t l_vpdSize =
+        std::min(l_fileSize - i_vpdStartOffset, constants::MAX_VPD_SIZE);
+
+    // Only regular files are mapped. sysfs EEPROM nodes report a size but
+    // don't support mapping, those are read instead.
+    if (S_ISREG(l_fileStat.st_mode))
+    {
+        const size_t l_mapLength = i_vpdStartOffset + l_vpdSize;
+        void* l_address =
+            ::mmap(nullptr, l_mapLength, PROT_READ, MAP_PRIVATE, l_fd, 0);
+
+        if (l_address != MAP_FAILED)
+        {
+            ::close(l_fd);
+            m_mappedAddress = l_address;
+            m_mappedLength = l_mapLength;
+            m_view = types::BinaryView(
+                static_cast<const uint8_t*>(l_address) + i_vpdStartOffset,
+                l_vpdSize);
+            return;
+        }
+    }
+
+    try
+    {
+        m_buffer.resize(l_vpdSize);
+    }
+    catch (const std::exception& l_ex)
+    {
+        ::close(l_fd);
+        o_errCode = error_code::STANDARD_EXCEPTION;
+        return;
+    }
+
+    size_t l_bytesRead = 0;
+    while (l_bytesRead < l_vpdSize)
+    {
+        const ssize_t l_rc =
+            ::pread(l_fd, m_buffer.data() + l_bytesRead,
+                    l_vpdSize - l_bytesRead, i_vpdStartOffset + l_bytesRead);
+
+        if (l_rc < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ::close(l_fd);
+            m_buffer.clear();
+            o_errCode = error_code::FILE_SYSTEM_ERROR;
+            return;
+        }
+
+        if (l_rc == 0)
+        {
+            // End of file.
+            break;
+        }
+
+        l_bytesRead += static_cast<size_t>(l_rc);
+    }
+
+    ::close(l_fd);
+    m_buffer.resize(l_bytesRead);
+    m_view = types::BinaryView(m_buffer.data(), m_buffer.size());
+}
+
+void VpdImage::writeRanges(
+    const std::string& i_vpdFilePath, size_t i_vpdStartOffset,
+    const std::vector<std::pair<size_t, types::BinaryView>>& i_ranges,
+    uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+
+    if (i_vpdFilePath.empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return;
+    }
+
+    const int l_fd = ::open(i_vpdFilePath.c_str(), O_RDWR | O_CLOEXEC);
+    if (l_fd < 0)
+    {
+        o_errCode = (errno == ENOENT) ? error_code::FILE_NOT_FOUND
+                                      : error_code::FILE_ACCESS_ERROR;
+        return;
+    }
+
+    for (const auto& [l_offset, l_data] : i_ranges)
+    {
+        size_t l_bytesWritten = 0;
+        while (l_bytesWritten < l_data.size())
+        {
+            const size_t l_fileOffset =
+                i_vpdStartOffset + l_offset + l_bytesWritten;
+
+            // Stop at page boundary, so the EEPROM gets one page write for
+            // every chunk.
+            const size_t l_chunkLength = std::min(
+                l_data.size() - l_bytesWritten,
+                constants::EEPROM_PAGE_SIZE -
+                    (l_fileOffset % constants::EEPROM_PAGE_SIZE));
+
+            const ssize_t l_rc =
+                ::pwrite(l_fd, l_data.data() + l_bytesWritten, l_chunkLength,
+                         l_fileOffset);
+
+            if (l_rc < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (l_rc <= 0)
+            {
+                ::close(l_fd);
+                o_errCode = error_code::FILE_SYSTEM_ERROR;
+                return;
+            }
+
+            l_bytesWritten += static_cast<size_t>(l_rc);
+        }
+    }
+
+    // Verify only the ranges which were written.
+    for (const auto& [l_offset, l_data] : i_ranges)
+    {
+        types::BinaryVector l_readBack(l_data.size());
+
+        size_t l_bytesRead = 0;
+        while (l_bytesRead < l_readBack.size())
+        {
+            const ssize_t l_rc = ::pread(
+                l_fd, l_readBack.data() + l_bytesRead,
+                l_readBack.size() - l_bytesRead,
+                i_vpdStartOffset + l_offset + l_bytesRead);
+
+            if (l_rc < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (l_rc <= 0)
+            {
+                ::close(l_fd);
+                o_errCode = error_code::FILE_SYSTEM_ERROR;
+                return;
+            }
+
+            l_bytesRead += static_cast<size_t>(l_rc);
+        }
+
+        if (std::memcmp(l_readBack.data(), l_data.data(), l_data.size()) != 0)
+        {
+            ::close(l_fd);
+            o_errCode = error_code::INVALID_VALUE_READ_FROM_EEPROM;
+            return;
+        }
+    }
+
+    ::close(l_fd);
+}
+} // namespace vpd
@@ -3,12 +3,16 @@
 #include "worker.hpp"
 
 #include "backup_restore.hpp"
+#include "collection_tracer.hpp"
 #include "constants.hpp"
+#include "eeprom_fingerprint_store.hpp"
 #include "error_codes.hpp"
 #include "exceptions.hpp"
+#include "parsed_vpd_cache.hpp"
 #include "parser.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
+#include "pim_publisher.hpp"
 
 #include <utility/common_utility.hpp>
 #include <utility/dbus_utility.hpp>
@@ -791,6 +795,9 @@ types::VPDMapVariant Worker::parseVpdFile(
                 " Empty VPD file path passed. Abort parseVpdFile");
         }
 
+        // EEPROM is going to be read again, drop what readers have cached.
+        ParsedVpdCache::getCacheInstance()->invalidate(i_vpdFilePath);
+
         bool isPreActionRequired = false;
         if (!i_configJsonObj.empty())
         {
@@ -798,17 +805,20 @@ types::VPDMapVariant Worker::parseVpdFile(
                                               "collection", l_errCode))
             {
                 isPreActionRequired = true;
-                const types::BaseActionResult l_actionResult = processPreAction(
-                    i_configJsonObj, i_vpdFilePath, "collection", l_errCode);
+                types::BaseActionResult l_actionResult;
+                {
+                    TraceSpan l_preActionSpan("preAction", i_vpdFilePath);
+                    l_actionResult = processPreAction(
+                        i_configJsonObj, i_vpdFilePath, "collection",
+                        l_errCode);
+                }
 
                 if (l_actionResult.m_gpioPresenceErrorCode ==
                     error_code::DEVICE_NOT_PRESENT)
                 {
-                    m_logger->logMessage(
-                        commonUtility::getErrCodeMsg(
-                            l_actionResult.m_gpioPresenceErrorCode) +
-                            i_vpdFilePath,
-                        PlaceHolder::COLLECTION);
+                    m_logger->logEvent(
+                        collectionLog::Event::FRU_NOT_PRESENT, i_vpdFilePath,
+                        l_actionResult.m_gpioPresenceErrorCode);
 
                     // since pre action is reporting device not present,
                     // execute post fail action
@@ -892,6 +902,7 @@ types::VPDMapVariant Worker::parseVpdFile(
         if (jsonUtility::isActionRequired(i_vpdFilePath, "postAction",
                                           "collection", l_errCode))
         {
+            TraceSpan l_postActionSpan("postAction", i_vpdFilePath);
             if (!processPostAction(i_configJsonObj, i_vpdFilePath, "collection",
                                    l_parsedVpd))
             {
@@ -946,6 +957,7 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
     const nlohmann::json& i_configJson, const std::string& i_vpdFilePath,
     const bool& i_processRedundant)
 {
+    TraceSpan l_span("parseAndPublishVPD", i_vpdFilePath);
     uint16_t l_errCode = 0;
     bool l_presenceState = false;
     try
@@ -992,10 +1004,14 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
         if (!std::holds_alternative<std::monostate>(parsedVpdMap))
         {
             types::ObjectMap objectInterfaceMap;
-            populateDbus(i_configJson, parsedVpdMap, objectInterfaceMap,
-                         i_vpdFilePath);
+            {
+                TraceSpan l_populateSpan("populateDbus", i_vpdFilePath);
+                populateDbus(i_configJson, parsedVpdMap, objectInterfaceMap,
+                             i_vpdFilePath);
+            }
 
             // Call dbus method to update on dbus
+            TraceSpan l_publishSpan("pimPublish", i_vpdFilePath);
             if (!dbusUtility::publishVpdOnDBus(move(objectInterfaceMap)))
             {
                 throw FirmwareException(std::format(
@@ -1011,6 +1027,8 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
             // considered VPD collection is completed. Hence FRU collection
             // Status will be set as completed.
 
+            EepromFingerprintStore::getStoreInstance()->invalidate(
+                i_vpdFilePath);
             vpdSpecificUtility::resetObjTreeVpd(i_vpdFilePath, i_configJson,
                                                 l_errCode);
 
@@ -1022,9 +1040,8 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
                     "], error : " + commonUtility::getErrCodeMsg(l_errCode));
             }
 
-            m_logger->logMessage("Empty parsedVpdMap received for path [" +
-                                     i_vpdFilePath + "]. Check PEL for reason.",
-                                 PlaceHolder::COLLECTION);
+            m_logger->logEvent(collectionLog::Event::EMPTY_PARSED_VPD,
+                               i_vpdFilePath);
         }
 
         vpdSpecificUtility::setCollectionStatusProperty(
@@ -1047,6 +1064,7 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
 
         // stale data can be present on the system from previous boot. so
         // clearing of data in case of failure.
+        EepromFingerprintStore::getStoreInstance()->invalidate(i_vpdFilePath);
         vpdSpecificUtility::resetObjTreeVpd(i_vpdFilePath, i_configJson,
                                             l_errCode);
 
@@ -1082,11 +1100,9 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
 
                 if (l_errCode != 0)
                 {
-                    m_logger->logMessage(
-                        "Failed to get inventory object path from JSON for FRU [" +
-                            i_vpdFilePath + "], error: " +
-                            commonUtility::getErrCodeMsg(l_errCode),
-                        PlaceHolder::COLLECTION);
+                    m_logger->logEvent(collectionLog::Event::FRU_CHECK_FAILED,
+                                       i_vpdFilePath, l_errCode, 0,
+                                       "inventory object path from JSON");
                 }
 
                 const std::string& l_invPathLeafValue =
@@ -1101,17 +1117,17 @@ std::tuple<bool, bool> Worker::parseAndPublishVPD(
             }
             else if (l_errCode)
             {
-                m_logger->logMessage(
-                    "Failed to check if system is Pass 1 Planar, error : " +
-                        commonUtility::getErrCodeMsg(l_errCode),
-                    PlaceHolder::COLLECTION);
+                m_logger->logEvent(collectionLog::Event::FRU_CHECK_FAILED,
+                                   i_vpdFilePath, l_errCode, 0,
+                                   "Pass 1 Planar status of system");
             }
         }
 
         if (typeid(l_ex) == std::type_index(typeid(FirmwareException)) ||
             typeid(l_ex) == std::type_index(typeid(EepromException)))
         {
-            m_logger->logMessage(l_ex.what(), PlaceHolder::COLLECTION);
+            m_logger->logEvent(collectionLog::Event::FRU_COLLECTION_EXCEPTION,
+                               i_vpdFilePath, 0, 0, l_ex.what());
         }
         else
         {
@@ -1164,11 +1180,9 @@ bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
         }
         else if (l_errCode)
         {
-            m_logger->logMessage(
-                "Failed to check if FRU is power off only for FRU [" +
-                    i_vpdFilePath +
-                    "], error : " + commonUtility::getErrCodeMsg(l_errCode),
-                PlaceHolder::COLLECTION);
+            m_logger->logEvent(collectionLog::Event::FRU_CHECK_FAILED,
+                               i_vpdFilePath, l_errCode, 0,
+                               "power off only status");
         }
 
         std::string l_invPath =
@@ -1176,11 +1190,9 @@ bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
 
         if (l_errCode)
         {
-            m_logger->logMessage(
-                "Failed to get inventory path from JSON for FRU [" +
-                    i_vpdFilePath +
-                    "], error : " + commonUtility::getErrCodeMsg(l_errCode),
-                PlaceHolder::COLLECTION);
+            m_logger->logEvent(collectionLog::Event::FRU_CHECK_FAILED,
+                               i_vpdFilePath, l_errCode, 0,
+                               "inventory path from JSON");
 
             return false;
         }
@@ -1224,6 +1236,9 @@ void Worker::deleteFruVpd(const nlohmann::json& i_configJsonObj,
         return;
     }
 
+    ParsedVpdCache::getCacheInstance()->invalidate(l_fruPath);
+    EepromFingerprintStore::getStoreInstance()->invalidate(l_fruPath);
+
     try
     {
         if (jsonUtility::isActionRequired(l_fruPath, "preAction", "deletion",
@@ -1368,11 +1383,9 @@ void Worker::setPresentProperty(const nlohmann::json& i_configJson,
     }
     catch (const std::exception& l_ex)
     {
-        m_logger->logMessage(
-            std::format(
-                "Exception while setting the present property for path {}. Error {}.",
-                i_vpdPath, EventLogger::getErrorMsg(l_ex)),
-            PlaceHolder::COLLECTION);
+        m_logger->logEvent(
+            collectionLog::Event::PRESENT_PROPERTY_UPDATE_FAILED, i_vpdPath, 0,
+            0, EventLogger::getErrorMsg(l_ex));
     }
 }
 
@@ -1400,6 +1413,12 @@ void Worker::performVpdRecollection(
             return;
         }
 
+        const auto l_fingerprintStore =
+            EepromFingerprintStore::getStoreInstance();
+        const auto& l_publisher = PimPublisher::getPublisherInstance();
+        uint64_t l_skippedCount = 0;
+        uint64_t l_processedCount = 0;
+
         for (const auto& l_fruInventoryPath : l_frusReplaceableAtStandby)
         {
             const auto l_fruPath =
@@ -1414,8 +1433,76 @@ void Worker::performVpdRecollection(
                 continue;
             }
 
-            parseAndPublishVPD(i_sysCfgJsonObj, l_fruPath);
+            std::optional<EepromFingerprintStore::Fingerprint> l_fingerprint;
+            if (isFingerprintApplicable(i_sysCfgJsonObj, l_fruPath))
+            {
+                l_fingerprint = EepromFingerprintStore::computeFingerprint(
+                    l_fruPath, i_sysCfgJsonObj, l_errCode);
+            }
+
+            if (l_fingerprint.has_value() &&
+                l_fingerprintStore->isUnchanged(l_fruPath, *l_fingerprint))
+            {
+                // VPD on D-Bus is already of this content, just re-assert
+                // the state of the FRU.
+                if (isPresentPropertyHandlingRequired(
+                        i_sysCfgJsonObj.at("frus").at(l_fruPath).at(0)))
+                {
+                    setPresentProperty(i_sysCfgJsonObj, l_fruPath, true);
+                }
+
+                vpdSpecificUtility::setCollectionStatusProperty(
+                    l_fruPath, types::VpdCollectionStatus::Completed,
+                    i_sysCfgJsonObj, l_errCode);
+                if (l_errCode)
+                {
+                    m_logger->logMessage(
+                        "Failed to set collection status as completed for path " +
+                        l_fruPath +
+                        "Reason: " + commonUtility::getErrCodeMsg(l_errCode));
+                }
+
+                ++l_skippedCount;
+                continue;
+            }
+
+            // While a full collection runs, VPD is only queued to PIM and
+            // its outcome is known once the collection ends.
+            bool l_isPublishQueued = l_publisher->isRunning();
+
+            const auto [l_isCollected, l_isPresent] =
+                parseAndPublishVPD(i_sysCfgJsonObj, l_fruPath);
+            ++l_processedCount;
+
+            l_isPublishQueued = l_isPublishQueued || l_publisher->isRunning();
+
+            if (!l_isCollected || !l_isPresent || !l_fingerprint.has_value())
+            {
+                l_fingerprintStore->invalidate(l_fruPath);
+            }
+            else if (l_isPublishQueued)
+            {
+                l_fingerprintStore->setPending(l_fruPath, *l_fingerprint);
+            }
+            else
+            {
+                l_fingerprintStore->update(l_fruPath, *l_fingerprint);
+            }
+        }
+
+        l_fingerprintStore->setRecollectionCounts(l_skippedCount,
+                                                  l_processedCount);
+
+        if (!l_fingerprintStore->save(l_errCode))
+        {
+            m_logger->logMessage(
+                "Failed to save EEPROM fingerprints, error : " +
+                commonUtility::getErrCodeMsg(l_errCode));
         }
+
+        m_logger->logMessage(std::format(
+            "VPD recollection skipped {} unchanged FRU(s), processed {} FRU(s).",
+            l_skippedCount, l_processedCount));
         return;
     }
 
@@ -1427,6 +1514,73 @@ void Worker::performVpdRecollection(
     }
 }
 
+bool Worker::isFingerprintApplicable(
+    const nlohmann::json& i_sysCfgJsonObj,
+    const std::string& i_vpdFilePath) const noexcept
+{
+    try
+    {
+        if (!i_sysCfgJsonObj.contains("frus") ||
+            !i_sysCfgJsonObj.at("frus").contains(i_vpdFilePath) ||
+            i_sysCfgJsonObj.at("frus").at(i_vpdFilePath).at(0).value(
+                "isRedundant", false))
+        {
+            return false;
+        }
+
+        // Actions may have effects beyond reading the EEPROM.
+        uint16_t l_errCode = 0;
+        for (const auto& l_action : {"preAction", "postAction"})
+        {
+            if (jsonUtility::isActionRequired(i_vpdFilePath, l_action,
+                                              "collection", l_errCode) ||
+                l_errCode)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(
+            "Failed to check if fingerprint is applicable for [" +
+            i_vpdFilePath + "], error : " + std::string(l_ex.what()));
+    }
+    return false;
+}
+
+void Worker::setPendingFingerprint(const nlohmann::json& i_cfgJsonObj,
+                                   const std::string& i_vpdFilePath) noexcept
+{
+    try
+    {
+        // Only FRUs replaceable at standby are recollected.
+        if (!i_cfgJsonObj.at("frus").at(i_vpdFilePath).at(0).value(
+                "replaceableAtStandby", false) ||
+            !isFingerprintApplicable(i_cfgJsonObj, i_vpdFilePath))
+        {
+            return;
+        }
+
+        uint16_t l_errCode = 0;
+        const auto l_fingerprint = EepromFingerprintStore::computeFingerprint(
+            i_vpdFilePath, i_cfgJsonObj, l_errCode);
+        if (l_fingerprint.has_value())
+        {
+            EepromFingerprintStore::getStoreInstance()->setPending(
+                i_vpdFilePath, *l_fingerprint);
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        // FRU just gets processed again on next recollection.
+        m_logger->logMessage(
+            "Failed to set pending fingerprint for [" + i_vpdFilePath +
+            "], error : " + std::string(l_ex.what()));
+    }
+}
+
 void Worker::collectSingleFruVpd(const nlohmann::json& i_configJsonObj,
                                  const sdbusplus::object_path& i_dbusObjPath)
 {
@@ -1556,6 +1710,7 @@ void Worker::collectSingleFruVpd(const nlohmann::json& i_configJsonObj,
 
             // Stale data from the previous boot can be present on the
             // system. so clearing of data.
+            EepromFingerprintStore::getStoreInstance()->invalidate(l_fruPath);
             vpdSpecificUtility::resetObjTreeVpd(std::string(i_dbusObjPath),
                                                 i_configJsonObj, l_errCode);
 
@@ -1604,6 +1759,7 @@ void Worker::collectSingleFruVpd(const nlohmann::json& i_configJsonObj,
     catch (const std::exception& l_error)
     {
         std::string l_errMsg;
+        EepromFingerprintStore::getStoreInstance()->invalidate(l_fruPath);
         vpdSpecificUtility::resetObjTreeVpd(std::string(i_dbusObjPath),
                                             i_configJsonObj, l_errCode);
 
@@ -1713,11 +1869,9 @@ bool Worker::processRedundantPreAction(
     }
     catch (const std::exception& l_ex)
     {
-        m_logger->logMessage(
-            std::format(
-                "Process redundant path failed for EEPROM [{}], reason [{}] ",
-                i_eepromFilePath, EventLogger::getErrorMsg(l_ex)),
-            PlaceHolder::COLLECTION);
+        m_logger->logEvent(collectionLog::Event::REDUNDANT_COLLECTION_FAILED,
+                           i_eepromFilePath, 0, 0,
+                           EventLogger::getErrorMsg(l_ex));
     }
     return false;
 }
@@ -1726,6 +1880,7 @@ std::tuple<bool, std::string> Worker::collectFruVpd(
     const std::string& i_fruPath, const nlohmann::json& i_cfgJsonObj,
     uint16_t& o_errCode) noexcept
 {
+    TraceSpan l_span("collectFruVpd", i_fruPath);
     o_errCode = 0;
     bool l_fruPresent = false;
 
@@ -1755,6 +1910,11 @@ std::tuple<bool, std::string> Worker::collectFruVpd(
         auto l_parseResult = parseAndPublishVPD(i_cfgJsonObj, i_fruPath);
         l_fruPresent = std::get<1>(l_parseResult);
 
+        if (std::get<0>(l_parseResult) && l_fruPresent)
+        {
+            setPendingFingerprint(i_cfgJsonObj, i_fruPath);
+        }
+
         // If VPD collection from a primary FRU fails, attempt
         // collection from its redundant EEPROM path (if
         // configured).
@@ -1767,11 +1927,9 @@ std::tuple<bool, std::string> Worker::collectFruVpd(
 
             if (!l_redundantEepromPath.empty())
             {
-                m_logger->logMessage(
-                    std::format(
-                        "Triggerring vpd collection from redundant VPD path [ {} ]",
-                        l_redundantEepromPath),
-                    PlaceHolder::COLLECTION);
+                m_logger->logEvent(
+                    collectionLog::Event::REDUNDANT_COLLECTION_TRIGGERED,
+                    l_redundantEepromPath);
 
                 l_parseResult = parseAndPublishVPD(i_cfgJsonObj,
                                                    l_redundantEepromPath, true);
@@ -1779,11 +1937,9 @@ std::tuple<bool, std::string> Worker::collectFruVpd(
             }
             else if (l_errCode)
             {
-                m_logger->logMessage(
-                    std::format(
-                        "Failed to fetch redundant EEPROM path for primary path [{}], error [{}]",
-                        i_fruPath, commonUtility::getErrCodeMsg(l_errCode)),
-                    PlaceHolder::COLLECTION);
+                m_logger->logEvent(collectionLog::Event::FRU_CHECK_FAILED,
+                                   i_fruPath, l_errCode, 0,
+                                   "redundant EEPROM path");
             }
         }
 
@@ -417,6 +417,46 @@ inline int writeKeyword(const std::string& i_vpdPath,
     return l_rc;
 }
 
+/**
+ * @brief API to write value of multiple keywords.
+ *
+ * This API writes value of multiple keywords of an IPZ type FRU by requesting
+ * DBus service(vpd-manager) who hosts the 'UpdateKeywords' method. All the
+ * keywords are updated in a single request.
+ *
+ * @param[in] i_vpdPath - EEPROM or object path, where keywords are present.
+ * @param[in] i_keywordsToUpdate - List of (Record, Keyword, Value).
+ *
+ * @return - Number of bytes written on success, -1 on failure.
+ *
+ * @throw - std::runtime_error, sdbusplus::exception::SdBusError
+ */
+inline int writeKeywords(const std::string& i_vpdPath,
+                         const std::vector<types::IpzData>& i_keywordsToUpdate)
+{
+    if (i_vpdPath.empty())
+    {
+        throw std::runtime_error("Empty path");
+    }
+
+    int l_rc = constants::FAILURE;
+    auto l_bus = sdbusplus::bus::new_default();
+
+    auto l_method = l_bus.new_method_call(
+        constants::vpdManagerService, constants::vpdManagerObjectPath,
+        constants::vpdManagerInfName, "UpdateKeywords");
+
+    l_method.append(i_vpdPath, i_keywordsToUpdate);
+
+    // Same as UpdateKeyword, increase the timeout period from default 25
+    // seconds to 180 seconds to allow large writes.
+    auto l_timeOutInMicroSecs = 180000000L;
+    auto l_result = l_bus.call(l_method, l_timeOutInMicroSecs);
+
+    l_result.read(l_rc);
+    return l_rc;
+}
+
 /**
  * @brief API to write keyword's value on hardware.
  *
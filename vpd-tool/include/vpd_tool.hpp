@@ -175,16 +175,18 @@ class VpdTool
      *
      * API iterates the given JSON object for all record-keyword pairs, if there
      * is any mismatch between source and destination keyword's value, API calls
-     * the utils::writeKeyword API to update keyword's value.
+     * the utils::writeKeywords API to update all such keywords' value in a
+     * single request. If that request fails, keywords are updated one at a time
+     * using utils::writeKeyword, so a failing keyword doesn't block the others.
      *
-     * Note: writeKeyword API, internally updates primary, backup, redundant
+     * Note: writeKeyword(s) API, internally updates primary, backup, redundant
      * EEPROM paths(if exists) with the given keyword's value.
      *
      * @param i_parsedJsonObj - Parsed JSON object.
      * @param i_useBackupData - Specifies whether to use source or destination
      * keyword's value to update the keyword's value.
      *
-     * @return On success return 0, otherwise return -1.
+     * @return 0 if at least one keyword got updated, otherwise -1.
      */
     int updateAllKeywords(const nlohmann::json& i_parsedJsonObj,
                           bool i_useBackupData) const noexcept;
@@ -311,6 +313,26 @@ class VpdTool
                      const std::string& i_keywordValue,
                      const bool i_onHardware) const noexcept;
 
+    /**
+     * @brief Write value of multiple keywords.
+     *
+     * API reads record, keyword and value triplets from the given JSON file
+     * and updates all of them on the given DBus object path in a single
+     * request. Primary, backup and redundant EEPROM(if any) paths get updated.
+     *
+     * JSON file should be in the form of {"<Record>": {"<Keyword>": "<Value>"}}
+     * where value is either in ascii or in hex format.
+     * Eg: {"VINI": {"SN": "ABCDEFG", "PN": "0x30313233"}}
+     *
+     * @param[in] i_vpdPath - DBus object path.
+     * @param[in] i_filePath - Path to JSON file with keywords' value.
+     *
+     * @return On success returns number of bytes written, otherwise returns
+     * corresponding error code.
+     */
+    int writeKeywords(std::string i_vpdPath,
+                      const std::string& i_filePath) const noexcept;
+
     /**
      * @brief Reset specific keywords on System VPD to default value.
      *
@@ -385,5 +407,22 @@ class VpdTool
      * @return On success returns 0, otherwise returns -1.
      */
     int validateRedundantEeprom(const std::string& i_fruPath) const noexcept;
+
+    /**
+     * @brief Decode binary VPD collection log.
+     *
+     * This API decodes the given binary VPD collection log, written by VPD
+     * manager when built with binary_collection_log option, and prints its
+     * events to console in text or JSON format. Messages of the events are
+     * formatted the way VPD manager logs them in text collection log.
+     *
+     * @param[in] i_logFilePath - Path of the binary collection log file.
+     * @param[in] i_isJsonFormat - Flag which specifies if events should be
+     * printed in JSON format or not.
+     *
+     * @return On success returns 0, otherwise returns corresponding error code.
+     */
+    int decodeCollectionLog(const std::string& i_logFilePath,
+                            const bool i_isJsonFormat) const noexcept;
 };
 } // namespace vpd
@@ -6,12 +6,20 @@
 #include "tool_error_codes.hpp"
 #include "tool_types.hpp"
 #include "tool_utils.hpp"
+#include "vpd-manager/include/collection_log_record.hpp"
 
+#include <array>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
 #include <iostream>
 #include <print>
 #include <regex>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 namespace vpd
 {
 // {Record, Keyword} -> {attribute name, number of bits in keyword, starting bit
@@ -576,6 +584,89 @@ int VpdTool::writeKeyword(
     }
 }
 
+int VpdTool::writeKeywords(std::string i_vpdPath,
+                           const std::string& i_filePath) const noexcept
+{
+    try
+    {
+        if (i_vpdPath.empty() || i_filePath.empty())
+        {
+            std::cerr << "Received input is empty." << std::endl;
+            return static_cast<int>(ErrorCode::INVALID_INPUT_PARAMETER);
+        }
+
+        const nlohmann::json l_keywordsJson = utils::getParsedJson(i_filePath);
+
+        if (!l_keywordsJson.is_object() || l_keywordsJson.empty())
+        {
+            std::cerr << "Invalid JSON [" << i_filePath << "]." << std::endl;
+            return static_cast<int>(ErrorCode::INVALID_INPUT_PARAMETER);
+        }
+
+        std::vector<types::IpzData> l_keywordsToUpdate;
+
+        for (const auto& [l_recordName, l_keywords] : l_keywordsJson.items())
+        {
+            if (l_recordName.size() != constants::RECORD_SIZE ||
+                !l_keywords.is_object())
+            {
+                std::cerr << "Invalid record [" << l_recordName << "]."
+                          << std::endl;
+                return static_cast<int>(ErrorCode::INVALID_INPUT_PARAMETER);
+            }
+
+            for (const auto& [l_keywordName, l_keywordValue] :
+                 l_keywords.items())
+            {
+                if (l_keywordName.size() != constants::KEYWORD_SIZE ||
+                    !l_keywordValue.is_string())
+                {
+                    std::cerr << "Invalid keyword [" << l_recordName << " : "
+                              << l_keywordName << "]." << std::endl;
+                    return static_cast<int>(
+                        ErrorCode::INVALID_INPUT_PARAMETER);
+                }
+
+                const auto& l_binaryVector = utils::convertToBinary(
+                    l_keywordValue.get<std::string>());
+
+                if (!l_binaryVector)
+                {
+                    std::cerr << "Failed to convert value of [" << l_recordName
+                              << " : " << l_keywordName
+                              << "] into binary vector" << std::endl;
+                    return static_cast<int>(l_binaryVector.error());
+                }
+
+                l_keywordsToUpdate.emplace_back(l_recordName, l_keywordName,
+                                                l_binaryVector.value());
+            }
+        }
+
+        i_vpdPath = constants::baseInventoryPath + i_vpdPath;
+        const int l_rc = utils::writeKeywords(i_vpdPath, l_keywordsToUpdate);
+
+        if (l_rc <= 0)
+        {
+            return static_cast<int>(ErrorCode::DBUS_CALL_FAILED);
+        }
+
+        std::cout << std::format(
+                         "{} bytes updated successfully on path {} for {} "
+                         "keyword(s)",
+                         l_rc, i_vpdPath, l_keywordsToUpdate.size())
+                  << std::endl;
+        return l_rc;
+    }
+    catch (const std::exception& l_ex)
+    {
+        // TODO: Enable log when verbose is enabled.
+        std::cerr << "Write keywords' value for path: " << i_vpdPath
+                  << " is failed. Exception: " << l_ex.what() << std::endl;
+        return static_cast<int>(ErrorCode::STANDARD_EXCEPTION);
+    }
+}
+
 nlohmann::json VpdTool::getBackupRestoreCfgJsonObj() const noexcept
 {
     nlohmann::json l_parsedBackupRestoreJson{};
@@ -1245,6 +1336,8 @@ int VpdTool::updateAllKeywords(const nlohmann::json& i_parsedJsonObj,
     }
 
     bool l_anyMismatchFound = false;
+    std::vector<types::IpzData> l_keywordsToUpdate;
+
     for (const auto& l_aRecordKwInfo : i_parsedJsonObj["backupMap"])
     {
         if (!l_aRecordKwInfo.contains("sourceRecord") ||
@@ -1263,29 +1356,69 @@ int VpdTool::updateAllKeywords(const nlohmann::json& i_parsedJsonObj,
         {
             l_anyMismatchFound = true;
 
-            auto l_keywordValue =
-                i_useBackupData ? l_aRecordKwInfo["destinationkeywordValue"]
-                                : l_aRecordKwInfo["sourcekeywordValue"];
-
-            auto l_paramsToWrite = std::make_tuple(
-                l_aRecordKwInfo["sourceRecord"],
-                l_aRecordKwInfo["sourceKeyword"], l_keywordValue);
-
             try
             {
-                l_rc = utils::writeKeyword(l_srcVpdPath, l_paramsToWrite);
-                if (l_rc > 0)
-                {
-                    l_rc = constants::SUCCESS;
-                }
+                const auto& l_keywordValue =
+                    i_useBackupData ? l_aRecordKwInfo["destinationkeywordValue"]
+                                    : l_aRecordKwInfo["sourcekeywordValue"];
+
+                l_keywordsToUpdate.emplace_back(
+                    l_aRecordKwInfo["sourceRecord"].get<std::string>(),
+                    l_aRecordKwInfo["sourceKeyword"].get<std::string>(),
+                    l_keywordValue.get<types::BinaryVector>());
             }
             catch (const std::exception& l_ex)
             {
                 // TODO: Enable logging when verbose is enabled.
-                std::cerr << "write keyword failed for record: "
+                std::cerr << "Invalid data for record: "
                           << l_aRecordKwInfo["sourceRecord"]
                           << ", keyword: " << l_aRecordKwInfo["sourceKeyword"]
-                          << ", error: " << l_ex.what() << std::ends;
+                          << ", error: " << l_ex.what() << std::endl;
+            }
+        }
+    }
+
+    if (!l_keywordsToUpdate.empty())
+    {
+        // Update all mismatching keywords in a single request.
+        try
+        {
+            if (utils::writeKeywords(l_srcVpdPath, l_keywordsToUpdate) > 0)
+            {
+                l_rc = constants::SUCCESS;
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            // TODO: Enable logging when verbose is enabled.
+            std::cerr << "write keywords failed for path: " << l_srcVpdPath
+                      << ", error: " << l_ex.what() << std::endl;
+        }
+
+        if (l_rc != constants::SUCCESS)
+        {
+            // Single request failed, update keywords one by one so that a
+            // failing keyword doesn't stop update of the others.
+            for (const auto& [l_recordName, l_keywordName, l_keywordValue] :
+                 l_keywordsToUpdate)
+            {
+                try
+                {
+                    if (utils::writeKeyword(
+                            l_srcVpdPath, std::make_tuple(l_recordName,
+                                                          l_keywordName,
+                                                          l_keywordValue)) > 0)
+                    {
+                        l_rc = constants::SUCCESS;
+                    }
+                }
+                catch (const std::exception& l_ex)
+                {
+                    // TODO: Enable logging when verbose is enabled.
+                    std::cerr << "write keyword failed for record: "
+                              << l_recordName << ", keyword: " << l_keywordName
+                              << ", error: " << l_ex.what() << std::endl;
+                }
             }
         }
     }
@@ -1830,4 +1963,176 @@ int VpdTool::validateRedundantEeprom(
     return l_rc;
 }
 
+int VpdTool::decodeCollectionLog(const std::string& i_logFilePath,
+                                 const bool i_isJsonFormat) const noexcept
+{
+    try
+    {
+        std::ifstream l_logFile(i_logFilePath, std::ios::binary);
+        if (!l_logFile)
+        {
+            std::cerr << "Failed to open collection log file ["
+                      << i_logFilePath << "]." << std::endl;
+            return static_cast<int>(ErrorCode::FILE_NOT_FOUND);
+        }
+
+        collectionLog::FileHeader l_fileHeader;
+        if (!l_logFile.read(reinterpret_cast<char*>(&l_fileHeader),
+                            sizeof(l_fileHeader)) ||
+            l_fileHeader.m_magic != collectionLog::FILE_MAGIC ||
+            l_fileHeader.m_recordSize < sizeof(collectionLog::Record))
+        {
+            std::cerr << "File [" << i_logFilePath
+                      << "] is not a binary VPD collection log." << std::endl;
+            return static_cast<int>(ErrorCode::INVALID_INPUT_PARAMETER);
+        }
+
+        if (l_fileHeader.m_version > collectionLog::FORMAT_VERSION)
+        {
+            std::cerr << "Collection log format version "
+                      << l_fileHeader.m_version
+                      << " is newer than supported, decoding known fields."
+                      << std::endl;
+        }
+
+        // An event, with payload of its split records joined.
+        struct DecodedEvent
+        {
+            collectionLog::Record m_record;
+            std::string m_payload;
+        };
+
+        std::vector<DecodedEvent> l_events;
+
+        // Thread id to index of its event whose payload is being joined.
+        std::unordered_map<uint32_t, size_t> l_joiningEvents;
+
+        // Bytes past sizeof(Record) are of a newer format, skipped. A partial
+        // record at the end, if writing got interrupted, is dropped.
+        std::vector<char> l_recordBuffer(l_fileHeader.m_recordSize);
+        while (l_logFile.read(l_recordBuffer.data(),
+                              static_cast<std::streamsize>(
+                                  l_recordBuffer.size())))
+        {
+            collectionLog::Record l_record;
+            std::memcpy(&l_record, l_recordBuffer.data(), sizeof(l_record));
+
+            const std::string_view l_payload(
+                l_record.m_payload.data(),
+                std::min<size_t>(l_record.m_payloadLength,
+                                 collectionLog::RECORD_PAYLOAD_SIZE));
+
+            size_t l_eventIndex = l_events.size();
+            if (const auto l_itr = l_joiningEvents.find(l_record.m_threadId);
+                l_itr != l_joiningEvents.end())
+            {
+                l_eventIndex = l_itr->second;
+                l_events[l_eventIndex].m_payload.append(l_payload);
+            }
+            else
+            {
+                l_events.emplace_back(l_record, std::string(l_payload));
+            }
+
+            if (l_record.m_flags & collectionLog::FLAG_CONTINUED)
+            {
+                l_joiningEvents[l_record.m_threadId] = l_eventIndex;
+            }
+            else
+            {
+                l_joiningEvents.erase(l_record.m_threadId);
+            }
+        }
+
+        // String table is built first, as a record can be written by another
+        // thread before definition of its string completes.
+        std::unordered_map<uint16_t, std::string> l_stringTable;
+        for (const auto& l_event : l_events)
+        {
+            if (l_event.m_record.m_event ==
+                std::to_underlying(collectionLog::Event::STRING_DEFINITION))
+            {
+                l_stringTable[l_event.m_record.m_fruIndex] = l_event.m_payload;
+            }
+        }
+
+        nlohmann::json l_eventsJson = nlohmann::json::array();
+        for (const auto& l_event : l_events)
+        {
+            const auto& l_record = l_event.m_record;
+            if (l_record.m_event ==
+                std::to_underlying(collectionLog::Event::STRING_DEFINITION))
+            {
+                continue;
+            }
+
+            std::string l_fruPath;
+            if (const auto l_itr = l_stringTable.find(l_record.m_fruIndex);
+                l_itr != l_stringTable.end())
+            {
+                l_fruPath = l_itr->second;
+            }
+
+            std::string l_eventName{"UNKNOWN_" +
+                                    std::to_string(l_record.m_event)};
+            std::string l_message{l_event.m_payload};
+            if (const auto l_descriptor =
+                    collectionLog::getEventDescriptor(l_record.m_event))
+            {
+                l_eventName = l_descriptor->m_name;
+                l_message = collectionLog::formatEventMessage(
+                    *l_descriptor, l_fruPath, l_record.m_errorCode,
+                    l_record.m_value, l_event.m_payload);
+            }
+
+            // Local time, the way collection text log is timestamped.
+            const auto l_seconds =
+                static_cast<std::time_t>(l_record.m_timestamp / 1000000000);
+            std::tm l_localTime{};
+            localtime_r(&l_seconds, &l_localTime);
+
+            std::array<char, 32> l_dateTime{};
+            std::strftime(l_dateTime.data(), l_dateTime.size(),
+                          "%Y-%m-%d %H:%M:%S", &l_localTime);
+            const std::string l_timestamp =
+                std::format("{}.{:03}", l_dateTime.data(),
+                            (l_record.m_timestamp / 1000000) % 1000);
+
+            if (!i_isJsonFormat)
+            {
+                std::println("{} : [{}] {}", l_timestamp, l_record.m_threadId,
+                             l_message);
+                continue;
+            }
+
+            l_eventsJson.emplace_back(nlohmann::json{
+                {"timestamp", l_timestamp},
+                {"threadId", l_record.m_threadId},
+                {"event", l_eventName},
+                {"fruPath", l_fruPath},
+                {"errorCode", l_record.m_errorCode},
+                {"value", l_record.m_value},
+                {"payload", l_event.m_payload},
+                {"message", l_message}});
+        }
+
+        if (i_isJsonFormat)
+        {
+            const auto l_printJsonRes = utils::printJson(l_eventsJson);
+            if (!l_printJsonRes)
+            {
+                return static_cast<int>(l_printJsonRes.error());
+            }
+        }
+
+        return constants::SUCCESS;
+    }
+    catch (const std::exception& l_ex)
+    {
+        std::cerr << "Failed to decode collection log [" << i_logFilePath
+                  << "]. Error: " << l_ex.what() << std::endl;
+        return static_cast<int>(ErrorCode::STANDARD_EXCEPTION);
+    }
+}
+
 } // namespace vpd
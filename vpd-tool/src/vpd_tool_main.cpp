@@ -289,6 +289,10 @@ void updateFooter(CLI::App& i_app)
         "        On hardware, take keyword value from file:\n"
         "              vpd-tool -w/-u -H -O <EEPROM Path> -K <Keyword Name> --file <File Path>\n"
         "    Note: If record option is not provided, it will be considered as keyword format.\n"
+        "    Multiple keywords, IPZ Format:\n"
+        "        On DBus, take keywords' value from JSON file:\n"
+        "              vpd-tool --writeKeywords/--updateKeywords -O <DBus Object Path> --file <File Path>\n"
+        "              File format: {\"<Record Name>\": {\"<Keyword Name>\": \"<Keyword Value>\"}}\n"
         "Dump Inventory:\n"
         "   From DBus to console in JSON format: "
         "vpd-tool -i\n"
@@ -300,6 +304,11 @@ void updateFooter(CLI::App& i_app)
         "Validate EEPROM:\n"
         "   Validate given EEPROM against its redundant copy:\n"
         "   vpd-tool --validateRedundantEeprom/-e -O <EEPROM Path>\n"
+        "Decode Collection Log:\n"
+        "   Binary VPD collection log to console in text format: "
+        "vpd-tool --decodeCollectionLog --file <Log File Path>\n"
+        "   Binary VPD collection log to console in JSON format: "
+        "vpd-tool --decodeCollectionLog --json --file <Log File Path>\n"
         "Return Values:\n"
         "   Success:\n"
         "       Non-negative number.\n"
@@ -386,6 +395,16 @@ int main(int argc, char** argv)
             ->needs(l_objectOption)
             ->needs(l_keywordOption);
 
+    auto l_writeKeywordsFlag =
+        l_app
+            .add_flag(
+                "--writeKeywords, --updateKeywords",
+                "Write multiple keywords in a single request,\nNote: File should contain keywords' value in JSON format, {\"<Record>\": {\"<Keyword>\": \"<Value>\"}}.\nBoth EEPROM and DBus are updated with the given keywords' value.")
+            ->needs(l_objectOption)
+            ->needs(l_fileOption)
+            ->excludes(l_hardwareFlag)
+            ->excludes(l_writeFlag);
+
     // ToDo: Take offset value from user for hardware path.
 
     auto l_dumpInventoryFlag =
@@ -404,6 +423,17 @@ int main(int argc, char** argv)
                       "Validate given EEPROM against its redundant EEPROM")
             ->needs(l_objectOption);
 
+    auto l_decodeCollectionLogFlag =
+        l_app
+            .add_flag(
+                "--decodeCollectionLog",
+                "Decode binary VPD collection log, given by --file, to console")
+            ->needs(l_fileOption);
+
+    auto l_jsonFlag =
+        l_app.add_flag("--json", "Decode collection log in JSON format")
+            ->needs(l_decodeCollectionLogFlag);
+
 #if 0
     auto l_dumpObjFlag =
         l_app
@@ -433,6 +463,20 @@ int main(int argc, char** argv)
 
     CLI11_PARSE(l_app, argc, argv);
 
+    // Offline operation, so allowed without VPD manager.
+    if (!l_decodeCollectionLogFlag->empty())
+    {
+        if (l_filePath.empty())
+        {
+            std::cerr << "File path is empty." << std::endl;
+            return static_cast<int>(vpd::ErrorCode::EMPTY_FILE);
+        }
+
+        vpd::VpdTool l_vpdToolObj;
+        return l_vpdToolObj.decodeCollectionLog(l_filePath,
+                                                !l_jsonFlag->empty());
+    }
+
     const auto l_vpdCollectionStatus = vpd::utils::readDbusProperty(
         vpd::constants::vpdManagerService, vpd::constants::vpdManagerObjectPath,
         vpd::constants::vpdCollectionInterface,
@@ -506,6 +550,12 @@ int main(int argc, char** argv)
                             l_recordName, l_keywordName, l_keywordValue);
     }
 
+    if (!l_writeKeywordsFlag->empty())
+    {
+        vpd::VpdTool l_vpdToolObj;
+        return l_vpdToolObj.writeKeywords(l_vpdPath, l_filePath);
+    }
+
     if (!l_dumpInventoryFlag->empty())
     {
         vpd::VpdTool l_vpdToolObj;